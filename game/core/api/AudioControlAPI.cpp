@@ -20,13 +20,7 @@ AudioControlAPI::AudioControlAPI()
       masterVolume_(1.0f),
       seVolume_(1.0f),
       bgmVolume_(1.0f),
-      crossfadeDuration_(kDefaultCrossfadeSeconds),
-      crossfadeTimer_(0.0f),
-      crossfadeActive_(false),
-      currentMusic_(nullptr),
-      currentMusicName_(""),
-      nextMusic_(nullptr),
-      nextMusicName_("") {}
+      crossfadeDuration_(kDefaultCrossfadeSeconds) {}
 
 bool AudioControlAPI::Initialize(BaseSystemAPI* systemAPI) {
     if (!systemAPI) {
@@ -39,12 +33,6 @@ bool AudioControlAPI::Initialize(BaseSystemAPI* systemAPI) {
     seVolume_ = systemAPI_->Audio().GetSEVolume();
     bgmVolume_ = systemAPI_->Audio().GetBGMVolume();
     crossfadeDuration_ = kDefaultCrossfadeSeconds;
-    crossfadeTimer_ = 0.0f;
-    crossfadeActive_ = false;
-    currentMusic_ = nullptr;
-    currentMusicName_.clear();
-    nextMusic_ = nullptr;
-    nextMusicName_.clear();
 
     isInitialized_ = true;
     LOG_INFO("AudioControlAPI initialized");
@@ -67,36 +55,6 @@ void AudioControlAPI::Update(float deltaTime) {
     }
 
     systemAPI_->Audio().UpdateAudio(deltaTime);
-
-    if (currentMusic_ && !systemAPI_->Audio().IsMusicStreamPlaying(currentMusic_)) {
-        currentMusic_ = nullptr;
-        currentMusicName_.clear();
-    }
-
-    if (crossfadeActive_) {
-        crossfadeTimer_ += deltaTime;
-        const float progress = GetCrossfadeProgress();
-        ApplyBGMVolumes(1.0f - progress, progress);
-
-        UpdateMusicStreamSafe(currentMusic_);
-        UpdateMusicStreamSafe(nextMusic_);
-
-        if (progress >= 1.0f) {
-            StopMusicStreamSafe(currentMusic_);
-            currentMusic_ = nextMusic_;
-            currentMusicName_ = nextMusicName_;
-            nextMusic_ = nullptr;
-            nextMusicName_.clear();
-            crossfadeActive_ = false;
-            crossfadeTimer_ = 0.0f;
-        }
-        return;
-    }
-
-    if (currentMusic_) {
-        ApplyBGMVolumes(1.0f, 0.0f);
-        UpdateMusicStreamSafe(currentMusic_);
-    }
 }
 
 bool AudioControlAPI::PlayBGM(const std::string& name) {
@@ -110,64 +68,18 @@ bool AudioControlAPI::PlayBGM(const std::string& name) {
         return true;
     }
 
-    if (crossfadeActive_ && nextMusicName_ == name) {
-        return true;
-    }
-
-    if (currentMusic_ && currentMusicName_ == name &&
-        systemAPI_->Audio().IsMusicStreamPlaying(currentMusic_)) {
-        return true;
-    }
-
-    void* musicPtr = systemAPI_->Resource().GetMusic(name);
-    if (!musicPtr) {
-        LOG_ERROR("AudioControlAPI: Failed to get music: {}", name);
-        return false;
-    }
-
-    ::Music* music = static_cast<::Music*>(musicPtr);
-
-    if (!currentMusic_ || !systemAPI_->Audio().IsMusicStreamPlaying(currentMusic_)) {
-        StopMusicStreamSafe(currentMusic_);
-        currentMusic_ = music;
-        currentMusicName_ = name;
-        nextMusic_ = nullptr;
-        nextMusicName_.clear();
-        crossfadeActive_ = false;
-        crossfadeTimer_ = 0.0f;
-
-        systemAPI_->Audio().PlayMusicStream(currentMusic_);
-        ApplyBGMVolumes(1.0f, 0.0f);
-        LOG_INFO("AudioControlAPI: Playing BGM: {}", name);
-        return true;
-    }
-
-    StopMusicStreamSafe(nextMusic_);
-    nextMusic_ = music;
-    nextMusicName_ = name;
-    crossfadeActive_ = true;
-    crossfadeTimer_ = 0.0f;
-
-    systemAPI_->Audio().PlayMusicStream(nextMusic_);
-    systemAPI_->Audio().SetMusicVolume(nextMusic_, 0.0f);
-    LOG_INFO("AudioControlAPI: Crossfade to BGM: {}", name);
-    return true;
+    // 何も鳴っていなければ即時、鳴っていればクロスフェードで切り替える
+    const float fadeSeconds =
+        systemAPI_->Audio().IsMusicPlaying() ? crossfadeDuration_ : 0.0f;
+    return systemAPI_->Audio().PlayMusic(name, fadeSeconds);
 }
 
 void AudioControlAPI::StopBGM() {
-    if (!isInitialized_) {
+    if (!isInitialized_ || !systemAPI_) {
         return;
     }
 
-    StopMusicStreamSafe(currentMusic_);
-    StopMusicStreamSafe(nextMusic_);
-
-    currentMusic_ = nullptr;
-    currentMusicName_.clear();
-    nextMusic_ = nullptr;
-    nextMusicName_.clear();
-    crossfadeActive_ = false;
-    crossfadeTimer_ = 0.0f;
+    systemAPI_->Audio().StopMusic();
 }
 
 bool AudioControlAPI::PlaySE(const std::string& name) {
@@ -183,13 +95,6 @@ void AudioControlAPI::SetMasterVolume(float volume) {
     if (systemAPI_) {
         systemAPI_->Audio().SetMasterVolume(masterVolume_);
     }
-
-    if (crossfadeActive_) {
-        const float progress = GetCrossfadeProgress();
-        ApplyBGMVolumes(1.0f - progress, progress);
-    } else {
-        ApplyBGMVolumes(1.0f, 0.0f);
-    }
 }
 
 void AudioControlAPI::SetSEVolume(float volume) {
@@ -204,13 +109,6 @@ void AudioControlAPI::SetBGMVolume(float volume) {
     if (systemAPI_) {
         systemAPI_->Audio().SetBGMVolume(bgmVolume_);
     }
-
-    if (crossfadeActive_) {
-        const float progress = GetCrossfadeProgress();
-        ApplyBGMVolumes(1.0f - progress, progress);
-    } else {
-        ApplyBGMVolumes(1.0f, 0.0f);
-    }
 }
 
 float AudioControlAPI::GetMasterVolume() const {
@@ -226,56 +124,15 @@ float AudioControlAPI::GetBGMVolume() const {
 }
 
 std::string AudioControlAPI::GetCurrentBGMName() const {
-    return currentMusicName_;
+    if (!systemAPI_) {
+        return "";
+    }
+    return systemAPI_->Audio().GetCurrentMusicName();
 }
 
 float AudioControlAPI::ClampVolume(float volume) const {
     return std::max(0.0f, std::min(1.0f, volume));
 }
 
-float AudioControlAPI::GetBaseBGMVolume() const {
-    return masterVolume_ * bgmVolume_;
-}
-
-float AudioControlAPI::GetCrossfadeProgress() const {
-    if (!crossfadeActive_) {
-        return 0.0f;
-    }
-    if (crossfadeDuration_ <= 0.0f) {
-        return 1.0f;
-    }
-    return std::min(1.0f, crossfadeTimer_ / crossfadeDuration_);
-}
-
-void AudioControlAPI::ApplyBGMVolumes(float currentWeight, float nextWeight) {
-    const float baseVolume = GetBaseBGMVolume();
-    if (currentMusic_) {
-        systemAPI_->Audio().SetMusicVolume(currentMusic_,
-                                           baseVolume * currentWeight);
-    }
-    if (nextMusic_) {
-        systemAPI_->Audio().SetMusicVolume(nextMusic_,
-                                           baseVolume * nextWeight);
-    }
-}
-
-void AudioControlAPI::UpdateMusicStreamSafe(::Music* music) const {
-    if (!music) {
-        return;
-    }
-    if (systemAPI_->Audio().IsMusicStreamPlaying(music)) {
-        systemAPI_->Audio().UpdateMusicStream(music);
-    }
-}
-
-void AudioControlAPI::StopMusicStreamSafe(::Music* music) const {
-    if (!music) {
-        return;
-    }
-    if (systemAPI_->Audio().IsMusicStreamPlaying(music)) {
-        systemAPI_->Audio().StopMusicStream(music);
-    }
-}
-
 } // namespace core
 } // namespace game
@@ -3,9 +3,6 @@
 // 標準ライブラリ
 #include <string>
 
-// プロジェクト内
-#include "../config/RenderTypes.hpp"
-
 namespace game {
 namespace core {
 
@@ -40,11 +37,6 @@ public:
 
 private:
     float ClampVolume(float volume) const;
-    float GetBaseBGMVolume() const;
-    float GetCrossfadeProgress() const;
-    void ApplyBGMVolumes(float currentWeight, float nextWeight);
-    void UpdateMusicStreamSafe(Music* music) const;
-    void StopMusicStreamSafe(Music* music) const;
 
     BaseSystemAPI* systemAPI_;
     bool isInitialized_;
@@ -52,14 +44,8 @@ private:
     float seVolume_;
     float bgmVolume_;
 
+    // BGM 切り替え時のクロスフェード秒数（フェード自体は MusicStreamWorker が進める）
     float crossfadeDuration_;
-    float crossfadeTimer_;
-    bool crossfadeActive_;
-
-    ::Music* currentMusic_;
-    std::string currentMusicName_;
-    ::Music* nextMusic_;
-    std::string nextMusicName_;
 };
 
 } // namespace core
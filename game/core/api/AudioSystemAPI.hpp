@@ -5,6 +5,7 @@
 
 // プロジェクト内
 #include "../config/RenderTypes.hpp"
+#include "SoundVoicePool.hpp"
 
 namespace game {
 namespace core {
@@ -18,21 +19,27 @@ public:
   ~AudioSystemAPI() = default;
 
   void UpdateAudio(float deltaTime);
+
+  /// @brief 効果音をハンドルへ解決（読み込みとボイスの確保はここで1回だけ行う）
+  /// @details 高頻度で鳴らす効果音は生成時にハンドルを取り、以降は PlaySound(handle) で再生する。
+  SoundHandle ResolveSound(const std::string& name,
+                           SoundCategory category = SoundCategory::UI,
+                           int priority = 0);
+  /// @brief ハンドルの効果音を空きボイスで再生（文字列の解決なし）
+  bool PlaySound(SoundHandle handle);
+  /// @brief 名前で再生（未解決なら UI 分類で解決する）
   bool PlaySound(const std::string& name);
-  bool PlayMusic(const std::string& name);
+  /// @brief BGM を再生（再生中の BGM は fadeSeconds かけてクロスフェード）
+  /// @details ストリーム更新とフェードは MusicStreamWorker が受け持つため、ここはコマンドを積むだけ。
+  bool PlayMusic(const std::string& name, float fadeSeconds = 0.0f);
   void StopSound();
   void StopSound(const std::string& name);
-  void StopMusic();
+  void StopMusic(float fadeSeconds = 0.0f);
 
   bool IsSoundPlaying(const std::string& name) const;
   bool IsMusicPlaying() const;
   std::string GetCurrentMusicName() const;
 
-  bool IsMusicStreamPlaying(Music* music) const;
-  void PlayMusicStream(Music* music);
-  void StopMusicStream(Music* music);
-  void UpdateMusicStream(Music* music);
-  void SetMusicVolume(Music* music, float volume);
 
   void SetMasterVolume(float volume);
   void SetSEVolume(float volume);
@@ -41,12 +48,17 @@ public:
   float GetSEVolume() const;
   float GetBGMVolume() const;
 
+  void SetSoundCategoryLimit(SoundCategory category, int maxVoices);
+  SoundVoicePool::Stats GetSoundVoiceStats() const;
+
 private:
   BaseSystemAPI* owner_;
 
   float ClampVolume(float volume) const;
-  void UpdateSoundVolume(Sound* sound) const;
-  void UpdateMusicVolume(Music* music) const;
+  void UpdateSoundVolume() const;
+  void UpdateMusicVolume() const;
+  bool HasCurrentMusicEnded() const;
+  void ReleaseEndedMusic();
 };
 
 } // namespace core
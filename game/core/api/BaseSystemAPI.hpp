@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 // 外部ライブラリ
@@ -19,6 +20,9 @@
 #include "CollisionSystemAPI.hpp"
 #include "RenderSystemAPI.hpp"
 #include "ResourceSystemAPI.hpp"
+#include "SoundVoicePool.hpp"
+#include "TextureAtlasPacker.hpp"
+#include "TextureResidency.hpp"
 #include "TimingSystemAPI.hpp"
 #include "WindowSystemAPI.hpp"
 
@@ -26,6 +30,10 @@
 namespace game {
 namespace core {
 
+class GlyphCache;
+class MusicStreamWorker;
+class ResourceDecodeQueue;
+
 #if !defined(EMSCRIPTEN) && !defined(__EMSCRIPTEN__)
 using LogLevel = spdlog::level::level_enum;
 #else
@@ -72,7 +80,15 @@ private:
   // ========== プライベートメソッド ==========
   void RecreateRenderTexture();
   Font *GetDefaultFontInternal() const;
-  void GenerateFontCodepoints();
+  GlyphCache *FindGlyphCache(const Font &font) const;
+  /// @brief text に必要なグリフを用意し、描画に使う Font を返す（キャッシュ外のフォントはそのまま）
+  Font *PrepareFontText(Font *font, const std::string &text);
+  /// @brief text のレイアウトを TextLayoutCache から取得し、グリフを用意して描画に使う Font を drawFont に返す
+  const TextLayout &LayoutFontText(Font *font, const std::string &text,
+                                   float fontSize, float spacing,
+                                   float wrapWidth, Font &drawFont);
+  /// @brief 描画に使う Font（キャッシュのフォントはキャッシュ側、nullptr は raylib 既定フォント）
+  Font ResolveDrawFont(Font *font) const;
   void InitializeLogSystem();
   void ShutdownLogSystem();
   float CalculateTextureLuminance(const std::string &textureKey);
@@ -98,18 +114,40 @@ private:
   std::string logFileName_;
 
   std::unordered_map<std::string, std::shared_ptr<Texture2D>> textures_;
+  // テクスチャハンドル表（添字 0 は無効ハンドル用の番兵）
+  std::vector<std::string> textureHandleKeys_;
+  std::vector<Texture2D *> textureHandleTable_;
+  std::unordered_map<std::string, TextureHandle> textureHandleByName_;
+  std::vector<TextureRegion> textureHandleRegions_;
+  std::vector<uint32_t> textureHandleResidency_;  // TextureResidency のエントリ（解決時に設定）
+  // 単体テクスチャの VRAM 常駐管理（textures_ と Texture2D オブジェクトを共有）
+  TextureResidency textureResidency_;
+  std::unordered_map<std::string, std::vector<std::string>> texturePreloadSets_;
+  // キャラクターシートのアトラス（一括ロード完了時に構築）
+  std::vector<std::pair<std::string, Image>> atlasPendingImages_;
+  // アトラス構築はロード画面の1ステップずつ進める（パック → 1ページずつ合成/転送 → 仕上げ）
+  bool atlasPacked_ = false;
+  std::vector<TextureAtlasPacker::Placement> atlasPlacements_;
+  std::vector<TextureAtlasPacker::PageSize> atlasPageSizes_;
+  size_t atlasNextPage_ = 0;
+  int atlasStepsDone_ = 0;
+  std::vector<std::shared_ptr<Texture2D>> textureAtlases_;
+  std::unordered_map<std::string, TextureRegion> textureAtlasRegions_;
   std::unordered_map<std::string, std::shared_ptr<Sound>> sounds_;
   std::unordered_map<std::string, std::shared_ptr<Music>> musics_;
-  std::unordered_map<std::string, std::shared_ptr<Font>> fonts_;
-  std::shared_ptr<Font> defaultFont_;
+  // フォントはグリフを初回使用時にラスタライズする動的アトラスで保持
+  std::unordered_map<std::string, std::shared_ptr<GlyphCache>> fonts_;
+  std::shared_ptr<GlyphCache> defaultFont_;
+  // 文字列の計測・折り返し結果（キーは GlyphCache のアドレス。フォント破棄時に Clear）
+  TextLayoutCache textLayoutCache_;
 
-  std::vector<int> fontCodepoints_;
   bool imGuiInitialized_;
   void *imGuiJapaneseFont_;
 
   std::vector<ResourceFileInfo> resourceFileList_;
   size_t currentResourceIndex_;
   bool scanningCompleted_;
+  std::unique_ptr<ResourceDecodeQueue> decodeQueue_;  // 一括ロード中のみ存在
 
   std::unordered_set<std::string> registeredTextureKeys_;
   std::vector<AssetLicenseEntry> assetLicenses_;
@@ -117,9 +155,12 @@ private:
   float masterVolume_;
   float seVolume_;
   float bgmVolume_;
-  Music *currentMusic_;
+  Music *currentMusic_;  // 最後に再生を依頼した BGM（実際の再生状態はワーカー側が持つ）
   std::string currentMusicName_;
-  std::unordered_map<std::string, Sound *> playingSounds_;
+  // BGM のストリーム更新とフェード（musics_ の Music を使うため musics_ より先に破棄する）
+  std::unique_ptr<MusicStreamWorker> musicWorker_;
+  // 効果音のボイス（sounds_ の Sound を共有するため sounds_ より先に Clear する）
+  SoundVoicePool soundVoices_;
 
   bool fpsDisplayEnabled_;
   bool cursorDisplayEnabled_;
@@ -127,6 +168,12 @@ private:
   std::unordered_map<std::string, float> textureLuminanceCache_;
   std::unordered_map<std::string, Color> textureTextColorCache_;
 
+  // スプライトバッチ（RenderSystemAPI::BeginSpriteBatch～FlushSpriteBatch）
+  std::vector<RenderSystemAPI::SpriteBatchItem> spriteBatchItems_;
+  bool spriteBatchActive_ = false;
+  RenderSystemAPI::SpriteBatchStats spriteBatchFrameStats_;
+  RenderSystemAPI::SpriteBatchStats spriteBatchLastFrameStats_;
+
   RenderSystemAPI renderAPI_;
   ResourceSystemAPI resourceAPI_;
   AudioSystemAPI audioAPI_;
@@ -1,5 +1,6 @@
 ﻿#include "../AudioSystemAPI.hpp"
 #include "../BaseSystemAPI.hpp"
+#include "../MusicStreamWorker.hpp"
 
 // Project
 #include "../../../utils/Log.h"
@@ -14,80 +15,78 @@ void AudioSystemAPI::UpdateAudio(float deltaTime) {
     return;
   }
 
-  if (owner_->currentMusic_ != nullptr) {
-    try {
-      if (::IsMusicStreamPlaying(*owner_->currentMusic_)) {
-        ::UpdateMusicStream(*owner_->currentMusic_);
-      } else {
-        owner_->currentMusic_ = nullptr;
-        owner_->currentMusicName_.clear();
-      }
-    } catch (...) {
-      LOG_WARN("AudioSystemAPI: Music became invalid during update");
-      owner_->currentMusic_ = nullptr;
-      owner_->currentMusicName_.clear();
-    }
+  // スレッドなし（Web）のときだけ BGM のストリーム更新をここで回す
+  if (owner_->musicWorker_ && !owner_->musicWorker_->IsThreaded()) {
+    owner_->musicWorker_->Pump(deltaTime);
   }
 
-  auto it = owner_->playingSounds_.begin();
-  while (it != owner_->playingSounds_.end()) {
-    Sound *sound = it->second;
-    if (sound) {
-      try {
-        if (!::IsSoundPlaying(*sound)) {
-          it = owner_->playingSounds_.erase(it);
-          continue;
-        }
-      } catch (...) {
-        LOG_WARN("AudioSystemAPI: Sound became invalid during update");
-        it = owner_->playingSounds_.erase(it);
-        continue;
-      }
-    }
-    ++it;
-  }
+  // ループしない BGM が鳴り終わっていたら、依頼中の状態を解除する
+  ReleaseEndedMusic();
+
+  // 再生が終わったボイスの回収と、同一フレーム重複判定のリセット
+  owner_->soundVoices_.Update();
 }
 
-bool AudioSystemAPI::PlaySound(const std::string &name) {
+SoundHandle AudioSystemAPI::ResolveSound(const std::string &name,
+                                         SoundCategory category, int priority) {
   if (!owner_->isInitialized_) {
     LOG_ERROR("AudioSystemAPI: Not initialized");
-    return false;
+    return INVALID_SOUND_HANDLE;
+  }
+
+  SoundHandle handle = owner_->soundVoices_.Find(name);
+  if (handle != INVALID_SOUND_HANDLE) {
+    return handle;
   }
 
   void *soundPtr = owner_->Resource().GetSound(name);
   if (!soundPtr) {
     LOG_ERROR("AudioSystemAPI: Failed to get sound: {}", name);
-    return false;
+    return INVALID_SOUND_HANDLE;
   }
 
-  Sound *sound = static_cast<Sound *>(soundPtr);
-
-  ::PlaySound(*sound);
+  handle = owner_->soundVoices_.Register(name, static_cast<Sound *>(soundPtr),
+                                         category, priority);
+  UpdateSoundVolume();
+  return handle;
+}
 
-  UpdateSoundVolume(sound);
+bool AudioSystemAPI::PlaySound(SoundHandle handle) {
+  if (!owner_->isInitialized_) {
+    return false;
+  }
+  return owner_->soundVoices_.Play(handle);
+}
 
-  owner_->playingSounds_[name] = sound;
+bool AudioSystemAPI::PlaySound(const std::string &name) {
+  if (!owner_->isInitialized_) {
+    LOG_ERROR("AudioSystemAPI: Not initialized");
+    return false;
+  }
 
-  LOG_DEBUG("AudioSystemAPI: Playing sound: {}", name);
-  return true;
+  SoundHandle handle = owner_->soundVoices_.Find(name);
+  if (handle == INVALID_SOUND_HANDLE) {
+    handle = ResolveSound(name);
+    if (handle == INVALID_SOUND_HANDLE) {
+      return false;
+    }
+  }
+  return PlaySound(handle);
 }
 
-bool AudioSystemAPI::PlayMusic(const std::string &name) {
-  if (!owner_->isInitialized_) {
+bool AudioSystemAPI::PlayMusic(const std::string &name, float fadeSeconds) {
+  if (!owner_->isInitialized_ || !owner_->musicWorker_) {
     LOG_ERROR("AudioSystemAPI: Not initialized");
     return false;
   }
 
-  if (owner_->currentMusic_ != nullptr && owner_->currentMusicName_ == name &&
-      ::IsMusicStreamPlaying(*owner_->currentMusic_)) {
+  ReleaseEndedMusic();
+  if (owner_->currentMusic_ != nullptr && owner_->currentMusicName_ == name) {
     LOG_DEBUG("AudioSystemAPI: Music already playing: {}", name);
     return true;
   }
 
-  if (owner_->currentMusic_ != nullptr) {
-    ::StopMusicStream(*owner_->currentMusic_);
-  }
-
+  // 読み込み（ファイルオープン）はゲームスレッドで済ませ、再生以降をワーカーへ渡す
   void *musicPtr = owner_->Resource().GetMusic(name);
   if (!musicPtr) {
     LOG_ERROR("AudioSystemAPI: Failed to get music: {}", name);
@@ -95,15 +94,15 @@ bool AudioSystemAPI::PlayMusic(const std::string &name) {
   }
 
   Music *music = static_cast<Music *>(musicPtr);
-
-  ::PlayMusicStream(*music);
-
-  UpdateMusicVolume(music);
+  if (!owner_->musicWorker_->Play(music, fadeSeconds)) {
+    return false;
+  }
 
   owner_->currentMusic_ = music;
   owner_->currentMusicName_ = name;
 
-  LOG_INFO("AudioSystemAPI: Playing music: {}", name);
+  LOG_INFO("AudioSystemAPI: Playing music: {} (fade {:.2f}s)", name,
+           fadeSeconds);
   return true;
 }
 
@@ -112,14 +111,7 @@ void AudioSystemAPI::StopSound() {
     return;
   }
 
-  for (auto &pair : owner_->playingSounds_) {
-    Sound *sound = pair.second;
-    if (sound) {
-      ::StopSound(*sound);
-    }
-  }
-
-  owner_->playingSounds_.clear();
+  owner_->soundVoices_.StopAll();
   LOG_DEBUG("AudioSystemAPI: Stopped all sounds");
 }
 
@@ -128,23 +120,21 @@ void AudioSystemAPI::StopSound(const std::string &name) {
     return;
   }
 
-  auto it = owner_->playingSounds_.find(name);
-  if (it != owner_->playingSounds_.end()) {
-    Sound *sound = it->second;
-    if (sound) {
-      ::StopSound(*sound);
-    }
-    owner_->playingSounds_.erase(it);
+  const SoundHandle handle = owner_->soundVoices_.Find(name);
+  if (handle != INVALID_SOUND_HANDLE) {
+    owner_->soundVoices_.Stop(handle);
     LOG_DEBUG("AudioSystemAPI: Stopped sound: {}", name);
   }
 }
 
-void AudioSystemAPI::StopMusic() {
+void AudioSystemAPI::StopMusic(float fadeSeconds) {
   if (!owner_->isInitialized_ || !owner_->currentMusic_) {
     return;
   }
 
-  ::StopMusicStream(*owner_->currentMusic_);
+  if (owner_->musicWorker_) {
+    owner_->musicWorker_->Stop(fadeSeconds);
+  }
   owner_->currentMusic_ = nullptr;
   owner_->currentMusicName_.clear();
   LOG_DEBUG("AudioSystemAPI: Stopped music");
@@ -155,83 +145,18 @@ bool AudioSystemAPI::IsSoundPlaying(const std::string &name) const {
     return false;
   }
 
-  auto it = owner_->playingSounds_.find(name);
-  if (it != owner_->playingSounds_.end()) {
-    Sound *sound = it->second;
-    if (sound) {
-      try {
-        return ::IsSoundPlaying(*sound);
-      } catch (...) {
-        return false;
-      }
-    }
-  }
-
-  return false;
+  return owner_->soundVoices_.IsPlaying(owner_->soundVoices_.Find(name));
 }
 
 bool AudioSystemAPI::IsMusicPlaying() const {
-  if (!owner_->isInitialized_ || !owner_->currentMusic_) {
-    return false;
-  }
-
-  try {
-    return ::IsMusicStreamPlaying(*owner_->currentMusic_);
-  } catch (...) {
-    return false;
-  }
-}
-
-bool AudioSystemAPI::IsMusicStreamPlaying(Music *music) const {
-  if (!owner_->isInitialized_ || !music) {
-    return false;
-  }
-
-  try {
-    return ::IsMusicStreamPlaying(*music);
-  } catch (...) {
-    return false;
-  }
-}
-
-void AudioSystemAPI::PlayMusicStream(Music *music) {
-  if (!owner_->isInitialized_ || !music) {
-    return;
-  }
-
-  ::PlayMusicStream(*music);
-}
-
-void AudioSystemAPI::StopMusicStream(Music *music) {
-  if (!owner_->isInitialized_ || !music) {
-    return;
-  }
-
-  if (::IsMusicStreamPlaying(*music)) {
-    ::StopMusicStream(*music);
-  }
-}
-
-void AudioSystemAPI::UpdateMusicStream(Music *music) {
-  if (!owner_->isInitialized_ || !music) {
-    return;
-  }
-
-  if (::IsMusicStreamPlaying(*music)) {
-    ::UpdateMusicStream(*music);
-  }
-}
-
-void AudioSystemAPI::SetMusicVolume(Music *music, float volume) {
-  if (!owner_->isInitialized_ || !music) {
-    return;
-  }
-
-  ::SetMusicVolume(*music, ClampVolume(volume));
+  // Music の再生状態はワーカーが更新するため、ゲームスレッドからは依頼した状態を返す
+  return owner_->isInitialized_ && owner_->currentMusic_ != nullptr &&
+         !HasCurrentMusicEnded();
 }
 
 std::string AudioSystemAPI::GetCurrentMusicName() const {
-  if (!owner_->isInitialized_ || !owner_->currentMusic_) {
+  if (!owner_->isInitialized_ || !owner_->currentMusic_ ||
+      HasCurrentMusicEnded()) {
     return "";
   }
 
@@ -243,14 +168,8 @@ void AudioSystemAPI::SetMasterVolume(float volume) {
 
   ::SetMasterVolume(owner_->masterVolume_);
 
-  for (auto &pair : owner_->playingSounds_) {
-    if (pair.second) {
-      UpdateSoundVolume(pair.second);
-    }
-  }
-  if (owner_->currentMusic_) {
-    UpdateMusicVolume(owner_->currentMusic_);
-  }
+  UpdateSoundVolume();
+  UpdateMusicVolume();
 
   LOG_DEBUG("AudioSystemAPI: Master volume set to {:.2f}",
             owner_->masterVolume_);
@@ -259,11 +178,7 @@ void AudioSystemAPI::SetMasterVolume(float volume) {
 void AudioSystemAPI::SetSEVolume(float volume) {
   owner_->seVolume_ = ClampVolume(volume);
 
-  for (auto &pair : owner_->playingSounds_) {
-    if (pair.second) {
-      UpdateSoundVolume(pair.second);
-    }
-  }
+  UpdateSoundVolume();
 
   LOG_DEBUG("AudioSystemAPI: SE volume set to {:.2f}", owner_->seVolume_);
 }
@@ -271,9 +186,7 @@ void AudioSystemAPI::SetSEVolume(float volume) {
 void AudioSystemAPI::SetBGMVolume(float volume) {
   owner_->bgmVolume_ = ClampVolume(volume);
 
-  if (owner_->currentMusic_) {
-    UpdateMusicVolume(owner_->currentMusic_);
-  }
+  UpdateMusicVolume();
 
   LOG_DEBUG("AudioSystemAPI: BGM volume set to {:.2f}", owner_->bgmVolume_);
 }
@@ -284,26 +197,45 @@ float AudioSystemAPI::GetSEVolume() const { return owner_->seVolume_; }
 
 float AudioSystemAPI::GetBGMVolume() const { return owner_->bgmVolume_; }
 
+void AudioSystemAPI::SetSoundCategoryLimit(SoundCategory category,
+                                           int maxVoices) {
+  owner_->soundVoices_.SetCategoryLimit(category, maxVoices);
+}
+
+SoundVoicePool::Stats AudioSystemAPI::GetSoundVoiceStats() const {
+  return owner_->soundVoices_.GetStats();
+}
+
 float AudioSystemAPI::ClampVolume(float volume) const {
   return std::max(0.0f, std::min(1.0f, volume));
 }
 
-void AudioSystemAPI::UpdateSoundVolume(Sound *sound) const {
-  if (!sound) {
-    return;
-  }
-
+void AudioSystemAPI::UpdateSoundVolume() const {
   float finalVolume = owner_->masterVolume_ * owner_->seVolume_;
-  ::SetSoundVolume(*sound, finalVolume);
+  owner_->soundVoices_.SetVolume(finalVolume);
 }
 
-void AudioSystemAPI::UpdateMusicVolume(Music *music) const {
-  if (!music) {
+void AudioSystemAPI::UpdateMusicVolume() const {
+  if (!owner_->musicWorker_) {
     return;
   }
 
   float finalVolume = owner_->masterVolume_ * owner_->bgmVolume_;
-  ::SetMusicVolume(*music, finalVolume);
+  owner_->musicWorker_->SetVolume(finalVolume);
+}
+
+bool AudioSystemAPI::HasCurrentMusicEnded() const {
+  return owner_->currentMusic_ != nullptr && owner_->musicWorker_ &&
+         owner_->musicWorker_->HasLastPlayEnded();
+}
+
+void AudioSystemAPI::ReleaseEndedMusic() {
+  if (!HasCurrentMusicEnded()) {
+    return;
+  }
+  LOG_DEBUG("AudioSystemAPI: Music finished: {}", owner_->currentMusicName_);
+  owner_->currentMusic_ = nullptr;
+  owner_->currentMusicName_.clear();
 }
 
 } // namespace core
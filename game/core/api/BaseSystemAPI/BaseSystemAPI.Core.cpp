@@ -1,4 +1,7 @@
 #include "../BaseSystemAPI.hpp"
+#include "../GlyphCache.hpp"
+#include "../MusicStreamWorker.hpp"
+#include "../ResourceDecodeQueue.hpp"
 #include "../../../utils/Log.h"
 #include <iostream>
 
@@ -19,7 +22,6 @@ BaseSystemAPI::BaseSystemAPI()
       fpsDisplayEnabled_(false), cursorDisplayEnabled_(false), logInitialized_(false), logDirectory_("logs"),
       logFileName_("game.log"), renderAPI_(this), resourceAPI_(this),
       audioAPI_(this), windowAPI_(this), timingAPI_(this), collisionAPI_(this) {
-  GenerateFontCodepoints();
 }
 
 BaseSystemAPI::~BaseSystemAPI() {
@@ -54,6 +56,14 @@ bool BaseSystemAPI::Initialize(Resolution initialResolution) {
 
   InitAudioDevice();
 
+  // BGM のストリーム更新は専用スレッドで行う（Web はスレッドなしで UpdateAudio から回す）
+#if !defined(EMSCRIPTEN) && !defined(__EMSCRIPTEN__)
+  musicWorker_ = std::make_unique<MusicStreamWorker>(true);
+#else
+  musicWorker_ = std::make_unique<MusicStreamWorker>(false);
+#endif
+  musicWorker_->SetVolume(masterVolume_ * bgmVolume_);
+
   RecreateRenderTexture();
   if (mainRenderTexture_.id == 0) {
 #if !defined(EMSCRIPTEN) && !defined(__EMSCRIPTEN__)
@@ -61,6 +71,7 @@ bool BaseSystemAPI::Initialize(Resolution initialResolution) {
 #else
     std::cerr << "BaseSystemAPI: Failed to create RenderTexture" << std::endl;
 #endif
+    musicWorker_.reset();
     CloseAudioDevice();
     CloseWindow();
     return false;
@@ -85,13 +96,42 @@ void BaseSystemAPI::Shutdown() {
 
   defaultFont_.reset();
 
+  // ワーカーを止めて全ストリームを停止してから Music を破棄
+  musicWorker_.reset();
+  currentMusic_ = nullptr;
+  currentMusicName_.clear();
   musics_.clear();
 
+  soundVoices_.Clear();
   sounds_.clear();
 
   fonts_.clear();
+  textLayoutCache_.Clear();
+
+  // デコード中のワーカーを止めてからリソースを破棄
+  decodeQueue_.reset();
+
+  textureHandleKeys_.clear();
+  textureHandleTable_.clear();
+  textureHandleByName_.clear();
+  textureHandleRegions_.clear();
+  textureHandleResidency_.clear();
+  texturePreloadSets_.clear();
+
+  for (auto &pending : atlasPendingImages_) {
+    UnloadImage(pending.second);
+  }
+  atlasPendingImages_.clear();
+  atlasPlacements_.clear();
+  atlasPageSizes_.clear();
+  atlasPacked_ = false;
+  atlasNextPage_ = 0;
+  atlasStepsDone_ = 0;
+  textureAtlasRegions_.clear();
+  textureAtlases_.clear();
 
   textures_.clear();
+  textureResidency_.Clear();
 
   if (imGuiInitialized_) {
     rlImGuiShutdown();
@@ -103,20 +143,6 @@ void BaseSystemAPI::Shutdown() {
     mainRenderTexture_ = {0};
   }
 
-  for (auto &pair : playingSounds_) {
-    Sound *sound = pair.second;
-    if (sound) {
-      ::StopSound(*sound);
-    }
-  }
-  playingSounds_.clear();
-
-  if (currentMusic_ != nullptr) {
-    ::StopMusicStream(*currentMusic_);
-  }
-  currentMusic_ = nullptr;
-  currentMusicName_.clear();
-
   CloseAudioDevice();
 
   if (IsWindowReady()) {
@@ -167,7 +193,71 @@ void BaseSystemAPI::RecreateRenderTexture() {
 }
 
 Font *BaseSystemAPI::GetDefaultFontInternal() const {
-  return defaultFont_.get();
+  return defaultFont_ ? &defaultFont_->GetFont() : nullptr;
+}
+
+GlyphCache *BaseSystemAPI::FindGlyphCache(const Font &font) const {
+  for (const auto &entry : fonts_) {
+    const Font &cached = entry.second->GetFont();
+    // 値コピーされた Font でも同じアトラスを指していれば同一とみなす
+    if (&cached == &font ||
+        (font.texture.id != 0 && cached.texture.id == font.texture.id)) {
+      return entry.second.get();
+    }
+  }
+  return nullptr;
+}
+
+Font *BaseSystemAPI::PrepareFontText(Font *font, const std::string &text) {
+  if (!font) {
+    return nullptr;
+  }
+  GlyphCache *cache = FindGlyphCache(*font);
+  if (!cache) {
+    return font;
+  }
+  cache->EnsureText(text);
+  return &cache->GetFont();
+}
+
+const TextLayout &BaseSystemAPI::LayoutFontText(Font *font,
+                                                const std::string &text,
+                                                float fontSize, float spacing,
+                                                float wrapWidth,
+                                                Font &drawFont) {
+  GlyphCache *cache = font ? FindGlyphCache(*font) : nullptr;
+  // キャッシュ外のフォントは Font のアドレスで区別（nullptr は raylib 既定フォント）
+  const void *fontKey = cache ? static_cast<const void *>(cache)
+                              : static_cast<const void *>(font);
+  auto resolve = [cache, font]() {
+    return cache ? cache->GetFont() : (font ? *font : GetFontDefault());
+  };
+
+  if (const TextLayout *hit = textLayoutCache_.Find(fontKey, text, fontSize,
+                                                    spacing, wrapWidth)) {
+    // ヒット時は UTF-8 をデコードせず、重複なしのグリフ一覧だけを確認する
+    if (cache) {
+      cache->EnsureCodepoints(hit->glyphs.data(),
+                              static_cast<int>(hit->glyphs.size()));
+    }
+    drawFont = resolve();
+    return *hit;
+  }
+
+  if (cache) {
+    cache->EnsureText(text);
+  }
+  drawFont = resolve();
+  return textLayoutCache_.Get(fontKey, drawFont, text, fontSize, spacing,
+                              wrapWidth);
+}
+
+Font BaseSystemAPI::ResolveDrawFont(Font *font) const {
+  if (!font) {
+    return GetFontDefault();
+  }
+  GlyphCache *cache = FindGlyphCache(*font);
+  return cache ? cache->GetFont() : *font;
 }
 } // namespace core
 } // namespace game
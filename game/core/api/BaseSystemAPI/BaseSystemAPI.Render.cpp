@@ -1,5 +1,6 @@
 #include "../RenderSystemAPI.hpp"
 #include "../BaseSystemAPI.hpp"
+#include "../GlyphCache.hpp"
 
 // 標準ライブラリ
 #include <algorithm>
@@ -7,6 +8,7 @@
 
 // 外部ライブラリ
 #include <rlImGui.h>
+#include <rlgl.h>
 
 // Project
 #include "../../../utils/Log.h"
@@ -23,6 +25,17 @@ std::vector<Vector2> ToRaylibPoints(const std::vector<Vec2>& points) {
   }
   return out;
 }
+
+void DrawLayoutCodepoints(const Font &font, const TextLayout &layout,
+                          size_t first, size_t count, Vector2 position,
+                          Color color) {
+  if (count == 0) {
+    return;
+  }
+  ::DrawTextCodepoints(font, layout.codepoints.data() + first,
+                       static_cast<int>(count), position, layout.fontSize,
+                       layout.spacing, color);
+}
 } // namespace
 
 RenderSystemAPI::RenderSystemAPI(BaseSystemAPI* owner) : owner_(owner) {}
@@ -91,7 +104,27 @@ void RenderSystemAPI::BeginRenderEx(bool clearBackground) {
   }
 }
 
-void RenderSystemAPI::EndRender() { EndTextureMode(); }
+void RenderSystemAPI::EndRender() {
+  // 描画先を閉じる前に積み残しを吐き出す
+  FlushSpriteBatch();
+  EndTextureMode();
+}
+
+void RenderSystemAPI::BeginRenderTarget(const RenderTexture2D& target,
+                                        bool clearBackground) {
+  FlushSpriteBatch();
+  EndTextureMode();
+  BeginTextureMode(target);
+  if (clearBackground) {
+    ClearBackground(WHITE);
+  }
+}
+
+void RenderSystemAPI::EndRenderTarget() {
+  FlushSpriteBatch();
+  EndTextureMode();
+  BeginTextureMode(owner_->mainRenderTexture_);
+}
 
 void RenderSystemAPI::EndFrame(ImGuiRenderCallback imGuiCallback) {
   BeginDrawing();
@@ -140,6 +173,137 @@ void RenderSystemAPI::EndFrame(ImGuiRenderCallback imGuiCallback) {
   }
 
   EndDrawing();
+
+  for (auto &entry : owner_->fonts_) {
+    entry.second->AdvanceFrame();
+  }
+  owner_->textureResidency_.AdvanceFrame();
+
+  owner_->spriteBatchLastFrameStats_ = owner_->spriteBatchFrameStats_;
+  owner_->spriteBatchFrameStats_ = SpriteBatchStats{};
+}
+
+// ===== Render: Sprite batch =====
+
+void RenderSystemAPI::BeginSpriteBatch() {
+  if (owner_->spriteBatchActive_) {
+    FlushSpriteBatch();
+  }
+  owner_->spriteBatchItems_.clear();
+  owner_->spriteBatchActive_ = true;
+}
+
+void RenderSystemAPI::SubmitSprite(const Texture2D &texture, Rectangle source,
+                                   Rectangle dest, Vector2 origin,
+                                   float rotation, Color tint, int layer) {
+  if (!owner_->spriteBatchActive_) {
+    // バッチ外から呼ばれた場合は即時描画
+    ::DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    return;
+  }
+  if (texture.id == 0) {
+    return;
+  }
+
+  SpriteBatchItem item;
+  item.texture = texture;
+  item.source = source;
+  item.dest = dest;
+  item.origin = origin;
+  item.rotation = rotation;
+  item.tint = tint;
+  item.layer = layer;
+  item.order = static_cast<uint32_t>(owner_->spriteBatchItems_.size());
+  owner_->spriteBatchItems_.push_back(item);
+}
+
+void RenderSystemAPI::FlushSpriteBatch() {
+  if (!owner_->spriteBatchActive_) {
+    return;
+  }
+  owner_->spriteBatchActive_ = false;
+
+  auto &items = owner_->spriteBatchItems_;
+  if (items.empty()) {
+    return;
+  }
+
+  // 同一 layer 内は投入順を保つ（テクスチャ順に並べ替えると重なったユニットの前後が入れ替わる）。
+  // 連続する同一テクスチャは raylib 側で1回のドローコールにまとまる。
+  std::sort(items.begin(), items.end(),
+            [](const SpriteBatchItem &a, const SpriteBatchItem &b) {
+              if (a.layer != b.layer) {
+                return a.layer < b.layer;
+              }
+              return a.order < b.order;
+            });
+
+  auto &stats = owner_->spriteBatchFrameStats_;
+  unsigned int currentTexture = 0;
+  for (const auto &item : items) {
+    if (item.texture.id != currentTexture) {
+      if (currentTexture != 0) {
+        stats.textureSwitches++;
+      }
+      stats.drawCalls++;
+      currentTexture = item.texture.id;
+    }
+    ::DrawTexturePro(item.texture, item.source, item.dest, item.origin,
+                     item.rotation, item.tint);
+  }
+  stats.quads += static_cast<int>(items.size());
+  items.clear();
+}
+
+bool RenderSystemAPI::IsSpriteBatchActive() const {
+  return owner_->spriteBatchActive_;
+}
+
+const RenderSystemAPI::SpriteBatchStats &
+RenderSystemAPI::GetSpriteBatchStats() const {
+  return owner_->spriteBatchLastFrameStats_;
+}
+
+// ===== Render: Particles =====
+
+void RenderSystemAPI::DrawParticleQuads(const float *x, const float *y,
+                                        const float *size, const float *alpha,
+                                        const Color *color, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  // 積み残しのスプライトを先に描き、前後関係を保つ
+  FlushSpriteBatch();
+
+  const Texture2D shapes = ::GetShapesTexture();
+  const Rectangle rec = ::GetShapesTextureRectangle();
+  const float u0 = rec.x / static_cast<float>(shapes.width);
+  const float v0 = rec.y / static_cast<float>(shapes.height);
+  const float u1 = (rec.x + rec.width) / static_cast<float>(shapes.width);
+  const float v1 = (rec.y + rec.height) / static_cast<float>(shapes.height);
+
+  rlSetTexture(shapes.id);
+  rlBegin(RL_QUADS);
+  rlNormal3f(0.0f, 0.0f, 1.0f);
+  for (size_t i = 0; i < count; ++i) {
+    const float half = size[i] * 0.5f;
+    const float left = x[i] - half;
+    const float top = y[i] - half;
+    const float right = x[i] + half;
+    const float bottom = y[i] + half;
+    rlColor4ub(color[i].r, color[i].g, color[i].b,
+               static_cast<unsigned char>(static_cast<float>(color[i].a) * alpha[i]));
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(left, top);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(left, bottom);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(right, bottom);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(right, top);
+  }
+  rlEnd();
+  rlSetTexture(0);
 }
 
 // ===== Render: ImGui =====
@@ -222,12 +386,8 @@ void RenderSystemAPI::DrawTextRaylibEx(const std::string &text, Vec2 position,
 
 void RenderSystemAPI::DrawTextDefault(const std::string &text, float x, float y,
                                     float fontSize, Color color) {
-  Font *font = owner_->GetDefaultFontInternal();
-  if (font) {
-    ::DrawTextEx(*font, text.c_str(), {x, y}, fontSize, 1.0f, color);
-  } else {
-    ::DrawTextEx(GetFontDefault(), text.c_str(), {x, y}, fontSize, 1.0f, color);
-  }
+  DrawTextWithFontEx(owner_->GetDefaultFontInternal(), text, {x, y}, fontSize,
+                     1.0f, color);
 }
 
 void RenderSystemAPI::DrawTextDefault(const std::string &text, float x, float y,
@@ -238,13 +398,8 @@ void RenderSystemAPI::DrawTextDefault(const std::string &text, float x, float y,
 void RenderSystemAPI::DrawTextDefaultEx(const std::string &text, Vector2 position,
                                       float fontSize, float spacing,
                                       Color color) {
-  Font *font = owner_->GetDefaultFontInternal();
-  if (font) {
-    ::DrawTextEx(*font, text.c_str(), position, fontSize, spacing, color);
-  } else {
-    ::DrawTextEx(GetFontDefault(), text.c_str(), position, fontSize, spacing,
-                 color);
-  }
+  DrawTextWithFontEx(owner_->GetDefaultFontInternal(), text, position,
+                     fontSize, spacing, color);
 }
 
 void RenderSystemAPI::DrawTextDefaultEx(const std::string &text, Vec2 position,
@@ -257,11 +412,7 @@ void RenderSystemAPI::DrawTextDefaultEx(const std::string &text, Vec2 position,
 void RenderSystemAPI::DrawTextWithFont(Font *font, const std::string &text,
                                      float x, float y, float fontSize,
                                      Color color) {
-  if (font) {
-    ::DrawTextEx(*font, text.c_str(), {x, y}, fontSize, 1.0f, color);
-  } else {
-    ::DrawTextEx(GetFontDefault(), text.c_str(), {x, y}, fontSize, 1.0f, color);
-  }
+  DrawTextWithFontEx(font, text, {x, y}, fontSize, 1.0f, color);
 }
 
 void RenderSystemAPI::DrawTextWithFont(Font *font, const std::string &text,
@@ -273,12 +424,11 @@ void RenderSystemAPI::DrawTextWithFont(Font *font, const std::string &text,
 void RenderSystemAPI::DrawTextWithFontEx(Font *font, const std::string &text,
                                        Vector2 position, float fontSize,
                                        float spacing, Color color) {
-  if (font) {
-    ::DrawTextEx(*font, text.c_str(), position, fontSize, spacing, color);
-  } else {
-    ::DrawTextEx(GetFontDefault(), text.c_str(), position, fontSize, spacing,
-                 color);
-  }
+  Font drawFont{};
+  const TextLayout &layout =
+      owner_->LayoutFontText(font, text, fontSize, spacing, 0.0f, drawFont);
+  DrawLayoutCodepoints(drawFont, layout, 0, layout.codepoints.size(), position,
+                       color);
 }
 
 void RenderSystemAPI::DrawTextWithFontEx(Font *font, const std::string &text,
@@ -290,12 +440,8 @@ void RenderSystemAPI::DrawTextWithFontEx(Font *font, const std::string &text,
 
 Vector2 RenderSystemAPI::MeasureTextDefault(const std::string &text,
                                           float fontSize, float spacing) const {
-  Font *font = owner_->GetDefaultFontInternal();
-  if (font) {
-    return ::MeasureTextEx(*font, text.c_str(), fontSize, spacing);
-  } else {
-    return ::MeasureTextEx(GetFontDefault(), text.c_str(), fontSize, spacing);
-  }
+  return MeasureTextWithFont(owner_->GetDefaultFontInternal(), text, fontSize,
+                             spacing);
 }
 
 Vec2 RenderSystemAPI::MeasureTextDefaultCore(const std::string &text,
@@ -307,11 +453,9 @@ Vec2 RenderSystemAPI::MeasureTextDefaultCore(const std::string &text,
 Vector2 RenderSystemAPI::MeasureTextWithFont(Font *font, const std::string &text,
                                            float fontSize,
                                            float spacing) const {
-  if (font) {
-    return ::MeasureTextEx(*font, text.c_str(), fontSize, spacing);
-  } else {
-    return ::MeasureTextEx(GetFontDefault(), text.c_str(), fontSize, spacing);
-  }
+  Font drawFont{};
+  return owner_->LayoutFontText(font, text, fontSize, spacing, 0.0f, drawFont)
+      .size;
 }
 
 Vec2 RenderSystemAPI::MeasureTextWithFontCore(Font *font,
@@ -321,6 +465,55 @@ Vec2 RenderSystemAPI::MeasureTextWithFontCore(Font *font,
   return ToCoreVec2(MeasureTextWithFont(font, text, fontSize, spacing));
 }
 
+const TextLayout &RenderSystemAPI::LayoutTextDefault(const std::string &text,
+                                                     float fontSize,
+                                                     float spacing,
+                                                     float wrapWidth) {
+  return LayoutTextWithFont(owner_->GetDefaultFontInternal(), text, fontSize,
+                            spacing, wrapWidth);
+}
+
+const TextLayout &RenderSystemAPI::LayoutTextWithFont(Font *font,
+                                                      const std::string &text,
+                                                      float fontSize,
+                                                      float spacing,
+                                                      float wrapWidth) {
+  Font drawFont{};
+  return owner_->LayoutFontText(font, text, fontSize, spacing, wrapWidth,
+                                drawFont);
+}
+
+void RenderSystemAPI::DrawTextLayoutLineDefault(const TextLayout &layout,
+                                              size_t lineIndex,
+                                              Vector2 position, Color color) {
+  DrawTextLayoutLineWithFont(owner_->GetDefaultFontInternal(), layout,
+                             lineIndex, position, color);
+}
+
+void RenderSystemAPI::DrawTextLayoutLineDefault(const TextLayout &layout,
+                                              size_t lineIndex, Vec2 position,
+                                              ColorRGBA color) {
+  DrawTextLayoutLineDefault(layout, lineIndex, ToRaylibVec2(position),
+                            ToRaylibColor(color));
+}
+
+void RenderSystemAPI::DrawTextLayoutLineWithFont(Font *font,
+                                               const TextLayout &layout,
+                                               size_t lineIndex,
+                                               Vector2 position, Color color) {
+  if (lineIndex >= layout.lines.size()) {
+    return;
+  }
+  // グリフはレイアウト取得時（LayoutText*）に用意済み
+  const TextLayout::Line &line = layout.lines[lineIndex];
+  DrawLayoutCodepoints(owner_->ResolveDrawFont(font), layout, line.first,
+                       line.count, position, color);
+}
+
+TextLayoutCache::Stats RenderSystemAPI::GetTextLayoutStats() const {
+  return owner_->textLayoutCache_.GetStats();
+}
+
 // ===== Render: Basic Shapes =====
 
 void RenderSystemAPI::DrawRectangle(float x, float y, float width, float height,
@@ -920,6 +1113,9 @@ void RenderSystemAPI::DrawTextPro(Font font, const std::string &text,
                                 Vector2 position, Vector2 origin,
                                 float rotation, float fontSize, float spacing,
                                 Color tint) {
+  if (Font *prepared = owner_->PrepareFontText(&font, text)) {
+    font = *prepared;
+  }
   ::DrawTextPro(font, text.c_str(), position, origin, rotation, fontSize,
                 spacing, tint);
 }
@@ -935,6 +1131,10 @@ void RenderSystemAPI::DrawTextPro(Font font, const std::string &text,
 void RenderSystemAPI::DrawTextCodepoint(Font font, int codepoint,
                                       Vector2 position, float fontSize,
                                       Color tint) {
+  if (GlyphCache *cache = owner_->FindGlyphCache(font)) {
+    cache->EnsureCodepoints(&codepoint, 1);
+    font = cache->GetFont();
+  }
   ::DrawTextCodepoint(font, codepoint, position, fontSize, tint);
 }
 
@@ -949,6 +1149,10 @@ void RenderSystemAPI::DrawTextCodepoints(Font font, const int *codepoints,
                                        int codepointCount, Vector2 position,
                                        float fontSize, float spacing,
                                        Color tint) {
+  if (GlyphCache *cache = owner_->FindGlyphCache(font)) {
+    cache->EnsureCodepoints(codepoints, codepointCount);
+    font = cache->GetFont();
+  }
   ::DrawTextCodepoints(font, codepoints, codepointCount, position, fontSize,
                        spacing, tint);
 }
@@ -4,20 +4,34 @@
 // Standard library
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <unordered_set>
 #include <vector>
 
 // External libraries
 #include <imgui.h>
+#include <nlohmann/json.hpp>
 #include <rlImGui.h>
 
 // Project
 #include "../../../utils/Log.h"
+#include "../GlyphCache.hpp"
+#include "../ResourceDecodeQueue.hpp"
+#include "../TextureAtlasPacker.hpp"
+#include "../../system/Profiler.hpp"
 
 namespace game {
 namespace core {
 namespace {
+// 動的グリフアトラスの設定（セル = 48px + 余白で 2048px なら約1500グリフ）
+constexpr int FONT_GLYPH_BASE_SIZE = 48;
+constexpr int FONT_ATLAS_INITIAL_SIZE = 1024;
+constexpr int FONT_ATLAS_MAX_SIZE = 2048;
+constexpr float FONT_PREWARM_FILL_RATIO = 0.5f;
+
 std::string NormalizeSlashes(std::string s) {
   std::replace(s.begin(), s.end(), '\\', '/');
   return s;
@@ -110,36 +124,25 @@ void *ResourceSystemAPI::GetTexture(const std::string &name) {
 
   auto it = owner_->textures_.find(key);
   if (it != owner_->textures_.end()) {
+    // 予算超過で退避されていればここで読み直す（ポインタは変わらない）
+    owner_->textureResidency_.Use(it->second.get());
     return it->second.get();
   }
 
-  std::string path;
-  if (key.length() >= 7 && key.substr(0, 7) == "assets/") {
-    path = "data/" + key;
-  } else {
-    path = "data/assets/textures/" + key;
-  }
-  if (path.length() < 4 || path.substr(path.length() - 4) != ".png") {
-    path += ".png";
-  }
-
-  Texture2D texture = ::LoadTexture(path.c_str());
-
-  if (texture.id == 0) {
+  const std::string path = owner_->ResolveTexturePath(key);
+  std::shared_ptr<Texture2D> texturePtr = owner_->textureResidency_.Load(path);
+  if (!texturePtr) {
     LOG_WARN("Failed to load texture: {}, creating placeholder", path);
-    texture = CreatePlaceholderTexture(name);
-  } else {
-    LOG_INFO("Loaded texture: {}", path);
+    const Texture2D texture = CreatePlaceholderTexture(name);
+    texturePtr =
+        std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
+          if (t && t->id != 0) {
+            UnloadTexture(*t);
+          }
+          delete t;
+        });
   }
 
-  auto texturePtr =
-      std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
-        if (t && t->id != 0) {
-          UnloadTexture(*t);
-        }
-        delete t;
-      });
-
   owner_->textures_[key] = texturePtr;
   return texturePtr.get();
 }
@@ -172,6 +175,283 @@ const std::vector<AssetLicenseEntry> &ResourceSystemAPI::GetAssetLicenses()
   return owner_->assetLicenses_;
 }
 
+TextureHandle ResourceSystemAPI::ResolveTextureHandle(const std::string &name) {
+  if (name.empty()) {
+    return INVALID_TEXTURE_HANDLE;
+  }
+
+  // 呼び出し元の生の名前で引ければ正規化を省略
+  auto it = owner_->textureHandleByName_.find(name);
+  if (it != owner_->textureHandleByName_.end()) {
+    return it->second;
+  }
+
+  const std::string key = NormalizeTextureKey(name);
+  TextureHandle handle = INVALID_TEXTURE_HANDLE;
+  auto keyIt = owner_->textureHandleByName_.find(key);
+  if (keyIt != owner_->textureHandleByName_.end()) {
+    handle = keyIt->second;
+  } else {
+    if (owner_->textureHandleKeys_.empty()) {
+      owner_->textureHandleKeys_.emplace_back();
+      owner_->textureHandleTable_.push_back(nullptr);
+      owner_->textureHandleRegions_.emplace_back();
+      owner_->textureHandleResidency_.push_back(TextureResidency::NO_ENTRY);
+    }
+    handle = static_cast<TextureHandle>(owner_->textureHandleKeys_.size());
+    owner_->textureHandleKeys_.push_back(key);
+    owner_->textureHandleTable_.push_back(nullptr);
+    owner_->textureHandleRegions_.emplace_back();
+    owner_->textureHandleResidency_.push_back(TextureResidency::NO_ENTRY);
+    owner_->textureHandleByName_.emplace(key, handle);
+  }
+  owner_->textureHandleByName_.emplace(name, handle);
+  return handle;
+}
+
+Texture2D *ResourceSystemAPI::GetTextureByHandle(TextureHandle handle) {
+  if (handle == INVALID_TEXTURE_HANDLE ||
+      handle >= owner_->textureHandleTable_.size()) {
+    return nullptr;
+  }
+  Texture2D *&slot = owner_->textureHandleTable_[handle];
+  uint32_t &residency = owner_->textureHandleResidency_[handle];
+  if (!slot) {
+    // textures_ のエントリは置き換えられないため、ポインタはキャッシュ破棄まで有効
+    slot = static_cast<Texture2D *>(GetTexture(owner_->textureHandleKeys_[handle]));
+    residency = owner_->textureResidency_.Find(slot);
+  } else if (residency != TextureResidency::NO_ENTRY) {
+    owner_->textureResidency_.Use(residency);
+  }
+  return slot;
+}
+
+const std::string &
+ResourceSystemAPI::GetTextureHandleKey(TextureHandle handle) const {
+  static const std::string kEmpty;
+  if (handle >= owner_->textureHandleKeys_.size()) {
+    return kEmpty;
+  }
+  return owner_->textureHandleKeys_[handle];
+}
+
+TextureRegion ResourceSystemAPI::GetTextureRegion(const std::string &name) {
+  const std::string key = NormalizeTextureKey(name);
+  auto it = owner_->textureAtlasRegions_.find(key);
+  if (it != owner_->textureAtlasRegions_.end()) {
+    return it->second;
+  }
+
+  TextureRegion region;
+  region.texture = static_cast<Texture2D *>(GetTexture(key));
+  if (region.texture) {
+    region.rect = Rectangle{0.0f, 0.0f, static_cast<float>(region.texture->width),
+                            static_cast<float>(region.texture->height)};
+  }
+  return region;
+}
+
+TextureRegion ResourceSystemAPI::GetTextureRegionByHandle(TextureHandle handle) {
+  if (handle == INVALID_TEXTURE_HANDLE ||
+      handle >= owner_->textureHandleRegions_.size()) {
+    return TextureRegion{};
+  }
+  TextureRegion &slot = owner_->textureHandleRegions_[handle];
+  uint32_t &residency = owner_->textureHandleResidency_[handle];
+  if (!slot.texture) {
+    slot = GetTextureRegion(owner_->textureHandleKeys_[handle]);
+    residency = owner_->textureResidency_.Find(slot.texture);
+  } else if (residency != TextureResidency::NO_ENTRY) {
+    owner_->textureResidency_.Use(residency);
+  }
+  return slot;
+}
+
+size_t ResourceSystemAPI::GetTextureAtlasCount() const {
+  return owner_->textureAtlases_.size();
+}
+
+void ResourceSystemAPI::PreloadTextureSet(
+    const std::string &setName, const std::vector<std::string> &textureKeys) {
+  std::vector<std::string> paths;
+  paths.reserve(textureKeys.size());
+  for (const auto &name : textureKeys) {
+    if (name.empty()) {
+      continue;
+    }
+    GetTexture(name);
+    std::string path = owner_->ResolveTexturePath(name);
+    if (owner_->textureResidency_.Retain(path)) {
+      paths.push_back(std::move(path));
+    }
+  }
+
+  // 新しいセットを保持してから古いセットを外す（共通のテクスチャを降ろさない）
+  auto &slot = owner_->texturePreloadSets_[setName];
+  for (const auto &path : slot) {
+    owner_->textureResidency_.Release(path);
+  }
+  slot = std::move(paths);
+  LOG_INFO("ResourceSystemAPI: preload set '{}' holds {} texture(s)", setName,
+           slot.size());
+}
+
+void ResourceSystemAPI::ReleaseTextureSet(const std::string &setName) {
+  auto it = owner_->texturePreloadSets_.find(setName);
+  if (it == owner_->texturePreloadSets_.end()) {
+    return;
+  }
+  for (const auto &path : it->second) {
+    owner_->textureResidency_.Release(path);
+  }
+  owner_->texturePreloadSets_.erase(it);
+}
+
+void ResourceSystemAPI::SetTextureBudgetBytes(size_t budgetBytes) {
+  owner_->textureResidency_.SetBudgetBytes(budgetBytes);
+}
+
+TextureResidency::Stats ResourceSystemAPI::GetTextureResidencyStats() const {
+  return owner_->textureResidency_.GetStats();
+}
+
+bool ResourceSystemAPI::HasPendingTextureAtlasWork() const {
+  return !owner_->atlasPendingImages_.empty();
+}
+
+int ResourceSystemAPI::GetTextureAtlasStepTotal() const {
+  if (!HasPendingTextureAtlasWork()) {
+    return owner_->atlasStepsDone_;
+  }
+  // パック + ページ数 + 仕上げ（パック前はページ数が分からないので1ページと見積もる）
+  const size_t pages = owner_->atlasPacked_ ? owner_->atlasPageSizes_.size() : 1;
+  return static_cast<int>(pages) + 2;
+}
+
+void ResourceSystemAPI::ResetTextureAtlasBuild() {
+  for (auto &pending : owner_->atlasPendingImages_) {
+    UnloadImage(pending.second);
+  }
+  owner_->atlasPendingImages_.clear();
+  owner_->atlasPlacements_.clear();
+  owner_->atlasPageSizes_.clear();
+  owner_->atlasPacked_ = false;
+  owner_->atlasNextPage_ = 0;
+  owner_->atlasStepsDone_ = 0;
+}
+
+bool ResourceSystemAPI::BuildNextTextureAtlasStep() {
+  PROFILE_SCOPE("ResourceSystemAPI::BuildNextTextureAtlasStep");
+  auto &pending = owner_->atlasPendingImages_;
+  if (pending.empty()) {
+    return false;
+  }
+
+  constexpr int ATLAS_MAX_SIZE = 4096;
+  constexpr int ATLAS_PADDING = 2;
+
+  owner_->atlasStepsDone_++;
+
+  // 1) 配置の計算のみ
+  if (!owner_->atlasPacked_) {
+    std::vector<TextureAtlasPacker::Input> inputs;
+    inputs.reserve(pending.size());
+    for (const auto &[key, image] : pending) {
+      inputs.push_back({key, image.width, image.height});
+    }
+    TextureAtlasPacker packer(ATLAS_MAX_SIZE, ATLAS_PADDING);
+    owner_->atlasPlacements_ = packer.Pack(inputs);
+    owner_->atlasPageSizes_ = packer.GetPageSizes();
+    owner_->atlasNextPage_ = 0;
+    owner_->atlasPacked_ = true;
+    return true;
+  }
+
+  // 2) 1ステップにつき1ページを合成して転送
+  const auto &placements = owner_->atlasPlacements_;
+  if (owner_->atlasNextPage_ < owner_->atlasPageSizes_.size()) {
+    const int pageIndex = static_cast<int>(owner_->atlasNextPage_++);
+    const auto &size = owner_->atlasPageSizes_[pageIndex];
+    Image page = GenImageColor(size.width, size.height, BLANK);
+    for (size_t i = 0; i < placements.size(); ++i) {
+      const auto &placement = placements[i];
+      if (placement.page != pageIndex) {
+        continue;
+      }
+      Image &image = pending[i].second;
+      ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+      const Rectangle src{0.0f, 0.0f, static_cast<float>(image.width),
+                          static_cast<float>(image.height)};
+      const Rectangle dst{static_cast<float>(placement.x),
+                          static_cast<float>(placement.y),
+                          static_cast<float>(placement.width),
+                          static_cast<float>(placement.height)};
+      ImageDraw(&page, image, src, dst, WHITE);
+    }
+
+    Texture2D texture = LoadTextureFromImage(page);
+    UnloadImage(page);
+    owner_->textureAtlases_.push_back(
+        std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
+          if (t && t->id != 0) {
+            UnloadTexture(*t);
+          }
+          delete t;
+        }));
+
+    Texture2D *atlas = owner_->textureAtlases_.back().get();
+    for (const auto &placement : placements) {
+      if (placement.page != pageIndex) {
+        continue;
+      }
+      TextureRegion region;
+      region.texture = atlas;
+      region.rect = Rectangle{static_cast<float>(placement.x),
+                              static_cast<float>(placement.y),
+                              static_cast<float>(placement.width),
+                              static_cast<float>(placement.height)};
+      owner_->textureAtlasRegions_[placement.key] = region;
+    }
+    return true;
+  }
+
+  // 3) 仕上げ: アトラスに入らなかったものは単体テクスチャとして登録
+  size_t unplaced = 0;
+  for (size_t i = 0; i < placements.size(); ++i) {
+    if (placements[i].page >= 0) {
+      continue;
+    }
+    auto &[key, image] = pending[i];
+    Texture2D texture = LoadTextureFromImage(image);
+    owner_->textures_[key] =
+        std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
+          if (t && t->id != 0) {
+            UnloadTexture(*t);
+          }
+          delete t;
+        });
+    ++unplaced;
+  }
+
+  for (auto &entry : pending) {
+    UnloadImage(entry.second);
+  }
+  LOG_INFO("ResourceSystemAPI: Packed {} sprite sheets into {} atlas page(s) "
+           "({} left standalone)",
+           pending.size() - unplaced, owner_->atlasPageSizes_.size(), unplaced);
+  pending.clear();
+  owner_->atlasPlacements_.clear();
+  owner_->atlasPageSizes_.clear();
+  owner_->atlasPacked_ = false;
+  owner_->atlasNextPage_ = 0;
+
+  // アトラス構築前に解決済みのハンドルは再解決させる
+  for (auto &region : owner_->textureHandleRegions_) {
+    region = TextureRegion{};
+  }
+  return false;
+}
+
 size_t ResourceSystemAPI::GetTextureCacheCount() const {
   return owner_->textures_.size();
 }
@@ -188,6 +468,13 @@ ResourceSystemAPI::GetTextureCacheEntries() const {
       e.id = texPtr->id;
       e.width = texPtr->width;
       e.height = texPtr->height;
+      if (owner_->textureResidency_.Find(texPtr.get()) != TextureResidency::NO_ENTRY) {
+        e.residentBytes = owner_->textureResidency_.GetResidentBytes(texPtr.get());
+        e.refCount = owner_->textureResidency_.GetRefCount(texPtr.get());
+      } else {
+        e.residentBytes = static_cast<size_t>(std::max(0, e.width)) *
+                          static_cast<size_t>(std::max(0, e.height)) * 4u;
+      }
     }
     entries.push_back(std::move(e));
   }
@@ -279,35 +566,34 @@ void *ResourceSystemAPI::GetMusic(const std::string &name) {
 void *ResourceSystemAPI::GetFont(const std::string &name) {
   auto it = owner_->fonts_.find(name);
   if (it != owner_->fonts_.end()) {
-    return it->second.get();
+    return &it->second->GetFont();
   }
 
   std::string path = "data/assets/fonts/" + name;
 
-  Font font = ::LoadFontEx(path.c_str(), 48, owner_->fontCodepoints_.data(),
-                           static_cast<int>(owner_->fontCodepoints_.size()));
-
-  if (font.baseSize == 0) {
+  // 全コードポイントを焼き込まず、ASCII 以外は描画時にラスタライズする
+  const auto start = std::chrono::steady_clock::now();
+  auto cache = std::make_shared<GlyphCache>(FONT_GLYPH_BASE_SIZE,
+                                            FONT_ATLAS_INITIAL_SIZE,
+                                            FONT_ATLAS_MAX_SIZE);
+  if (!cache->LoadFromFile(path)) {
     LOG_ERROR("Failed to load font: {}", path);
     return nullptr;
   }
 
-  LOG_INFO("Loaded font: {}", path);
+  const double elapsedMs = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+  LOG_INFO("Loaded font: {} ({:.1f} ms)", path, elapsedMs);
 
-  auto fontPtr = std::shared_ptr<Font>(new Font(font), [](Font *f) {
-    if (f && f->baseSize != 0) {
-      UnloadFont(*f);
-    }
-    delete f;
-  });
-
-  owner_->fonts_[name] = fontPtr;
-  return fontPtr.get();
+  owner_->fonts_[name] = cache;
+  return &cache->GetFont();
 }
 
 void ResourceSystemAPI::SetDefaultFont(const std::string &name, int fontSize) {
-  if (owner_->defaultFont_ && owner_->fonts_.find(name) != owner_->fonts_.end() &&
-      owner_->defaultFont_ == owner_->fonts_[name]) {
+  auto existing = owner_->fonts_.find(name);
+  if (owner_->defaultFont_ && existing != owner_->fonts_.end() &&
+      owner_->defaultFont_ == existing->second) {
     LOG_DEBUG(
         "ResourceSystemAPI::SetDefaultFont: Font '{}' is already set as default",
         name);
@@ -316,9 +602,9 @@ void ResourceSystemAPI::SetDefaultFont(const std::string &name, int fontSize) {
 
   auto fontPtr = static_cast<Font *>(GetFont(name));
   if (fontPtr && fontPtr->baseSize != 0) {
-    owner_->defaultFont_ = std::static_pointer_cast<Font>(owner_->fonts_[name]);
+    owner_->defaultFont_ = owner_->fonts_[name];
 
-    SetTextureFilter(fontPtr->texture, TEXTURE_FILTER_BILINEAR);
+    owner_->defaultFont_->SetTextureFilter(TEXTURE_FILTER_BILINEAR);
     LOG_INFO(
         "ResourceSystemAPI::SetDefaultFont: Set default font '{}' with size {}",
         name, fontSize);
@@ -376,19 +662,87 @@ void ResourceSystemAPI::SetDefaultFont(const std::string &name, int fontSize) {
 }
 
 void *ResourceSystemAPI::GetDefaultFont() const {
-  return owner_->defaultFont_.get();
+  return owner_->GetDefaultFontInternal();
+}
+
+int ResourceSystemAPI::PrewarmFontGlyphs(const std::string &fontName,
+                                         const std::string &jsonDirectory) {
+  if (!GetFont(fontName)) {
+    return 0;
+  }
+  GlyphCache &cache = *owner_->fonts_[fontName];
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<int> codepoints;
+  std::unordered_set<int> seen;
+  std::function<void(const nlohmann::json &)> collect =
+      [&](const nlohmann::json &value) {
+        if (value.is_string()) {
+          const std::string &text = value.get_ref<const std::string &>();
+          const char *cursor = text.c_str();
+          const char *end = cursor + text.size();
+          while (cursor < end) {
+            int size = 0;
+            const int codepoint = GetCodepointNext(cursor, &size);
+            cursor += (size > 0) ? size : 1;
+            if (codepoint > 0x7E && seen.insert(codepoint).second) {
+              codepoints.push_back(codepoint);
+            }
+          }
+        } else if (value.is_structured()) {
+          for (const auto &child : value) {
+            collect(child);
+          }
+        }
+      };
+
+  try {
+    namespace fs = std::filesystem;
+    if (!fs::exists(jsonDirectory)) {
+      return 0;
+    }
+    for (const auto &file : fs::directory_iterator(jsonDirectory)) {
+      if (!file.is_regular_file() || file.path().extension() != ".json") {
+        continue;
+      }
+      std::ifstream stream(file.path());
+      nlohmann::json root = nlohmann::json::parse(stream, nullptr, false);
+      if (!root.is_discarded()) {
+        collect(root);
+      }
+    }
+  } catch (const std::exception &e) {
+    LOG_WARN("ResourceSystemAPI::PrewarmFontGlyphs: {}", e.what());
+  }
+
+  const int added = cache.Prewarm(codepoints, FONT_PREWARM_FILL_RATIO);
+  const double elapsedMs = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+  LOG_INFO("ResourceSystemAPI::PrewarmFontGlyphs: {} glyphs from {} distinct "
+           "codepoints in {} ({:.1f} ms)",
+           added, codepoints.size(), jsonDirectory, elapsedMs);
+  return added;
+}
+
+GlyphCache::Stats ResourceSystemAPI::GetDefaultFontGlyphStats() const {
+  return owner_->defaultFont_ ? owner_->defaultFont_->GetStats()
+                              : GlyphCache::Stats{};
 }
 
 int ResourceSystemAPI::ScanResourceFiles() {
+  owner_->decodeQueue_.reset();
   owner_->resourceFileList_.clear();
   owner_->currentResourceIndex_ = 0;
+  ResetTextureAtlasBuild();
   owner_->registeredTextureKeys_.clear();
   owner_->assetLicenses_.clear();
 
   try {
     ScanDirectory("data/assets/fonts", ResourceType::Font, {".ttf"});
 
-    ScanDirectory("data/assets/textures", ResourceType::Texture, {".png"});
+    // ステージ背景など大きな単体テクスチャは使う時（またはシーンの先読みセット）まで読み込まない
+    RegisterLazyTextures("data/assets/textures", {".png"});
     ScanDirectoryRecursive("data/assets/characters", ResourceType::Texture,
                            {".png"});
     ScanDirectoryRecursive("data/assets/other", ResourceType::Texture,
@@ -406,6 +760,14 @@ int ResourceSystemAPI::ScanResourceFiles() {
     owner_->scanningCompleted_ = true;
     LOG_INFO("ResourceSystemAPI: Scanned {} resource files",
              owner_->resourceFileList_.size());
+
+#if !defined(EMSCRIPTEN) && !defined(__EMSCRIPTEN__)
+    // 画像/音声のデコードはワーカーで先行させ、LoadNextResource ではアップロードのみ行う
+    if (!owner_->resourceFileList_.empty()) {
+      owner_->decodeQueue_ = std::make_unique<ResourceDecodeQueue>(
+          owner_->resourceFileList_, ResourceDecodeQueue::DefaultThreadCount());
+    }
+#endif
     return static_cast<int>(owner_->resourceFileList_.size());
   } catch (const std::exception &e) {
     LOG_ERROR("ResourceSystemAPI: Error scanning resource files: {}", e.what());
@@ -414,14 +776,36 @@ int ResourceSystemAPI::ScanResourceFiles() {
 }
 
 bool ResourceSystemAPI::LoadNextResource(ProgressCallback callback) {
+  PROFILE_SCOPE("ResourceSystemAPI::LoadNextResource");
   if (owner_->currentResourceIndex_ >= owner_->resourceFileList_.size()) {
-    return false;
+    // 全ファイルの読み込み後、アトラス構築を1ステップずつ進める
+    if (!HasPendingTextureAtlasWork()) {
+      return false;
+    }
+    BuildNextTextureAtlasStep();
+    if (callback) {
+      callback(GetCurrentProgress());
+    }
+    if (!HasPendingTextureAtlasWork()) {
+      LOG_INFO("ResourceSystemAPI: Resource loading completed. textures={}, "
+               "sounds={}, musics={}, fonts={}",
+               owner_->textures_.size(), owner_->sounds_.size(),
+               owner_->musics_.size(), owner_->fonts_.size());
+    }
+    return true;
   }
 
   const auto &fileInfo =
       owner_->resourceFileList_[owner_->currentResourceIndex_];
   std::string message;
 
+  // ワーカーで先行デコード済みならアップロードのみ（未完了ならここで待つ）
+  DecodedResource decoded;
+  if (owner_->decodeQueue_ &&
+      owner_->currentResourceIndex_ < owner_->decodeQueue_->GetFileCount()) {
+    decoded = owner_->decodeQueue_->Take(owner_->currentResourceIndex_);
+  }
+
   try {
     switch (fileInfo.type) {
     case ResourceType::Font:
@@ -429,11 +813,13 @@ bool ResourceSystemAPI::LoadNextResource(ProgressCallback callback) {
       message = "Loading font: " + fileInfo.path;
       break;
     case ResourceType::Texture:
-      LoadTexture(fileInfo.path, fileInfo.name);
+      LoadTexture(fileInfo.path, fileInfo.name,
+                  decoded.hasImage ? &decoded.image : nullptr);
       message = "Loading texture: " + fileInfo.path;
       break;
     case ResourceType::Sound:
-      LoadSound(fileInfo.path, fileInfo.name);
+      LoadSound(fileInfo.path, fileInfo.name,
+                decoded.hasWave ? &decoded.wave : nullptr);
       message = "Loading sound: " + fileInfo.path;
       break;
     case ResourceType::Json:
@@ -447,16 +833,20 @@ bool ResourceSystemAPI::LoadNextResource(ProgressCallback callback) {
     if (callback) {
       LoadProgress progress;
       progress.current = static_cast<int>(owner_->currentResourceIndex_);
-      progress.total = static_cast<int>(owner_->resourceFileList_.size());
+      progress.total = static_cast<int>(owner_->resourceFileList_.size()) +
+                       GetTextureAtlasStepTotal();
       progress.message = message;
       callback(progress);
     }
 
     if (owner_->currentResourceIndex_ >= owner_->resourceFileList_.size()) {
-      LOG_INFO("ResourceSystemAPI: Resource loading completed. textures={}, "
-               "sounds={}, musics={}, fonts={}",
-               owner_->textures_.size(), owner_->sounds_.size(),
-               owner_->musics_.size(), owner_->fonts_.size());
+      owner_->decodeQueue_.reset();
+      if (!HasPendingTextureAtlasWork()) {
+        LOG_INFO("ResourceSystemAPI: Resource loading completed. textures={}, "
+                 "sounds={}, musics={}, fonts={}",
+                 owner_->textures_.size(), owner_->sounds_.size(),
+                 owner_->musics_.size(), owner_->fonts_.size());
+      }
     }
 
     return true;
@@ -469,13 +859,49 @@ bool ResourceSystemAPI::LoadNextResource(ProgressCallback callback) {
 }
 
 bool ResourceSystemAPI::HasMoreResources() const {
-  return owner_->currentResourceIndex_ < owner_->resourceFileList_.size();
+  return owner_->currentResourceIndex_ < owner_->resourceFileList_.size() ||
+         HasPendingTextureAtlasWork();
+}
+
+bool ResourceSystemAPI::IsNextResourceReady() const {
+  if (!HasMoreResources()) {
+    return false;
+  }
+  if (!owner_->decodeQueue_ ||
+      owner_->currentResourceIndex_ >= owner_->decodeQueue_->GetFileCount()) {
+    return true;
+  }
+  return owner_->decodeQueue_->IsReady(owner_->currentResourceIndex_);
+}
+
+int ResourceSystemAPI::LoadReadyResources(double timeBudgetSeconds,
+                                          ProgressCallback callback) {
+  const auto start = std::chrono::steady_clock::now();
+  int loaded = 0;
+  while (HasMoreResources()) {
+    if (loaded > 0) {
+      const double elapsed = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+      if (elapsed >= timeBudgetSeconds) {
+        break;
+      }
+    }
+    // デコード待ちでフレームを止めない（ワーカーが無い場合は1件ずつ同期で進める）
+    if (!IsNextResourceReady()) {
+      break;
+    }
+    LoadNextResource(callback);
+    ++loaded;
+  }
+  return loaded;
 }
 
 LoadProgress ResourceSystemAPI::GetCurrentProgress() const {
   LoadProgress progress;
   progress.current = static_cast<int>(owner_->currentResourceIndex_);
-  progress.total = static_cast<int>(owner_->resourceFileList_.size());
+  progress.total = static_cast<int>(owner_->resourceFileList_.size()) +
+                   GetTextureAtlasStepTotal();
   std::string message;
 
   if (owner_->currentResourceIndex_ < owner_->resourceFileList_.size()) {
@@ -496,7 +922,11 @@ LoadProgress ResourceSystemAPI::GetCurrentProgress() const {
       break;
     }
     progress.message = message;
+  } else if (HasPendingTextureAtlasWork()) {
+    progress.current += owner_->atlasStepsDone_;
+    progress.message = "Building texture atlas";
   } else {
+    progress.current += owner_->atlasStepsDone_;
     progress.message = "Resource loading completed";
   }
 
@@ -504,8 +934,10 @@ LoadProgress ResourceSystemAPI::GetCurrentProgress() const {
 }
 
 void ResourceSystemAPI::ResetLoadingState() {
+  owner_->decodeQueue_.reset();
   owner_->resourceFileList_.clear();
   owner_->currentResourceIndex_ = 0;
+  ResetTextureAtlasBuild();
   owner_->scanningCompleted_ = false;
 }
 
@@ -581,6 +1013,31 @@ void ResourceSystemAPI::ScanDirectoryRecursive(
   }
 }
 
+void ResourceSystemAPI::RegisterLazyTextures(
+    const std::string &dirPath, const std::vector<std::string> &extensions) {
+  if (!std::filesystem::exists(dirPath)) {
+    return;
+  }
+
+  try {
+    for (const auto &entry : std::filesystem::directory_iterator(dirPath)) {
+      if (!entry.is_regular_file()) {
+        continue;
+      }
+      const std::string ext = ToLower(entry.path().extension().string());
+      if (std::find(extensions.begin(), extensions.end(), ext) ==
+          extensions.end()) {
+        continue;
+      }
+      owner_->registeredTextureKeys_.insert(
+          NormalizeTextureKey(MakeAssetsRelativeKey(entry.path())));
+    }
+  } catch (const std::exception &e) {
+    LOG_WARN("ResourceSystemAPI: Error scanning directory {}: {}", dirPath,
+             e.what());
+  }
+}
+
 void ResourceSystemAPI::LoadFont(const std::string &path, const std::string &name) {
   LOG_DEBUG("Font loaded: {}", path);
 }
@@ -650,28 +1107,57 @@ void ResourceSystemAPI::ScanAssetLicenses() {
 }
 
 void ResourceSystemAPI::LoadTexture(const std::string &path,
-                                const std::string &name) {
+                                const std::string &name, Image *decoded) {
   const std::string key = NormalizeTextureKey(name);
 
+  // 先行デコード済みの画像は、使わなかった場合もここで解放する
+  auto releaseDecoded = [&]() {
+    if (decoded && decoded->data) {
+      UnloadImage(*decoded);
+      decoded->data = nullptr;
+    }
+  };
+
   if (owner_->textures_.find(key) != owner_->textures_.end()) {
+    releaseDecoded();
     return;
   }
 
-  Texture2D texture = ::LoadTexture(path.c_str());
+  // キャラクターのシートはCPU側で保持し、ロード完了時にアトラスへまとめる
+  if (StartsWith(key, "assets/characters/")) {
+    if (owner_->textureAtlasRegions_.find(key) !=
+        owner_->textureAtlasRegions_.end()) {
+      releaseDecoded();
+      return;
+    }
+    Image image{};
+    if (decoded && decoded->data) {
+      image = *decoded;
+      decoded->data = nullptr;
+    } else {
+      image = ::LoadImage(path.c_str());
+    }
+    if (image.data) {
+      owner_->atlasPendingImages_.emplace_back(key, image);
+      return;
+    }
+  }
 
-  if (texture.id == 0) {
+  std::shared_ptr<Texture2D> texturePtr =
+      owner_->textureResidency_.Load(path, decoded);
+  releaseDecoded();
+  if (!texturePtr) {
     LOG_WARN("Failed to load texture: {}, creating placeholder", path);
-    texture = CreatePlaceholderTexture(name);
+    const Texture2D texture = CreatePlaceholderTexture(name);
+    texturePtr =
+        std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
+          if (t && t->id != 0) {
+            UnloadTexture(*t);
+          }
+          delete t;
+        });
   }
 
-  auto texturePtr =
-      std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
-        if (t && t->id != 0) {
-          UnloadTexture(*t);
-        }
-        delete t;
-      });
-
   owner_->textures_[key] = texturePtr;
 
   if (StartsWith(key, "assets/textures/")) {
@@ -696,11 +1182,20 @@ void ResourceSystemAPI::LoadTexture(const std::string &path,
 }
 
 void ResourceSystemAPI::LoadSound(const std::string &path,
-                              const std::string &name) {
+                              const std::string &name, Wave *decoded) {
   std::string ext = std::filesystem::path(path).extension().string();
   std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
 
+  // 先行デコード済みの波形は、使わなかった場合もここで解放する
+  auto releaseDecoded = [&]() {
+    if (decoded && decoded->data) {
+      UnloadWave(*decoded);
+      decoded->data = nullptr;
+    }
+  };
+
   if (ext == ".mp3") {
+    releaseDecoded();
     if (owner_->musics_.find(name) != owner_->musics_.end()) {
       return;
     }
@@ -721,10 +1216,17 @@ void ResourceSystemAPI::LoadSound(const std::string &path,
     owner_->musics_[name] = musicPtr;
   } else if (ext == ".wav" || ext == ".ogg") {
     if (owner_->sounds_.find(name) != owner_->sounds_.end()) {
+      releaseDecoded();
       return;
     }
 
-    Sound sound = ::LoadSound(path.c_str());
+    Sound sound{};
+    if (decoded && decoded->data) {
+      sound = ::LoadSoundFromWave(*decoded);
+      releaseDecoded();
+    } else {
+      sound = ::LoadSound(path.c_str());
+    }
     if (sound.frameCount == 0) {
       LOG_WARN("Failed to load sound: {}", path);
       return;
@@ -752,59 +1254,6 @@ void ResourceSystemAPI::LoadJson(const std::string &path, const std::string &nam
   LOG_DEBUG("JSON loaded: {}", path);
 }
 
-void BaseSystemAPI::GenerateFontCodepoints() {
-  if (!fontCodepoints_.empty())
-    return;
-
-  // ASCII (0x20 - 0x7E)
-  for (int i = 0x20; i <= 0x7E; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Latin-1 Supplement (U+00A0-U+00FF) - includes ´
-  for (int i = 0x00A0; i <= 0x00FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Greek and Coptic (U+0370-U+03FF) - includes ω
-  for (int i = 0x0370; i <= 0x03FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  for (int i = 0x3000; i <= 0x30FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  for (int i = 0xFF00; i <= 0xFFEF; ++i)
-    fontCodepoints_.push_back(i);
-
-  for (int i = 0x4E00; i <= 0x9FAF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Arrows (U+2190-U+21FF)
-  for (int i = 0x2190; i <= 0x21FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // General Punctuation (U+2000-U+206F)
-  for (int i = 0x2000; i <= 0x206F; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Miscellaneous Symbols (U+2600-U+26FF)
-  for (int i = 0x2600; i <= 0x26FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Dingbats (U+2700-U+27BF)
-  for (int i = 0x2700; i <= 0x27BF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Miscellaneous Symbols and Pictographs (U+1F300-U+1F9FF)
-  for (int i = 0x1F300; i <= 0x1F9FF; ++i)
-    fontCodepoints_.push_back(i);
-
-  // Supplemental Symbols and Pictographs (U+1FA00-U+1FAFF)
-  for (int i = 0x1FA00; i <= 0x1FAFF; ++i)
-    fontCodepoints_.push_back(i);
-
-  LOG_INFO("Generated font codepoints: {} characters (including emoji ranges)",
-           fontCodepoints_.size());
-}
-
 Texture2D ResourceSystemAPI::CreatePlaceholderTexture(const std::string &name) {
   const int size = 64;
   Image image = GenImageColor(size, size, MAGENTA);
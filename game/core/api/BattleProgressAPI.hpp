@@ -1,12 +1,16 @@
 #pragma once
 
 // 標準ライブラリ
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 // プロジェクト内
 #include "../config/BattleSetupData.hpp"
+#include "../game/CombatEventStream.hpp"
+#include "../game/FixedStepClock.hpp"
+#include "../game/LaneSpatialIndex.hpp"
 #include "../game/WaveLoader.hpp"
 
 namespace game {
@@ -47,14 +51,6 @@ public:
         Defeat
     };
 
-    struct AttackLogEntry {
-        float time = 0.0f;
-        std::string attackerId;
-        std::string targetId;
-        int damage = 0;
-        bool hit = false;
-    };
-
     BattleProgressAPI();
     ~BattleProgressAPI() = default;
 
@@ -62,9 +58,23 @@ public:
     void InitializeFromStage();
     void InitializeFromSetupData(const BattleSetupData& data);
 
+    /// @brief 戦闘を deltaTime だけ1回で進める（ヘッドレス実行など固定 dt の呼び出し側向け）
     void Update(float deltaTime);
     void HandleHUDAction(const ui::BattleHUDAction& action);
 
+    // ========== 固定ステップ更新 ==========
+    /// @brief フレーム経過時間（速度倍率込み）を固定ティックへ分割して進める
+    /// @return 実行したティック数（描画側のアニメーション更新量は ticks * GetFixedStep()）
+    int AdvanceFixed(float scaledDeltaTime);
+    /// @brief 固定ティックを1回だけ進める（補間用の前回位置も更新）
+    void StepFixed();
+    /// @brief 描画時に PreviousPosition → Position を補間する係数 [0, 1)
+    float GetInterpolationAlpha() const { return battleClock_.GetAlpha(); }
+    float GetFixedStep() const { return battleClock_.GetStep(); }
+    void SetTickRate(float tickRate) { battleClock_.SetTickRate(tickRate); }
+    void SetMaxSubsteps(int maxSubsteps) { battleClock_.SetMaxSubsteps(maxSubsteps); }
+    const ::game::core::game::FixedStepClock& GetBattleClock() const { return battleClock_; }
+
     // ========== 状態取得 ==========
     const LaneConfig& GetLane() const { return lane_; }
     const TowerState& GetPlayerTower() const { return playerTower_; }
@@ -77,10 +87,14 @@ public:
     bool IsPaused() const { return isPaused_; }
     const std::string& GetGameStateText() const { return gameStateText_; }
     const std::unordered_map<std::string, float>& GetUnitCooldownUntil() const { return unitCooldownUntil_; }
-    const std::vector<AttackLogEntry>& GetAttackLog() const { return attackLog_; }
-    void ClearAttackLog() { attackLog_.clear(); }
-    void SetAttackLogEnabled(bool enabled) { attackLogEnabled_ = enabled; }
-    bool IsAttackLogEnabled() const { return attackLogEnabled_; }
+    /// @brief 攻撃判定イベントのリング（消費側は sequence カーソルを各自で保持する）
+    const ::game::core::game::CombatEventStream& GetCombatEvents() const { return combatEvents_; }
+    void ClearCombatEvents() { combatEvents_.Clear(); }
+    void SetCombatEventsEnabled(bool enabled) { combatEventsEnabled_ = enabled; }
+    bool IsCombatEventsEnabled() const { return combatEventsEnabled_; }
+    /// @brief 勝敗確定時にセーブデータへ反映するか（ヘッドレス実行ではfalse）
+    void SetResultPersistenceEnabled(bool enabled) { resultPersistenceEnabled_ = enabled; }
+    bool IsResultPersistenceEnabled() const { return resultPersistenceEnabled_; }
 
     // ========== 戦闘統計情報 ==========
     struct BattleStats {
@@ -108,6 +122,9 @@ public:
 private:
     void UpdateBattle(float deltaTime);
     void CheckBattleEnd();
+    void SnapshotPreviousPositions();
+    /// @brief BattleTemplate のシート添字からテクスチャハンドルを引く（初回のみパスで解決）
+    uint32_t ResolveSheetHandle(uint32_t sheetId);
 
     SharedContext* sharedContext_;
     ECSystemAPI* ecsAPI_;
@@ -121,6 +138,7 @@ private:
     BattleResult battleResult_;
 
     float battleTime_;
+    ::game::core::game::FixedStepClock battleClock_;
 
     int currentWave_;
     int totalWaves_;
@@ -140,9 +158,15 @@ private:
     std::unordered_map<std::string, float> unitCooldownUntil_;
     std::unordered_map<std::string, std::string> enemyToCharacterId_;
 
+    // 目標検索用のレーン空間インデックス（UpdateBattle毎に再構築）
+    ::game::core::game::LaneSpatialIndex laneIndex_;
+    // BattleTemplate::Sprite::sheetId → テクスチャハンドル（戦闘開始時に破棄）
+    std::vector<uint32_t> sheetHandles_;
+
     bool isInitialized_;
-    bool attackLogEnabled_ = true;
-    std::vector<AttackLogEntry> attackLog_;
+    bool combatEventsEnabled_ = true;
+    bool resultPersistenceEnabled_ = true;
+    ::game::core::game::CombatEventStream combatEvents_;
 
     // 戦闘統計情報
     int spawnedUnitCount_ = 0;
@@ -14,20 +14,71 @@
 #include "../../config/GameState.hpp"
 #include "../../config/SharedContext.hpp"
 #include "../../ecs/defineComponents.hpp"
-#include "../../ecs/entities/CharacterStatCalculator.hpp"
+#include "../../ecs/entities/BattleTemplateTable.hpp"
 #include "../../ecs/entities/EntityCreationData.hpp"
+#include "../../system/Profiler.hpp"
 #include "../../system/TowerEnhancementEffects.hpp"
 #include "../../ui/BattleHUDRenderer.hpp"
 
 namespace game {
 namespace core {
 
+namespace {
+// sheetHandles_ の未解決マーク（0 は「テクスチャなし」として解決済みの値に使う）
+constexpr uint32_t kUnresolvedSheetHandle = 0xFFFFFFFFu;
+} // namespace
+
 void BattleProgressAPI::Update(float deltaTime) {
     battleTime_ += deltaTime;
     UpdateBattle(deltaTime);
     CheckBattleEnd();
 }
 
+int BattleProgressAPI::AdvanceFixed(float scaledDeltaTime) {
+    const int steps = battleClock_.Accumulate(scaledDeltaTime);
+    int executed = 0;
+    while (executed < steps && battleResult_ == BattleResult::InProgress) {
+        StepFixed();
+        ++executed;
+    }
+    return executed;
+}
+
+void BattleProgressAPI::StepFixed() {
+    SnapshotPreviousPositions();
+    Update(battleClock_.GetStep());
+}
+
+void BattleProgressAPI::SnapshotPreviousPositions() {
+    if (!ecsAPI_) {
+        return;
+    }
+    auto view = ecsAPI_->View<ecs::components::Position, ecs::components::PreviousPosition>();
+    for (auto e : view) {
+        const auto& pos = view.get<ecs::components::Position>(e);
+        auto& prev = view.get<ecs::components::PreviousPosition>(e);
+        prev.x = pos.x;
+        prev.y = pos.y;
+    }
+}
+
+uint32_t BattleProgressAPI::ResolveSheetHandle(uint32_t sheetId) {
+    if (sheetId >= sheetHandles_.size()) {
+        sheetHandles_.resize(static_cast<size_t>(sheetId) + 1, kUnresolvedSheetHandle);
+    }
+    uint32_t& handle = sheetHandles_[sheetId];
+    if (handle == kUnresolvedSheetHandle) {
+        handle = 0;
+        if (setupAPI_ && gameplayDataAPI_) {
+            const auto& templates = gameplayDataAPI_->GetBattleTemplates();
+            if (sheetId < templates.GetSheetCount()) {
+                handle = setupAPI_->ResolveTextureHandle(templates.GetSheetPath(sheetId));
+            }
+        }
+    }
+    return handle;
+}
+
 void BattleProgressAPI::HandleHUDAction(const ui::BattleHUDAction& action) {
     using ::game::core::ui::BattleHUDActionType;
 
@@ -49,7 +100,8 @@ void BattleProgressAPI::HandleHUDAction(const ui::BattleHUDAction& action) {
             LOG_WARN("HUD: SpawnUnit ignored (GameplayDataAPI not available)");
             return;
         }
-        auto character = gameplayDataAPI_->GetCharacterTemplate(action.unitId);
+        // マスターは参照で受け取り、出撃毎のディープコピーを避ける
+        const auto* character = gameplayDataAPI_->GetCharacterMaster(action.unitId);
         if (!character) {
             LOG_WARN("HUD: SpawnUnit ignored (character not found): {}", action.unitId);
             return;
@@ -79,27 +131,21 @@ void BattleProgressAPI::HandleHUDAction(const ui::BattleHUDAction& action) {
         Vector2 attackSize = character->attack_size;
         float attackSpan = character->attack_span;
 
-        // セーブロードアウトを適用
+        // セーブロードアウトを適用（キャッシュ済みの最終ステータス）
         if (gameplayDataAPI_) {
-            const auto st = gameplayDataAPI_->GetCharacterState(action.unitId);
-            const auto* itemPassiveManager = gameplayDataAPI_->GetItemPassiveManager();
-            if (itemPassiveManager) {
-                const auto calc = ::game::core::entities::CharacterStatCalculator::Calculate(*character, st, *itemPassiveManager);
-                maxHp = calc.hp.final;
-                atk = calc.attack.final;
-                def = calc.defense.final;
-                moveSpeed = calc.moveSpeed.final;
-                attackSize.x = calc.range.final;
-                attackSpan = calc.attackSpan.final;
+            if (const auto* calc = gameplayDataAPI_->GetEffectiveStats(action.unitId)) {
+                maxHp = calc->hp.final;
+                atk = calc->attack.final;
+                def = calc->defense.final;
+                moveSpeed = calc->moveSpeed.final;
+                attackSize.x = calc->range.final;
+                attackSpan = calc->attackSpan.final;
             }
         }
 
         // タワー強化による味方バフを後乗せ（UIのユニット強化計算とは分離）
         if (gameplayDataAPI_) {
-            const auto te = gameplayDataAPI_->GetTowerEnhancements();
-            const auto attachments = gameplayDataAPI_->GetTowerAttachments();
-            const auto& masters = gameplayDataAPI_->GetAllTowerAttachmentMasters();
-            const auto mul = system::CalculateTowerEnhancementMultipliers(te, attachments, masters);
+            const auto& mul = gameplayDataAPI_->GetTowerEnhancementMultipliers();
             maxHp = std::max(1, static_cast<int>(std::round(static_cast<float>(maxHp) * mul.allyHpMul)));
             atk = std::max(0, static_cast<int>(std::round(static_cast<float>(atk) * mul.allyAttackMul)));
         }
@@ -131,6 +177,7 @@ void BattleProgressAPI::HandleHUDAction(const ui::BattleHUDAction& action) {
 }
 
 void BattleProgressAPI::UpdateBattle(float deltaTime) {
+    PROFILE_SCOPE("BattleProgressAPI::UpdateBattle");
     const float now = battleTime_;
     if (!ecsAPI_ || !setupAPI_) {
         return;
@@ -168,10 +215,7 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
 
     system::TowerEnhancementMultipliers towerMul;
     if (gameplayDataAPI_) {
-        const auto te = gameplayDataAPI_->GetTowerEnhancements();
-        const auto attachments = gameplayDataAPI_->GetTowerAttachments();
-        const auto& masters = gameplayDataAPI_->GetAllTowerAttachmentMasters();
-        towerMul = system::CalculateTowerEnhancementMultipliers(te, attachments, masters);
+        towerMul = gameplayDataAPI_->GetTowerEnhancementMultipliers();
     }
 
     auto spawnFromCharacter = [&](const entities::Character& character,
@@ -234,7 +278,7 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
             continue;
         }
 
-        auto character = gameplayDataAPI_->GetCharacterTemplate(characterId);
+        const auto* character = gameplayDataAPI_->GetCharacterMaster(characterId);
         if (!character) {
             LOG_WARN("Enemy spawn skipped (character not found): {} (enemyId={})", characterId, enemyId);
             continue;
@@ -249,108 +293,92 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
     // 1) 死亡削除
     ecsAPI_->DestroyDeadEntities();
 
-    // 2) 目標検索ヘルパ
-    auto findNearestTarget = [&](entt::entity self, ecs::components::Faction selfFaction) -> entt::entity {
-        const auto* selfPos = ecsAPI_->Try<ecs::components::Position>(self);
-        const auto* selfSprite = ecsAPI_->Try<ecs::components::Sprite>(self);
-        if (!selfPos || !selfSprite) return entt::null;
-
-        const float selfCenter = selfPos->x + static_cast<float>(selfSprite->frame_width) * 0.5f;
-        entt::entity best = entt::null;
-        float bestDist = 1e9f;
-
-        auto view = ecsAPI_->View<ecs::components::Position, ecs::components::Sprite, ecs::components::Team, ecs::components::Health>();
-        for (auto other : view) {
-            if (other == self) continue;
-            const auto& team = view.get<ecs::components::Team>(other);
-            if (team.faction == selfFaction) continue;
-            const auto& op = view.get<ecs::components::Position>(other);
-            const auto& os = view.get<ecs::components::Sprite>(other);
-            const auto& oh = view.get<ecs::components::Health>(other);
-            if (oh.current <= 0) continue;
-
-            const float otherCenter = op.x + static_cast<float>(os.frame_width) * 0.5f;
-            const float dist = std::abs(otherCenter - selfCenter);
-            if (dist < bestDist) {
-                bestDist = dist;
-                best = other;
-            }
-        }
-        return best;
+    // 2) 目標検索ヘルパ（陣営別にソートしたレーンインデックスで O(log N)）
+    // 戦闘ユニットのホットな POD は所有グループが同じ順序で密に並べている（文字列には触れない）
+    auto units = ecsAPI_->BattleUnits();
+    laneIndex_.Clear();
+    for (auto [other, op, os, team, oh, om, ost, oc, ot] : units.each()) {
+        if (oh.current <= 0) continue;
+        laneIndex_.Add(team.faction, other, op.x + static_cast<float>(os.frame_width) * 0.5f);
+    }
+    laneIndex_.Build();
+
+    auto findNearestTarget = [&](float selfCenter, ecs::components::Faction selfFaction) -> entt::entity {
+        const auto targetFaction = (selfFaction == ecs::components::Faction::Player)
+                                       ? ecs::components::Faction::Enemy
+                                       : ecs::components::Faction::Player;
+        // 同フレーム内で撃破された対象は除外（インデックスの全員がグループ内なので Health は必ずある）
+        return laneIndex_.FindNearest(targetFaction, selfCenter, [&](entt::entity other) {
+            return ecsAPI_->Get<ecs::components::Health>(other).current > 0;
+        });
     };
 
     // 3) 移動/攻撃
-    static const std::unordered_map<std::string, entities::Character> kEmptyCharacters;
-    const auto& characterMasters =
-        gameplayDataAPI_ ? gameplayDataAPI_->GetAllCharacterMasters() : kEmptyCharacters;
-    auto findCharacter = [&](const std::string& id) -> const entities::Character* {
-        auto it = characterMasters.find(id);
-        if (it != characterMasters.end()) {
-            return &it->second;
-        }
-        return nullptr;
+    static const entities::BattleTemplateTable kEmptyTemplates;
+    const auto& battleTemplates =
+        gameplayDataAPI_ ? gameplayDataAPI_->GetBattleTemplates() : kEmptyTemplates;
+    auto findTemplate = [&](const ecs::components::TemplateIndex& ref) -> const entities::BattleTemplate* {
+        if (!ref.IsValid() || static_cast<size_t>(ref.index) >= battleTemplates.Size()) {
+            return nullptr;
+        }
+        return &battleTemplates.Get(ref.index);
     };
-    auto setAnimation = [&](entt::entity entity, const entities::Character& ch, bool isAttack) {
-        auto* sprite = ecsAPI_->Try<ecs::components::Sprite>(entity);
+    auto setAnimation = [&](entt::entity entity, ecs::components::Sprite& sprite,
+                            const entities::BattleTemplate& tmpl, bool isAttack) {
         auto* anim = ecsAPI_->Try<ecs::components::Animation>(entity);
-        if (!sprite || !anim) {
+        if (!anim) {
             return;
         }
-        const auto& info = isAttack ? ch.attack_sprite : ch.move_sprite;
-        sprite->sheet_path = info.sheet_path;
-        sprite->frame_width = info.frame_width;
-        sprite->frame_height = info.frame_height;
-        anim->frame_count = std::max(1, info.frame_count);
-        anim->frame_duration = std::max(0.01f, info.frame_duration);
+        const auto& info = isAttack ? tmpl.attackSprite : tmpl.moveSprite;
+        // シートは添字から解決済みハンドルを引くだけ（パス文字列は扱わない）
+        sprite.texture_handle = ResolveSheetHandle(info.sheetId);
+        // コールド側のパスも切り替えておく（描画側のハンドル再解決やエディタ/デバッグ表示が参照する）
+        if (auto* source = ecsAPI_->Try<ecs::components::SpriteSource>(entity);
+            source && gameplayDataAPI_) {
+            const auto& templates = gameplayDataAPI_->GetBattleTemplates();
+            if (info.sheetId < templates.GetSheetCount()) {
+                source->sheet_path = templates.GetSheetPath(info.sheetId);
+            }
+        }
+        sprite.frame_width = info.frameWidth;
+        sprite.frame_height = info.frameHeight;
+        anim->frame_count = info.frameCount;
+        anim->frame_duration = info.frameDuration;
         anim->type = isAttack ? ecs::components::AnimationType::Attack
                               : ecs::components::AnimationType::Move;
         anim->is_looping = !isAttack;
         anim->Reset();
     };
 
-    auto getCharacterId = [&](entt::entity entity) -> std::string {
-        const auto* cid = ecsAPI_->Try<ecs::components::CharacterId>(entity);
-        return cid ? cid->id : "unknown";
-    };
-
-    auto pushAttackLog = [&](const std::string& attackerId,
-                             const std::string& targetId,
-                             int damage,
-                             bool hit) {
-        if (!attackLogEnabled_) {
+    using CombatEventKind = ::game::core::game::CombatEvent::Kind;
+    auto pushCombatEvent = [&](entt::entity attacker,
+                               entt::entity target,
+                               CombatEventKind kind,
+                               int damage,
+                               float x,
+                               float y,
+                               bool lethal = false) {
+        if (!combatEventsEnabled_) {
             return;
         }
-        if (attackLog_.size() >= 200) {
-            attackLog_.erase(attackLog_.begin());
-        }
-        AttackLogEntry entry;
-        entry.time = battleTime_;
-        entry.attackerId = attackerId;
-        entry.targetId = targetId;
-        entry.damage = damage;
-        entry.hit = hit;
-        attackLog_.push_back(entry);
+        ::game::core::game::CombatEvent event;
+        event.time = battleTime_;
+        event.attacker = attacker;
+        event.target = target;
+        event.x = x;
+        event.y = y;
+        event.damage = damage;
+        event.kind = kind;
+        event.lethal = lethal;
+        combatEvents_.Push(event);
     };
 
-    auto units = ecsAPI_->View<ecs::components::Position, ecs::components::Sprite,
-                               ecs::components::Movement, ecs::components::Stats,
-                               ecs::components::Combat, ecs::components::Team>();
-    for (auto e : units) {
-        auto& pos = units.get<ecs::components::Position>(e);
-        const auto& sprite = units.get<ecs::components::Sprite>(e);
-        auto& move = units.get<ecs::components::Movement>(e);
-        const auto& stats = units.get<ecs::components::Stats>(e);
-        auto& combat = units.get<ecs::components::Combat>(e);
-        const auto& team = units.get<ecs::components::Team>(e);
-
+    for (auto [e, pos, sprite, team, health, move, stats, combat, templateRef] : units.each()) {
         const float centerX = pos.x + static_cast<float>(sprite.frame_width) * 0.5f;
         const float atkRange = std::max(10.0f, combat.attack_size.x);
         const float dir = (team.faction == ecs::components::Faction::Player) ? -1.0f : 1.0f;
 
-        const entities::Character* character = nullptr;
-        if (auto* chId = ecsAPI_->Try<ecs::components::CharacterId>(e)) {
-            character = findCharacter(chId->id);
-        }
+        const entities::BattleTemplate* tmpl = findTemplate(templateRef);
 
         // タワー接敵判定
         const bool towerInRange =
@@ -359,7 +387,7 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
                 : (centerX >= playerTower_.x - playerTower_.width * 0.5f - atkRange);
 
         // ユニット接敵
-        entt::entity target = findNearestTarget(e, team.faction);
+        entt::entity target = findNearestTarget(centerX, team.faction);
         float targetDist = 99999.0f;
         if (target != entt::null) {
             const auto& tp = ecsAPI_->Get<ecs::components::Position>(target);
@@ -368,14 +396,13 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
             targetDist = std::abs(tCenter - centerX);
         }
 
-        const std::string attackerId = getCharacterId(e);
         auto startAttack = [&]() {
             combat.is_attacking = true;
             combat.attack_start_time = now;
             combat.attack_hit_fired = false;
             combat.last_attack_time = now;
-            if (character) {
-                setAnimation(e, *character, true);
+            if (tmpl) {
+                setAnimation(e, sprite, *tmpl, true);
             }
         };
 
@@ -391,29 +418,38 @@ void BattleProgressAPI::UpdateBattle(float deltaTime) {
                 if (towerInRange) {
                     if (team.faction == ecs::components::Faction::Player) {
                         const int damage = std::max(1, stats.attack);
+                        const bool wasStanding = enemyTower_.currentHp > 0;
                         enemyTower_.currentHp -= damage;
-                        pushAttackLog(attackerId, "tower_enemy", damage, true);
+                        pushCombatEvent(e, entt::null, CombatEventKind::EnemyTowerHit,
+                                        damage, enemyTower_.x, enemyTower_.y,
+                                        wasStanding && enemyTower_.currentHp <= 0);
                     } else {
                         const int damage = std::max(1, stats.attack);
+                        const bool wasStanding = playerTower_.currentHp > 0;
                         playerTower_.currentHp -= damage;
-                        pushAttackLog(attackerId, "tower_player", damage, true);
+                        pushCombatEvent(e, entt::null, CombatEventKind::PlayerTowerHit,
+                                        damage, playerTower_.x, playerTower_.y,
+                                        wasStanding && playerTower_.currentHp <= 0);
                     }
                 } else if (target != entt::null && targetDist <= atkRange) {
                     auto& th = ecsAPI_->Get<ecs::components::Health>(target);
                     const auto* tstats = ecsAPI_->Try<ecs::components::Stats>(target);
                     const int def = tstats ? tstats->defense : 0;
                     const int dmg = std::max(1, stats.attack - def);
+                    const bool wasAlive = th.current > 0;
                     th.current -= dmg;
-                    pushAttackLog(attackerId, getCharacterId(target), dmg, true);
+                    const auto& tp = ecsAPI_->Get<ecs::components::Position>(target);
+                    pushCombatEvent(e, target, CombatEventKind::UnitHit, dmg, tp.x, tp.y,
+                                    wasAlive && th.current <= 0);
                 } else {
-                    pushAttackLog(attackerId, "none", 0, false);
+                    pushCombatEvent(e, entt::null, CombatEventKind::Miss, 0, pos.x, pos.y);
                 }
             }
             if (elapsed >= combat.attack_duration) {
                 combat.is_attacking = false;
                 combat.attack_hit_fired = false;
-                if (character) {
-                    setAnimation(e, *character, false);
+                if (tmpl) {
+                    setAnimation(e, sprite, *tmpl, false);
                 }
             }
         };
@@ -504,7 +540,7 @@ void BattleProgressAPI::UpdateInfiniteDifficulty(float deltaTime) {
                     continue;
                 }
                 
-                auto character = gameplayDataAPI_->GetCharacterTemplate(characterId);
+                const auto* character = gameplayDataAPI_->GetCharacterMaster(characterId);
                 if (!character) {
                     continue;
                 }
@@ -513,10 +549,7 @@ void BattleProgressAPI::UpdateInfiniteDifficulty(float deltaTime) {
                 
                 system::TowerEnhancementMultipliers towerMul;
                 if (gameplayDataAPI_) {
-                    const auto te = gameplayDataAPI_->GetTowerEnhancements();
-                    const auto attachments = gameplayDataAPI_->GetTowerAttachments();
-                    const auto& masters = gameplayDataAPI_->GetAllTowerAttachmentMasters();
-                    towerMul = system::CalculateTowerEnhancementMultipliers(te, attachments, masters);
+                    towerMul = gameplayDataAPI_->GetTowerEnhancementMultipliers();
                 }
                 
                 entities::EntityCreationData creationData;
@@ -566,7 +599,8 @@ void BattleProgressAPI::CheckBattleEnd() {
         gameStateText_ = "Give Up";
         isPaused_ = true;
         LOG_INFO("Battle finished: Give Up (survival time: {:.1f}s)", survivalTime_);
-        if (gameplayDataAPI_ && sharedContext_ && !sharedContext_->currentStageId.empty()) {
+        if (resultPersistenceEnabled_ && gameplayDataAPI_ && sharedContext_ &&
+            !sharedContext_->currentStageId.empty()) {
             // ギブアップ時の報酬計算
             int rewardGold = CalculateInfiniteReward(survivalTime_, difficultyLevel_);
             BattleStats stats = GetBattleStats();
@@ -593,7 +627,8 @@ void BattleProgressAPI::CheckBattleEnd() {
         gameStateText_ = "Victory";
         isPaused_ = true;
         LOG_INFO("Battle finished: Victory");
-        if (gameplayDataAPI_ && sharedContext_ && !sharedContext_->currentStageId.empty()) {
+        if (resultPersistenceEnabled_ && gameplayDataAPI_ && sharedContext_ &&
+            !sharedContext_->currentStageId.empty()) {
             // 戦闘統計情報を取得して渡す
             BattleStats stats = GetBattleStats();
             gameplayDataAPI_->MarkStageCleared(sharedContext_->currentStageId, 3, &stats);
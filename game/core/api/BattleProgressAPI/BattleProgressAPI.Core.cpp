@@ -81,6 +81,9 @@ void BattleProgressAPI::InitializeFromStage() {
     gameSpeed_ = 1.0f;
     isPaused_ = false;
     unitCooldownUntil_.clear();
+    sheetHandles_.clear();
+    combatEvents_.Clear();
+    battleClock_.Reset();
     
     // 無限ステージ関連の初期化
     isInfinite_ = false;
@@ -239,10 +242,7 @@ void BattleProgressAPI::InitializeFromStage() {
     // - 城HP: 最大値へ乗算（開始時は満タン）
     // - お財布成長/秒、コスト回復/秒: 乗算
     if (gameplayDataAPI_) {
-        const auto te = gameplayDataAPI_->GetTowerEnhancements();
-        const auto attachments = gameplayDataAPI_->GetTowerAttachments();
-        const auto& masters = gameplayDataAPI_->GetAllTowerAttachmentMasters();
-        const auto mul = system::CalculateTowerEnhancementMultipliers(te, attachments, masters);
+        const auto& mul = gameplayDataAPI_->GetTowerEnhancementMultipliers();
 
         playerTower_.maxHp = std::max(
             1, static_cast<int>(std::round(static_cast<float>(playerTower_.maxHp) * mul.playerTowerHpMul)));
@@ -298,6 +298,7 @@ void BattleProgressAPI::InitializeFromSetupData(const BattleSetupData& data) {
     gameSpeed_ = 1.0f;
     isPaused_ = false;
     unitCooldownUntil_.clear();
+    sheetHandles_.clear();
 
     lane_.y = data.lane.y;
     lane_.startX = data.lane.startX;
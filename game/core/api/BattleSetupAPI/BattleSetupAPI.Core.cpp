@@ -151,10 +151,7 @@ BattleSetupData BattleSetupAPI::BuildBattleSetupData(const std::string& stageId,
 
     // タワー強化（セーブ永続）を戦闘へ反映
     if (gameplayDataAPI_) {
-        const auto te = gameplayDataAPI_->GetTowerEnhancements();
-        const auto attachments = gameplayDataAPI_->GetTowerAttachments();
-        const auto& masters = gameplayDataAPI_->GetAllTowerAttachmentMasters();
-        const auto mul = system::CalculateTowerEnhancementMultipliers(te, attachments, masters);
+        const auto& mul = gameplayDataAPI_->GetTowerEnhancementMultipliers();
 
         data.playerTower.maxHp = std::max(
             1, static_cast<int>(std::round(static_cast<float>(data.playerTower.maxHp) * mul.playerTowerHpMul)));
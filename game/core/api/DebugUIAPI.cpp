@@ -4,7 +4,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <vector>
 
 // 外部ライブラリ
 #include <imgui.h>
@@ -14,6 +16,8 @@
 #include "../api/BaseSystemAPI.hpp"
 #include "../api/GameplayDataAPI.hpp"
 #include "../api/InputSystemAPI.hpp"
+#include "../api/SceneOverlayControlAPI.hpp"
+#include "../system/Profiler.hpp"
 #include "../ui/ImGuiSoundHelpers.hpp"
 
 namespace game {
@@ -116,6 +120,10 @@ void DebugUIAPI::Render() {
         RenderCommonPanel(*sharedContext_);
     }
 
+    if (ImGui::CollapsingHeader("Profiler")) {
+        RenderProfilerPanel(*sharedContext_);
+    }
+
     for (const auto& panel : panels_) {
         if (!panel.render) {
             continue;
@@ -138,6 +146,141 @@ void DebugUIAPI::SyncEditFieldsFromSave(const GameplayDataAPI& gameplayDataAPI)
     currencyEditInitialized_ = true;
 }
 
+void DebugUIAPI::RenderProfilerPanel(SharedContext& ctx) {
+#if !GAME_ENABLE_PROFILER
+    (void)ctx;
+    ImGui::TextDisabled("Profiler is compiled out (configure with -DENABLE_PROFILER=ON)");
+#else
+    auto& profiler = Profiler::Instance();
+
+    bool recording = profiler.IsEnabled();
+    if (ui::ImGuiSound::Checkbox(ctx.systemAPI, "Recording##Profiler", &recording)) {
+        profiler.SetEnabled(recording);
+    }
+    ImGui::SameLine();
+    if (ui::ImGuiSound::Button(ctx.systemAPI, "Export Chrome trace##Profiler")) {
+        const std::string path = "profile_trace.json";
+        profilerExportStatus_ = profiler.ExportChromeTrace(path)
+                                    ? "Exported: " + path + " (open in chrome://tracing or Perfetto)"
+                                    : "Export failed: " + path;
+    }
+    if (!profilerExportStatus_.empty()) {
+        ImGui::TextUnformatted(profilerExportStatus_.c_str());
+    }
+
+    // ===== フレーム時間 =====
+    const auto& history = profiler.GetFrameHistory();
+    const size_t historyCount = profiler.GetFrameHistoryCount();
+    std::vector<float> sorted(history.begin(), history.begin() + historyCount);
+    std::sort(sorted.begin(), sorted.end());
+    const float p50 = sorted.empty() ? 0.0f : sorted[sorted.size() / 2];
+    const float p95 = sorted.empty() ? 0.0f : sorted[(sorted.size() * 95) / 100];
+    const float worst = sorted.empty() ? 0.0f : sorted.back();
+    ImGui::Text("frame: %.2f ms  p50=%.2f p95=%.2f max=%.2f (budget 16.67)",
+                profiler.GetLastFrameMs(), p50, p95, worst);
+    const int offset = (historyCount < Profiler::FRAME_HISTORY)
+                           ? 0
+                           : static_cast<int>(profiler.GetFrameHistoryOffset());
+    ImGui::PlotHistogram("##FrameTimes", history.data(), static_cast<int>(historyCount), offset,
+                         "frame ms", 0.0f, std::max(33.4f, worst), ImVec2(-1.0f, 80.0f));
+
+    // ===== 直近フレームのフレームグラフ（メインスレッド） =====
+    const auto& samples = profiler.GetLastFrameSamples();
+    const double frameMs = std::max(0.001, profiler.GetLastFrameMs());
+    const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    uint32_t maxDepth = 0;
+    for (const auto& sample : samples) {
+        maxDepth = std::max(maxDepth, sample.depth);
+    }
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(1.0f, ImGui::GetContentRegionAvail().x);
+    const float height = rowHeight * static_cast<float>(maxDepth + 1);
+    ImGui::InvisibleButton("##FlameView", ImVec2(width, height));
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const int64_t frameStart = profiler.GetLastFrameStartNs();
+    for (const auto& sample : samples) {
+        const double startMs = static_cast<double>(sample.startNs - frameStart) / 1.0e6;
+        const double durationMs = static_cast<double>(sample.durationNs) / 1.0e6;
+        const float x0 = origin.x + static_cast<float>(startMs / frameMs) * width;
+        const float x1 = std::max(x0 + 1.0f, x0 + static_cast<float>(durationMs / frameMs) * width);
+        const float y0 = origin.y + rowHeight * static_cast<float>(sample.depth);
+        const ImVec2 minPos(x0, y0);
+        const ImVec2 maxPos(x1, y0 + rowHeight - 1.0f);
+        const ImU32 color = ImGui::GetColorU32(
+            ImVec4(0.85f, 0.45f + 0.1f * static_cast<float>(sample.depth % 4), 0.2f, 1.0f));
+        drawList->AddRectFilled(minPos, maxPos, color);
+        drawList->PushClipRect(minPos, maxPos, true);
+        drawList->AddText(ImVec2(x0 + 2.0f, y0), IM_COL32(0, 0, 0, 255), sample.name);
+        drawList->PopClipRect();
+        if (ImGui::IsMouseHoveringRect(minPos, maxPos)) {
+            ImGui::SetTooltip("%s\n%.3f ms", sample.name, durationMs);
+        }
+    }
+
+    // ===== ゾーン別 =====
+    std::vector<Profiler::ZoneStats> zones = profiler.GetZoneStats();
+    if (ImGui::BeginTable("ProfilerZones##Debug", 5,
+                          ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY |
+                              ImGuiTableFlags_Sortable,
+                          ImVec2(0.0f, 200.0f))) {
+        const ImGuiTableColumnFlags numeric =
+            ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending;
+        ImGui::TableSetupColumn("zone", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("last ms", numeric, 70.0f);
+        ImGui::TableSetupColumn("avg ms", numeric | ImGuiTableColumnFlags_DefaultSort, 70.0f);
+        ImGui::TableSetupColumn("max ms", numeric, 70.0f);
+        ImGui::TableSetupColumn("calls", numeric, 50.0f);
+
+        // 値は毎フレーム更新されるため、ヘッダーで選ばれた列と向きで毎回並べ直す
+        int sortColumn = 2;
+        bool ascending = false;
+        if (const ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs()) {
+            if (specs->SpecsCount > 0) {
+                sortColumn = specs->Specs[0].ColumnIndex;
+                ascending = (specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending);
+            }
+        }
+        std::sort(zones.begin(), zones.end(), [sortColumn, ascending](const auto& a, const auto& b) {
+            int cmp = 0;
+            switch (sortColumn) {
+            case 0:
+                cmp = std::strcmp(a.name ? a.name : "", b.name ? b.name : "");
+                break;
+            case 1:
+                cmp = (a.lastMs < b.lastMs) ? -1 : (a.lastMs > b.lastMs) ? 1 : 0;
+                break;
+            case 3:
+                cmp = (a.maxMs < b.maxMs) ? -1 : (a.maxMs > b.maxMs) ? 1 : 0;
+                break;
+            case 4:
+                cmp = (a.calls < b.calls) ? -1 : (a.calls > b.calls) ? 1 : 0;
+                break;
+            default:
+                cmp = (a.avgMs < b.avgMs) ? -1 : (a.avgMs > b.avgMs) ? 1 : 0;
+                break;
+            }
+            return ascending ? (cmp < 0) : (cmp > 0);
+        });
+
+        ImGui::TableHeadersRow();
+        for (const auto& zone : zones) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(zone.name ? zone.name : "?");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%.3f", zone.lastMs);
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.3f", zone.avgMs);
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.3f", zone.maxMs);
+            ImGui::TableSetColumnIndex(4);
+            ImGui::Text("%u", zone.calls);
+        }
+        ImGui::EndTable();
+    }
+#endif
+}
+
 void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
     // ===== Currency =====
     if (ImGui::CollapsingHeader("Currency", ImGuiTreeNodeFlags_DefaultOpen)) {
@@ -176,7 +319,7 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
 
             ImGui::SameLine();
             if (ui::ImGuiSound::Button(ctx.systemAPI, "Save##Currency")) {
-                lastSaveResult_ = ctx.gameplayDataAPI->Save();
+                lastSaveResult_ = ctx.gameplayDataAPI->Save() && ctx.gameplayDataAPI->FlushSave();
                 hasLastSaveResult_ = true;
             }
 
@@ -238,6 +381,15 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
                         ctx.systemAPI->Audio().GetBGMVolume());
             ImGui::Text("CurrentMusic: %s",
                         ctx.systemAPI->Audio().GetCurrentMusicName().c_str());
+            const auto& batch = ctx.systemAPI->Render().GetSpriteBatchStats();
+            ImGui::Text("SpriteBatch: drawCalls=%d quads=%d texSwitches=%d",
+                        batch.drawCalls, batch.quads, batch.textureSwitches);
+            if (ctx.sceneOverlayAPI) {
+                bool backdropCache = ctx.sceneOverlayAPI->IsBackdropCacheEnabled();
+                if (ImGui::Checkbox("Overlay backdrop cache", &backdropCache)) {
+                    ctx.sceneOverlayAPI->SetBackdropCacheEnabled(backdropCache);
+                }
+            }
         } else {
             ImGui::TextDisabled("systemAPI: null");
         }
@@ -250,6 +402,35 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
         } else {
             const size_t count = ctx.systemAPI->Resource().GetTextureCacheCount();
             ImGui::Text("count: %d", static_cast<int>(count));
+            ImGui::Text("atlas pages: %d",
+                        static_cast<int>(ctx.systemAPI->Resource().GetTextureAtlasCount()));
+            const auto residency = ctx.systemAPI->Resource().GetTextureResidencyStats();
+            ImGui::Text("resident: %.1f / %.1f MB (%d/%d textures, pinned=%d) uploads=%llu evicted=%llu dedup=%llu",
+                        static_cast<double>(residency.residentBytes) / (1024.0 * 1024.0),
+                        static_cast<double>(residency.budgetBytes) / (1024.0 * 1024.0),
+                        residency.residentTextures, residency.trackedTextures,
+                        residency.pinnedTextures,
+                        static_cast<unsigned long long>(residency.uploads),
+                        static_cast<unsigned long long>(residency.evictions),
+                        static_cast<unsigned long long>(residency.dedupHits));
+            const auto glyphs = ctx.systemAPI->Resource().GetDefaultFontGlyphStats();
+            ImGui::Text("glyphs: %d/%d atlas %dx%d (%.1f MB) rasterized=%llu evicted=%llu fallback=%llu",
+                        glyphs.residentGlyphs, glyphs.capacity, glyphs.atlasWidth,
+                        glyphs.atlasHeight,
+                        static_cast<double>(glyphs.atlasBytes) / (1024.0 * 1024.0),
+                        static_cast<unsigned long long>(glyphs.rasterized),
+                        static_cast<unsigned long long>(glyphs.evictions),
+                        static_cast<unsigned long long>(glyphs.fallbacks));
+            const auto layouts = ctx.systemAPI->Render().GetTextLayoutStats();
+            const uint64_t lookups = layouts.hits + layouts.misses;
+            ImGui::Text("text layouts: %d/%d hit=%.1f%% (%llu/%llu) evicted=%llu",
+                        static_cast<int>(layouts.entries), static_cast<int>(layouts.capacity),
+                        lookups > 0 ? 100.0 * static_cast<double>(layouts.hits) /
+                                          static_cast<double>(lookups)
+                                    : 0.0,
+                        static_cast<unsigned long long>(layouts.hits),
+                        static_cast<unsigned long long>(lookups),
+                        static_cast<unsigned long long>(layouts.evictions));
 
             ImGui::InputText("filter", textureFilter_.data(), textureFilter_.size());
 
@@ -261,14 +442,15 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
 
             const std::string filterStr(textureFilter_.data());
 
-            if (ImGui::BeginTable("TextureCacheTable##DebugCommon", 5,
+            if (ImGui::BeginTable("TextureCacheTable##DebugCommon", 6,
                                   ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
                                   ImVec2(0.0f, 220.0f))) {
                 ImGui::TableSetupColumn("key", ImGuiTableColumnFlags_WidthStretch);
                 ImGui::TableSetupColumn("id", ImGuiTableColumnFlags_WidthFixed, 80.0f);
                 ImGui::TableSetupColumn("w", ImGuiTableColumnFlags_WidthFixed, 60.0f);
                 ImGui::TableSetupColumn("h", ImGuiTableColumnFlags_WidthFixed, 60.0f);
-                ImGui::TableSetupColumn("bytes", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+                ImGui::TableSetupColumn("resident", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+                ImGui::TableSetupColumn("refs", ImGuiTableColumnFlags_WidthFixed, 40.0f);
                 ImGui::TableHeadersRow();
 
                 for (const auto& e : entries) {
@@ -276,9 +458,6 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
                         continue;
                     }
 
-                    const std::uint64_t bytes = static_cast<std::uint64_t>(std::max(0, e.width)) *
-                                                static_cast<std::uint64_t>(std::max(0, e.height)) * 4ULL;
-
                     ImGui::TableNextRow();
 
                     ImGui::TableSetColumnIndex(0);
@@ -294,7 +473,10 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
                     ImGui::Text("%d", e.height);
 
                     ImGui::TableSetColumnIndex(4);
-                    ImGui::Text("%llu", static_cast<unsigned long long>(bytes));
+                    ImGui::Text("%llu", static_cast<unsigned long long>(e.residentBytes));
+
+                    ImGui::TableSetColumnIndex(5);
+                    ImGui::Text("%d", e.refCount);
                 }
 
                 ImGui::EndTable();
@@ -395,7 +577,7 @@ void DebugUIAPI::RenderCommonPanel(SharedContext& ctx) {
 
             ImGui::Separator();
             if (ui::ImGuiSound::Button(ctx.systemAPI, "Save Lock States")) {
-                lastSaveResult_ = ctx.gameplayDataAPI->Save();
+                lastSaveResult_ = ctx.gameplayDataAPI->Save() && ctx.gameplayDataAPI->FlushSave();
                 hasLastSaveResult_ = true;
             }
             if (hasLastSaveResult_) {
@@ -41,6 +41,7 @@ private:
     };
 
     void RenderCommonPanel(SharedContext& ctx);
+    void RenderProfilerPanel(SharedContext& ctx);
     void SyncEditFieldsFromSave(const GameplayDataAPI& gameplayDataAPI);
 
     SharedContext* sharedContext_;
@@ -61,6 +62,9 @@ private:
 
     bool hasLastSaveResult_ = false;
     bool lastSaveResult_ = false;
+
+    // プロファイラ表示用
+    std::string profilerExportStatus_;
 };
 
 } // namespace core
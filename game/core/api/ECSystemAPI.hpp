@@ -3,6 +3,7 @@
 // 標準ライブラリ
 #include <cassert>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -80,6 +81,14 @@ public:
     template<typename... T, typename... Exclude>
     auto View(entt::exclude_t<Exclude...>);
 
+    // ========== グループ ==========
+    /// @brief 戦闘ループ用の所有グループ
+    ///
+    /// 戦闘ユニットが毎ティック読むホットな POD（位置・速度・HP・攻撃タイマー・陣営・
+    /// テンプレート添字・寸法）をグループが所有し、各プールの先頭に同じ順序で詰めて並べます。
+    /// 反復中は所有コンポーネントの追加・削除をしないこと（破棄は QueueDestroy で遅延する）。
+    auto BattleUnits();
+
     // ========== コンテキスト変数 ==========
     template<typename T, typename... Args>
     T& Ctx(Args&&... args);
@@ -110,6 +119,9 @@ public:
     void ResetForScene();
 
 private:
+    template<typename... Owned>
+    auto OwningGroup();
+
     entt::registry registry_;
     std::vector<entt::entity> pendingDestroy_;
 };
@@ -166,6 +178,24 @@ inline auto ECSystemAPI::View(entt::exclude_t<Exclude...>) {
     return registry_.view<T...>(entt::exclude<Exclude...>);
 }
 
+template<typename... Owned>
+inline auto ECSystemAPI::OwningGroup() {
+    static_assert((std::is_trivially_copyable_v<Owned> && ...),
+                  "owned components must stay POD (move strings to cold components)");
+    return registry_.group<Owned...>();
+}
+
+inline auto ECSystemAPI::BattleUnits() {
+    return OwningGroup<ecs::components::Position,
+                       ecs::components::Sprite,
+                       ecs::components::Team,
+                       ecs::components::Health,
+                       ecs::components::Movement,
+                       ecs::components::Stats,
+                       ecs::components::Combat,
+                       ecs::components::TemplateIndex>();
+}
+
 template<typename T, typename... Args>
 inline T& ECSystemAPI::Ctx(Args&&... args) {
     if (registry_.ctx().contains<T>()) {
@@ -40,9 +40,9 @@ entt::entity ECSystemAPI::CreateEntityFromCharacter(
 
     // Spriteコンポーネント（移動スプライトを使用）
     Add<ecs::components::Sprite>(entity,
-        character.move_sprite.sheet_path,
         character.move_sprite.frame_width,
         character.move_sprite.frame_height);
+    Add<ecs::components::SpriteSource>(entity, character.move_sprite.sheet_path);
 
     // Animationコンポーネント（移動アニメーション）
     Add<ecs::components::Animation>(entity,
@@ -54,6 +54,9 @@ entt::entity ECSystemAPI::CreateEntityFromCharacter(
     // CharacterIdコンポーネント（マスターデータ参照用）
     Add<ecs::components::CharacterId>(entity, character.id);
 
+    // TemplateIndexコンポーネント（テンプレート表を知る SetupAPI が解決する）
+    Add<ecs::components::TemplateIndex>(entity);
+
     LOG_INFO("Created entity from character: {} at ({}, {})",
         character.id,
         creationData.position.x,
@@ -117,6 +120,11 @@ entt::entity ECSystemAPI::CreateBattleEntityFromCharacter(
         team.faction = faction;
     }
 
+    // 固定ステップ描画補間の起点（初回ティックまでは生成位置に留める）
+    if (!Has<ecs::components::PreviousPosition>(entity)) {
+        Add<ecs::components::PreviousPosition>(entity, creationData.position.x, creationData.position.y);
+    }
+
     return entity;
 }
 
@@ -13,7 +13,9 @@
 #include "../ecs/entities/ItemPassiveManager.hpp"
 #include "../ecs/entities/StageManager.hpp"
 #include "../ecs/entities/TowerAttachmentManager.hpp"
+#include "../system/EffectiveStatTable.hpp"
 #include "../system/PlayerDataManager.hpp"
+#include "../system/RosterView.hpp"
 #include "../api/BattleProgressAPI.hpp"
 
 namespace game {
@@ -46,7 +48,13 @@ public:
     void Shutdown();
 
     // ===== Character =====
+    /// @brief マスターのコピーを返す（書き換える用途向け。参照だけなら GetCharacterMaster）
     std::shared_ptr<entities::Character> GetCharacterTemplate(const std::string& characterId);
+    /// @brief マスターを参照で返す（コピーなし、見つからなければ nullptr）
+    const entities::Character* GetCharacterMaster(const std::string& characterId) const;
+    /// @brief 戦闘/HUD 向けの密なテンプレート（毎フレーム参照してよい）
+    const entities::BattleTemplate* GetBattleTemplate(const std::string& characterId) const;
+    const entities::BattleTemplateTable& GetBattleTemplates() const;
     std::vector<std::string> GetAllCharacterIds() const;
     bool HasCharacter(const std::string& characterId) const;
     size_t GetCharacterCount() const;
@@ -87,9 +95,17 @@ public:
 
     // ===== PlayerData (limited write) =====
     bool Save() const;
+    /// @brief バックグラウンドで保留中のセーブを書き切る
+    bool FlushSave() const;
+    /// @brief 直近のセーブ書き込みが失敗したか（UI の警告表示用）
+    bool HasSaveError() const;
+    /// @brief false ならプレイヤーデータをディスクへ書かない（Initialize 前に設定。ヘッドレス実行用）
+    void SetSaveWritesEnabled(bool enabled);
     void ApplyToSharedContext(SharedContext& ctx) const;
     void SetFormationFromSharedContext(const FormationData& formation);
-    PlayerDataManager::CharacterState GetCharacterState(const std::string& characterId) const;
+    /// @brief キャラ状態を参照で返す（コピーなし。書き換えはコピーして SetCharacterState）
+    /// @note 未登録の ID では更新されない共有の既定値を返す（PlayerDataManager::GetCharacterState 参照）
+    const PlayerDataManager::CharacterState& GetCharacterState(const std::string& characterId) const;
     void SetCharacterState(const std::string& characterId,
                            const PlayerDataManager::CharacterState& state);
     int GetOwnedEquipmentCount(const std::string& equipmentId) const;
@@ -126,11 +142,28 @@ public:
     void SetTowerAttachments(
         const std::array<PlayerDataManager::PlayerSaveData::TowerAttachmentSlot, 3>& slots);
 
+    // ===== Effective stats (cached) =====
+    /// @brief セーブのロードアウト（Lv/装備/パッシブ）適用後の最終ステータス
+    ///
+    /// 該当キャラの状態かマスターが変わったときだけ再計算します。存在しないIDは nullptr。
+    const entities::CharacterStatCalculator::Result* GetEffectiveStats(
+        const std::string& characterId) const;
+    /// @brief タワー強化・アタッチメントの乗算補正（変更時のみ再計算）
+    const system::TowerEnhancementMultipliers& GetTowerEnhancementMultipliers() const;
+    const EffectiveStatTable::Stats& GetEffectiveStatTableStats() const;
+
+    // ===== Roster =====
+    /// @brief キャラ一覧のソートキー表（セーブ/マスター変更時のみ再構築）
+    const RosterView& GetRosterView() const;
+
     // ===== Consistency =====
     bool ValidateFormation(const FormationData& formation,
                            std::vector<std::string>* invalidCharacterIds = nullptr) const;
 
 private:
+    /// @brief 各マネージャを *JsonPath_ の JSON から初期化（パックが古い/無い場合）
+    void InitializeMastersFromJson();
+
     std::unique_ptr<entities::CharacterManager> characterManager_;
     std::unique_ptr<entities::ItemPassiveManager> itemPassiveManager_;
     std::unique_ptr<entities::StageManager> stageManager_;
@@ -142,6 +175,9 @@ private:
     std::string playerSavePath_;
     std::string towerAttachmentJsonPath_;
     bool isInitialized_ = false;
+    bool saveWritesEnabled_ = true;
+    mutable EffectiveStatTable effectiveStats_;
+    mutable RosterView rosterView_;
     
     // 最後のクリア報酬レポート
     StageClearReport lastClearReport_;
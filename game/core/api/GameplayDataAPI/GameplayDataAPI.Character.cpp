@@ -9,6 +9,7 @@ namespace core {
 
 namespace {
 const std::unordered_map<std::string, entities::Character> kEmptyCharacterMap{};
+const entities::BattleTemplateTable kEmptyBattleTemplates{};
 } // namespace
 
 std::shared_ptr<entities::Character> GameplayDataAPI::GetCharacterTemplate(
@@ -19,6 +20,26 @@ std::shared_ptr<entities::Character> GameplayDataAPI::GetCharacterTemplate(
     return characterManager_->GetCharacterTemplate(characterId);
 }
 
+const entities::Character* GameplayDataAPI::GetCharacterMaster(
+    const std::string& characterId) const {
+    if (!characterManager_) {
+        return nullptr;
+    }
+    return characterManager_->GetCharacterMaster(characterId);
+}
+
+const entities::BattleTemplate* GameplayDataAPI::GetBattleTemplate(
+    const std::string& characterId) const {
+    return GetBattleTemplates().Find(characterId);
+}
+
+const entities::BattleTemplateTable& GameplayDataAPI::GetBattleTemplates() const {
+    if (!characterManager_) {
+        return kEmptyBattleTemplates;
+    }
+    return characterManager_->GetBattleTemplates();
+}
+
 std::vector<std::string> GameplayDataAPI::GetAllCharacterIds() const {
     if (!characterManager_) {
         return {};
@@ -61,6 +82,8 @@ bool GameplayDataAPI::SaveCharacterMasters(
         return false;
     }
     characterManager_->SetMasters(masters);
+    effectiveStats_.InvalidateMasters();
+    rosterView_.InvalidateMasters();
     return true;
 }
 
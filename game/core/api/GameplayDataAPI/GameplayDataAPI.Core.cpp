@@ -1,53 +1,123 @@
 #include "../GameplayDataAPI.hpp"
 
+// 標準ライブラリ
+#include <filesystem>
+#include <utility>
+
 // プロジェクト内
+#include "../../ecs/entities/GameDataPack.hpp"
 #include "../../../utils/Log.h"
 
 namespace game {
 namespace core {
 
+namespace {
+
+/// @brief JSON 群に対応するパックのパス（GameDataCompiler の既定構成でなければ空）
+///
+/// パックは同じディレクトリの既定ファイル名の JSON から作られるため、
+/// 別名・別ディレクトリの JSON を指定されたときはパックを使わずに JSON を読む。
+std::string ResolveGameDataPackPath(const std::string& characterJsonPath,
+                                    const std::string& itemPassiveJsonPath,
+                                    const std::string& stageJsonPath,
+                                    const std::string& towerAttachmentJsonPath) {
+    namespace fs = std::filesystem;
+    const std::pair<const std::string*, const char*> expected[] = {
+        {&characterJsonPath, "characters.json"},
+        {&itemPassiveJsonPath, "item_passive.json"},
+        {&stageJsonPath, "stages.json"},
+        {&towerAttachmentJsonPath, "tower_attachments.json"},
+    };
+    const fs::path dataDir = fs::path(characterJsonPath).parent_path();
+    for (const auto& [path, fileName] : expected) {
+        const fs::path jsonPath(*path);
+        if (jsonPath.filename() != fileName || jsonPath.parent_path() != dataDir) {
+            return {};
+        }
+    }
+    const fs::path defaultPack(entities::GameDataPack::DEFAULT_PATH);
+    return (dataDir / defaultPack.filename()).string();
+}
+
+} // namespace
+
 bool GameplayDataAPI::Initialize(const std::string& characterJsonPath,
                                  const std::string& itemPassiveJsonPath,
                                  const std::string& stageJsonPath,
                                  const std::string& playerSavePath,
                                  const std::string& towerAttachmentJsonPath) {
     isInitialized_ = false;
+    effectiveStats_.Clear();
+    rosterView_.Clear();
     characterJsonPath_ = characterJsonPath;
     itemPassiveJsonPath_ = itemPassiveJsonPath;
     stageJsonPath_ = stageJsonPath;
     playerSavePath_ = playerSavePath;
     towerAttachmentJsonPath_ = towerAttachmentJsonPath;
 
+    // コンパイル済みパックが JSON より新しければ、字句解析を挟まずにマスターを流し込む
+    const std::string packPath = ResolveGameDataPackPath(
+        characterJsonPath, itemPassiveJsonPath, stageJsonPath, towerAttachmentJsonPath);
+    entities::GameDataPackContents pack;
+    std::string packError;
+    const bool usePack =
+        !packPath.empty() &&
+        entities::GameDataPack::IsUpToDate(packPath,
+                                           {characterJsonPath, itemPassiveJsonPath,
+                                            stageJsonPath, towerAttachmentJsonPath}) &&
+        entities::GameDataPack::Load(packPath, pack, &packError);
+    if (!packError.empty()) {
+        LOG_WARN("GameplayDataAPI: game data pack rejected ({}), loading JSON", packError);
+    }
+    if (usePack) {
+        characterManager_ = std::make_unique<entities::CharacterManager>();
+        characterManager_->SetMasters(pack.characters);
+        itemPassiveManager_ = std::make_unique<entities::ItemPassiveManager>();
+        itemPassiveManager_->SetMasters(pack.passives, pack.equipment);
+        stageManager_ = std::make_unique<entities::StageManager>();
+        stageManager_->SetMasters(pack.stages);
+        towerAttachmentManager_ = std::make_unique<entities::TowerAttachmentManager>();
+        towerAttachmentManager_->SetMasters(pack.towerAttachments);
+        LOG_INFO("GameplayDataAPI: loaded {} ({} characters, {} stages)",
+                 packPath, pack.characters.size(),
+                 pack.stages.size());
+    } else {
+        InitializeMastersFromJson();
+    }
+
+    playerDataManager_ = std::make_unique<PlayerDataManager>();
+    playerDataManager_->SetSaveWritesEnabled(saveWritesEnabled_);
+    if (!playerDataManager_->LoadOrCreate(playerSavePath, *characterManager_,
+                                          *itemPassiveManager_, *stageManager_)) {
+        LOG_WARN("GameplayDataAPI: PlayerDataManager initialization failed, using defaults");
+    }
+
+    isInitialized_ = true;
+    return true;
+}
+
+void GameplayDataAPI::InitializeMastersFromJson() {
     characterManager_ = std::make_unique<entities::CharacterManager>();
-    if (!characterManager_->Initialize(characterJsonPath)) {
+    if (!characterManager_->Initialize(characterJsonPath_)) {
         LOG_WARN("GameplayDataAPI: CharacterManager initialization failed, using fallback");
     }
 
     itemPassiveManager_ = std::make_unique<entities::ItemPassiveManager>();
-    if (!itemPassiveManager_->Initialize(itemPassiveJsonPath)) {
+    if (!itemPassiveManager_->Initialize(itemPassiveJsonPath_)) {
         LOG_WARN("GameplayDataAPI: ItemPassiveManager initialization failed, using fallback");
     }
 
     stageManager_ = std::make_unique<entities::StageManager>();
-    if (!stageManager_->Initialize(stageJsonPath)) {
+    if (!stageManager_->Initialize(stageJsonPath_)) {
         LOG_WARN("GameplayDataAPI: StageManager initialization failed, using fallback");
     } else {
         LOG_INFO("GameplayDataAPI: StageManager initialized with {} stages", stageManager_->GetStageCount());
     }
 
     towerAttachmentManager_ = std::make_unique<entities::TowerAttachmentManager>();
-    if (!towerAttachmentManager_->Initialize(towerAttachmentJsonPath)) {
+    if (!towerAttachmentManager_->Initialize(towerAttachmentJsonPath_)) {
         LOG_WARN("GameplayDataAPI: TowerAttachmentManager initialization failed, using fallback");
     }
-
-    playerDataManager_ = std::make_unique<PlayerDataManager>();
-    if (!playerDataManager_->LoadOrCreate(playerSavePath, *characterManager_,
-                                          *itemPassiveManager_, *stageManager_)) {
-        LOG_WARN("GameplayDataAPI: PlayerDataManager initialization failed, using defaults");
-    }
-
-    isInitialized_ = true;
-    return true;
 }
 
 void GameplayDataAPI::Shutdown() {
@@ -67,7 +137,12 @@ void GameplayDataAPI::Shutdown() {
         towerAttachmentManager_->Shutdown();
         towerAttachmentManager_.reset();
     }
-    playerDataManager_.reset();
+    if (playerDataManager_) {
+        playerDataManager_->FlushSave();
+        playerDataManager_.reset();
+    }
+    effectiveStats_.Clear();
+    rosterView_.Clear();
     isInitialized_ = false;
 }
 
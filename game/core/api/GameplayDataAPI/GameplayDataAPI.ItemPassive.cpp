@@ -71,6 +71,7 @@ bool GameplayDataAPI::SaveItemPassiveMasters(
         return false;
     }
     itemPassiveManager_->SetMasters(passives, equipment);
+    effectiveStats_.InvalidateMasters();
     return true;
 }
 
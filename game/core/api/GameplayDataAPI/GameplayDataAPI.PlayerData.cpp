@@ -24,6 +24,24 @@ bool GameplayDataAPI::Save() const {
     return ok;
 }
 
+bool GameplayDataAPI::FlushSave() const {
+    if (!playerDataManager_) {
+        return false;
+    }
+    return playerDataManager_->FlushSave();
+}
+
+bool GameplayDataAPI::HasSaveError() const {
+    return playerDataManager_ && playerDataManager_->HasSaveError();
+}
+
+void GameplayDataAPI::SetSaveWritesEnabled(bool enabled) {
+    saveWritesEnabled_ = enabled;
+    if (playerDataManager_) {
+        playerDataManager_->SetSaveWritesEnabled(enabled);
+    }
+}
+
 void GameplayDataAPI::ApplyToSharedContext(SharedContext& ctx) const {
     if (!playerDataManager_) {
         return;
@@ -38,10 +56,11 @@ void GameplayDataAPI::SetFormationFromSharedContext(const FormationData& formati
     playerDataManager_->SetFormationFromSharedContext(formation);
 }
 
-PlayerDataManager::CharacterState GameplayDataAPI::GetCharacterState(
+const PlayerDataManager::CharacterState& GameplayDataAPI::GetCharacterState(
     const std::string& characterId) const {
+    static const PlayerDataManager::CharacterState kDefaultState{};
     if (!playerDataManager_) {
-        return {};
+        return kDefaultState;
     }
     return playerDataManager_->GetCharacterState(characterId);
 }
@@ -285,5 +304,34 @@ void GameplayDataAPI::SetTowerAttachments(
     playerDataManager_->SetTowerAttachments(slots);
 }
 
+const entities::CharacterStatCalculator::Result* GameplayDataAPI::GetEffectiveStats(
+    const std::string& characterId) const {
+    if (!characterManager_ || !itemPassiveManager_ || !playerDataManager_) {
+        return nullptr;
+    }
+    return effectiveStats_.Get(characterId, *characterManager_, *itemPassiveManager_,
+                               *playerDataManager_);
+}
+
+const system::TowerEnhancementMultipliers& GameplayDataAPI::GetTowerEnhancementMultipliers() const {
+    static const system::TowerEnhancementMultipliers kDefault;
+    if (!playerDataManager_) {
+        return kDefault;
+    }
+    return effectiveStats_.GetTowerMultipliers(*playerDataManager_,
+                                               GetAllTowerAttachmentMasters());
+}
+
+const EffectiveStatTable::Stats& GameplayDataAPI::GetEffectiveStatTableStats() const {
+    return effectiveStats_.GetStats();
+}
+
+const RosterView& GameplayDataAPI::GetRosterView() const {
+    if (characterManager_ && playerDataManager_) {
+        rosterView_.Refresh(*characterManager_, *playerDataManager_);
+    }
+    return rosterView_;
+}
+
 } // namespace core
 } // namespace game
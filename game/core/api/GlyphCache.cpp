@@ -0,0 +1,368 @@
+#include "GlyphCache.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cstring>
+
+// 外部ライブラリ
+#include <rlgl.h>
+
+namespace game {
+namespace core {
+
+namespace {
+Image CreateBlankGrayAlphaImage(int size) {
+  Image image{};
+  image.data = MemAlloc(static_cast<unsigned int>(size * size * 2));
+  image.width = size;
+  image.height = size;
+  image.mipmaps = 1;
+  image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+  // raylib の既定フォントアトラスと同じく輝度は白、透明度だけで字形を持つ
+  auto *pixels = static_cast<unsigned char *>(image.data);
+  for (int i = 0; i < size * size; ++i) {
+    pixels[i * 2] = 255;
+    pixels[i * 2 + 1] = 0;
+  }
+  return image;
+}
+} // namespace
+
+GlyphCache::GlyphCache(int baseSize, int initialAtlasSize, int maxAtlasSize)
+    : baseSize_(std::max(1, baseSize)),
+      cellSize_(std::max(1, baseSize) + GLYPH_PADDING * 2),
+      atlasSize_(std::max(initialAtlasSize, std::max(1, baseSize) + GLYPH_PADDING * 2)),
+      maxAtlasSize_(std::max(maxAtlasSize, initialAtlasSize)),
+      textureFilter_(TEXTURE_FILTER_POINT), currentFrame_(0),
+      fontData_(nullptr), fontDataSize_(0), font_{}, atlasImage_{} {}
+
+GlyphCache::~GlyphCache() {
+  if (font_.texture.id != 0) {
+    UnloadTexture(font_.texture);
+  }
+  if (atlasImage_.data) {
+    UnloadImage(atlasImage_);
+  }
+  if (fontData_) {
+    UnloadFileData(fontData_);
+  }
+}
+
+bool GlyphCache::LoadFromFile(const std::string &path) {
+  if (fontData_) {
+    return true;
+  }
+
+  int dataSize = 0;
+  unsigned char *data = LoadFileData(path.c_str(), &dataSize);
+  if (!data || dataSize <= 0) {
+    if (data) {
+      UnloadFileData(data);
+    }
+    return false;
+  }
+  fontData_ = data;
+  fontDataSize_ = dataSize;
+
+  font_.baseSize = baseSize_;
+  font_.glyphPadding = GLYPH_PADDING;
+  CreateAtlas(atlasSize_);
+
+  // ASCII は常駐させる（'?' は raylib が未登録グリフの代替に使う）
+  std::vector<int> ascii;
+  for (int cp = 0x20; cp <= 0x7E; ++cp) {
+    ascii.push_back(cp);
+  }
+  Rasterize(ascii, PINNED_FRAME);
+  return !entries_.empty();
+}
+
+void GlyphCache::EnsureText(const std::string &text) {
+  codepointScratch_.clear();
+  const char *cursor = text.c_str();
+  const char *end = cursor + text.size();
+  while (cursor < end) {
+    int size = 0;
+    const int codepoint = GetCodepointNext(cursor, &size);
+    cursor += (size > 0) ? size : 1;
+    if (codepoint != '\n') {
+      codepointScratch_.push_back(codepoint);
+    }
+  }
+  EnsureCodepoints(codepointScratch_.data(),
+                   static_cast<int>(codepointScratch_.size()));
+}
+
+void GlyphCache::EnsureCodepoints(const int *codepoints, int count) {
+  if (!fontData_ || count <= 0) {
+    return;
+  }
+
+  std::vector<int> missing;
+  for (int i = 0; i < count; ++i) {
+    const int codepoint = codepoints[i];
+    auto it = entryByCodepoint_.find(codepoint);
+    if (it != entryByCodepoint_.end()) {
+      Entry &entry = entries_[static_cast<size_t>(it->second)];
+      if (entry.lastUsedFrame != PINNED_FRAME) {
+        entry.lastUsedFrame = currentFrame_;
+      }
+    } else if (std::find(missing.begin(), missing.end(), codepoint) ==
+               missing.end()) {
+      missing.push_back(codepoint);
+    }
+  }
+
+  if (!missing.empty()) {
+    Rasterize(missing, currentFrame_);
+  }
+}
+
+int GlyphCache::Prewarm(const std::vector<int> &codepoints,
+                        float maxFillRatio) {
+  if (!fontData_) {
+    return 0;
+  }
+
+  const int maxCells = (maxAtlasSize_ / cellSize_) * (maxAtlasSize_ / cellSize_);
+  const size_t limit = static_cast<size_t>(
+      static_cast<float>(maxCells) * std::clamp(maxFillRatio, 0.0f, 1.0f));
+
+  std::vector<int> request;
+  for (int codepoint : codepoints) {
+    if (entries_.size() + request.size() >= limit) {
+      break;
+    }
+    if (entryByCodepoint_.find(codepoint) == entryByCodepoint_.end() &&
+        std::find(request.begin(), request.end(), codepoint) == request.end()) {
+      request.push_back(codepoint);
+    }
+  }
+
+  const uint64_t before = stats_.rasterized;
+  Rasterize(request, currentFrame_);
+  return static_cast<int>(stats_.rasterized - before);
+}
+
+void GlyphCache::SetTextureFilter(int filter) {
+  textureFilter_ = filter;
+  if (font_.texture.id != 0) {
+    ::SetTextureFilter(font_.texture, filter);
+  }
+}
+
+GlyphCache::Stats GlyphCache::GetStats() const {
+  Stats stats = stats_;
+  stats.residentGlyphs = static_cast<int>(entries_.size());
+  stats.capacity = static_cast<int>(slots_.size());
+  stats.atlasWidth = atlasImage_.width;
+  stats.atlasHeight = atlasImage_.height;
+  stats.atlasBytes = static_cast<size_t>(atlasImage_.width) *
+                     static_cast<size_t>(atlasImage_.height) * 2;
+  return stats;
+}
+
+void GlyphCache::CreateAtlas(int size) {
+  atlasSize_ = size;
+  atlasImage_ = CreateBlankGrayAlphaImage(size);
+  font_.texture = LoadTextureFromImage(atlasImage_);
+  ::SetTextureFilter(font_.texture, textureFilter_);
+
+  const int cells = size / cellSize_;
+  slots_.clear();
+  freeSlots_.clear();
+  for (int row = 0; row < cells; ++row) {
+    for (int col = 0; col < cells; ++col) {
+      slots_.push_back(Rectangle{static_cast<float>(col * cellSize_),
+                                 static_cast<float>(row * cellSize_),
+                                 static_cast<float>(cellSize_),
+                                 static_cast<float>(cellSize_)});
+    }
+  }
+  // 若い番号のセルから使う
+  for (int i = static_cast<int>(slots_.size()) - 1; i >= 0; --i) {
+    freeSlots_.push_back(i);
+  }
+}
+
+bool GlyphCache::GrowAtlas() {
+  if (atlasSize_ >= maxAtlasSize_) {
+    return false;
+  }
+
+  const int oldSize = atlasSize_;
+  const int newSize = std::min(oldSize * 2, maxAtlasSize_);
+  const int oldCells = oldSize / cellSize_;
+  const int newCells = newSize / cellSize_;
+  if (newCells <= oldCells) {
+    return false;
+  }
+
+  Image grown = CreateBlankGrayAlphaImage(newSize);
+  const auto *src = static_cast<const unsigned char *>(atlasImage_.data);
+  auto *dst = static_cast<unsigned char *>(grown.data);
+  for (int y = 0; y < oldSize; ++y) {
+    std::memcpy(dst + static_cast<size_t>(y) * newSize * 2,
+                src + static_cast<size_t>(y) * oldSize * 2,
+                static_cast<size_t>(oldSize) * 2);
+  }
+
+  // 旧テクスチャを参照する描画がバッチに残っているので先に流してから差し替える
+  rlDrawRenderBatchActive();
+  UnloadTexture(font_.texture);
+  UnloadImage(atlasImage_);
+  atlasImage_ = grown;
+  atlasSize_ = newSize;
+  font_.texture = LoadTextureFromImage(atlasImage_);
+  ::SetTextureFilter(font_.texture, textureFilter_);
+
+  // 既存セルの位置は変わらないので、新しく増えた領域のセルだけを追加
+  std::vector<int> added;
+  for (int row = 0; row < newCells; ++row) {
+    for (int col = 0; col < newCells; ++col) {
+      if (row < oldCells && col < oldCells) {
+        continue;
+      }
+      added.push_back(static_cast<int>(slots_.size()));
+      slots_.push_back(Rectangle{static_cast<float>(col * cellSize_),
+                                 static_cast<float>(row * cellSize_),
+                                 static_cast<float>(cellSize_),
+                                 static_cast<float>(cellSize_)});
+    }
+  }
+  for (auto it = added.rbegin(); it != added.rend(); ++it) {
+    freeSlots_.push_back(*it);
+  }
+  return true;
+}
+
+int GlyphCache::AcquireSlot() {
+  if (freeSlots_.empty() && !GrowAtlas()) {
+    // 上限サイズ: このフレームで未使用のうち最も古いグリフを追い出す
+    int victim = -1;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      const uint64_t used = entries_[i].lastUsedFrame;
+      if (used >= currentFrame_) {
+        continue;  // 使用中（描画バッチ内に残っている可能性がある）か常駐
+      }
+      if (victim < 0 || used < entries_[static_cast<size_t>(victim)].lastUsedFrame) {
+        victim = static_cast<int>(i);
+      }
+    }
+    if (victim < 0) {
+      return -1;
+    }
+
+    const size_t index = static_cast<size_t>(victim);
+    const size_t last = entries_.size() - 1;
+    freeSlots_.push_back(entries_[index].slot);
+    entryByCodepoint_.erase(entries_[index].codepoint);
+    if (index != last) {
+      entries_[index] = entries_[last];
+      glyphs_[index] = glyphs_[last];
+      recs_[index] = recs_[last];
+      entryByCodepoint_[entries_[index].codepoint] = static_cast<int>(index);
+    }
+    entries_.pop_back();
+    glyphs_.pop_back();
+    recs_.pop_back();
+    ++stats_.evictions;
+  }
+
+  const int slot = freeSlots_.back();
+  freeSlots_.pop_back();
+  return slot;
+}
+
+void GlyphCache::Rasterize(const std::vector<int> &codepoints,
+                           uint64_t frame) {
+  if (!fontData_ || codepoints.empty()) {
+    return;
+  }
+
+  std::vector<int> request(codepoints);
+  const int count = static_cast<int>(request.size());
+  GlyphInfo *infos = LoadFontData(fontData_, fontDataSize_, baseSize_,
+                                  request.data(), count, FONT_DEFAULT);
+  if (!infos) {
+    return;
+  }
+
+  for (int i = 0; i < count; ++i) {
+    const int slot = AcquireSlot();
+    if (slot < 0) {
+      stats_.fallbacks += static_cast<uint64_t>(count - i);
+      break;
+    }
+
+    const int entryIndex = static_cast<int>(entries_.size());
+    entries_.push_back(Entry{request[static_cast<size_t>(i)], slot, frame});
+    glyphs_.push_back(GlyphInfo{});
+    recs_.push_back(Rectangle{});
+    entryByCodepoint_[request[static_cast<size_t>(i)]] = entryIndex;
+    PlaceGlyph(entryIndex, infos[i]);
+    ++stats_.rasterized;
+  }
+
+  UnloadFontData(infos, count);
+  SyncFontArrays();
+}
+
+void GlyphCache::PlaceGlyph(int entryIndex, const GlyphInfo &info) {
+  const size_t index = static_cast<size_t>(entryIndex);
+  const Rectangle cell = slots_[static_cast<size_t>(entries_[index].slot)];
+  const int inner = cellSize_ - GLYPH_PADDING * 2;
+
+  Image glyphImage = info.image;
+  bool converted = false;
+  if (glyphImage.data && glyphImage.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) {
+    glyphImage = ImageCopy(info.image);
+    ImageFormat(&glyphImage, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    converted = true;
+  }
+
+  const int width = glyphImage.data ? std::min(glyphImage.width, inner) : 0;
+  const int height = glyphImage.data ? std::min(glyphImage.height, inner) : 0;
+
+  cellPixels_.assign(static_cast<size_t>(cellSize_) * cellSize_ * 2, 0);
+  for (size_t i = 0; i < cellPixels_.size(); i += 2) {
+    cellPixels_[i] = 255;
+  }
+  const auto *coverage = static_cast<const unsigned char *>(glyphImage.data);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const size_t dst = (static_cast<size_t>(y + GLYPH_PADDING) * cellSize_ +
+                          static_cast<size_t>(x + GLYPH_PADDING)) * 2;
+      cellPixels_[dst + 1] = coverage[y * glyphImage.width + x];
+    }
+  }
+  if (converted) {
+    UnloadImage(glyphImage);
+  }
+
+  // CPU ミラーと GPU のセル部分だけを更新
+  auto *atlas = static_cast<unsigned char *>(atlasImage_.data);
+  const int cellX = static_cast<int>(cell.x);
+  const int cellY = static_cast<int>(cell.y);
+  const size_t rowBytes = static_cast<size_t>(cellSize_) * 2;
+  for (int y = 0; y < cellSize_; ++y) {
+    std::memcpy(atlas + (static_cast<size_t>(cellY + y) * atlasSize_ + cellX) * 2,
+                cellPixels_.data() + static_cast<size_t>(y) * rowBytes, rowBytes);
+  }
+  UpdateTextureRec(font_.texture, cell, cellPixels_.data());
+
+  GlyphInfo glyph = info;
+  glyph.image = Image{};
+  glyphs_[index] = glyph;
+  recs_[index] = Rectangle{cell.x + GLYPH_PADDING, cell.y + GLYPH_PADDING,
+                           static_cast<float>(width), static_cast<float>(height)};
+}
+
+void GlyphCache::SyncFontArrays() {
+  font_.glyphCount = static_cast<int>(entries_.size());
+  font_.glyphs = glyphs_.empty() ? nullptr : glyphs_.data();
+  font_.recs = recs_.empty() ? nullptr : recs_.data();
+}
+
+} // namespace core
+} // namespace game
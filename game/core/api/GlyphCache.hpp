@@ -0,0 +1,107 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief フォントグリフを初回使用時にラスタライズして保持する動的アトラス
+///
+/// 固定サイズのセルを並べたアトラスへグリフを1つずつ配置し、満杯なら2倍へ拡張、
+/// 上限サイズに達したら最も長く使われていないグリフ（LRU）を追い出します。
+/// GetFont() が返す raylib の Font はキャッシュ内の配列を指しており、
+/// EnsureText() 後にそのまま DrawTextEx / MeasureTextEx に渡せます。
+class GlyphCache {
+public:
+  struct Stats {
+    int residentGlyphs = 0;
+    int capacity = 0;
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+    size_t atlasBytes = 0;
+    uint64_t rasterized = 0;
+    uint64_t evictions = 0;
+    uint64_t fallbacks = 0;  // アトラスに空きが無く '?' で代替した回数
+  };
+
+  GlyphCache(int baseSize, int initialAtlasSize, int maxAtlasSize);
+  ~GlyphCache();
+
+  GlyphCache(const GlyphCache &) = delete;
+  GlyphCache &operator=(const GlyphCache &) = delete;
+
+  /// @brief TTF/OTF を読み込み ASCII だけを事前にラスタライズ
+  bool LoadFromFile(const std::string &path);
+  bool IsLoaded() const { return fontData_ != nullptr; }
+
+  Font &GetFont() { return font_; }
+  const Font &GetFont() const { return font_; }
+
+  /// @brief UTF-8 文字列中のグリフを用意（不足分のみラスタライズ）
+  void EnsureText(const std::string &text);
+  void EnsureCodepoints(const int *codepoints, int count);
+
+  /// @brief 事前ウォーム（LRU を乱さないよう上限容量の maxFillRatio までに留める）
+  /// @return 新たにラスタライズしたグリフ数
+  int Prewarm(const std::vector<int> &codepoints, float maxFillRatio);
+
+  /// @brief フレーム境界（このフレームで使ったグリフは追い出し対象にしない）
+  void AdvanceFrame() { ++currentFrame_; }
+
+  void SetTextureFilter(int filter);
+
+  Stats GetStats() const;
+
+private:
+  struct Entry {
+    int codepoint = 0;
+    int slot = -1;
+    uint64_t lastUsedFrame = 0;
+  };
+
+  static constexpr uint64_t PINNED_FRAME = UINT64_MAX;
+  static constexpr int GLYPH_PADDING = 2;
+
+  void CreateAtlas(int size);
+  bool GrowAtlas();
+  int AcquireSlot();
+  void Rasterize(const std::vector<int> &codepoints, uint64_t frame);
+  void PlaceGlyph(int entryIndex, const GlyphInfo &info);
+  void SyncFontArrays();
+
+  int baseSize_;
+  int cellSize_;
+  int atlasSize_;
+  int maxAtlasSize_;
+  int textureFilter_;
+  uint64_t currentFrame_;
+
+  unsigned char *fontData_;
+  int fontDataSize_;
+
+  Font font_;
+  Image atlasImage_;  // GRAY_ALPHA の CPU 側ミラー（拡張時のコピー元）
+
+  std::vector<Entry> entries_;  // 添字 = Font のグリフ添字
+  std::vector<GlyphInfo> glyphs_;
+  std::vector<Rectangle> recs_;
+  std::unordered_map<int, int> entryByCodepoint_;
+
+  std::vector<Rectangle> slots_;
+  std::vector<int> freeSlots_;
+  std::vector<unsigned char> cellPixels_;
+  std::vector<int> codepointScratch_;
+
+  Stats stats_;
+};
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,214 @@
+#include "MusicStreamWorker.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <chrono>
+
+// プロジェクト内
+#include "../../utils/Log.h"
+
+namespace game {
+namespace core {
+
+namespace {
+// raylib の既定ストリームバッファは 1 ブロック数十ミリ秒なので、これより十分短い間隔で補充する
+constexpr auto kPumpInterval = std::chrono::milliseconds(5);
+} // namespace
+
+MusicStreamWorker::MusicStreamWorker(bool threaded) {
+  if (threaded) {
+    thread_ = std::thread([this]() { ThreadLoop(); });
+  }
+}
+
+MusicStreamWorker::~MusicStreamWorker() {
+  stopRequested_.store(true, std::memory_order_release);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  for (Stream &stream : streams_) {
+    StopStream(stream);
+  }
+}
+
+bool MusicStreamWorker::Play(Music *music, float fadeSeconds) {
+  if (!music) {
+    return false;
+  }
+  Command command;
+  command.type = Command::Type::Play;
+  command.music = music;
+  command.value = fadeSeconds;
+  command.ticket = lastPlayTicket_ + 1;
+  if (!Push(command)) {
+    return false;
+  }
+  lastPlayTicket_ = command.ticket;
+  return true;
+}
+
+bool MusicStreamWorker::Stop(float fadeSeconds) {
+  Command command;
+  command.type = Command::Type::Stop;
+  command.value = fadeSeconds;
+  return Push(command);
+}
+
+bool MusicStreamWorker::SetVolume(float volume) {
+  Command command;
+  command.type = Command::Type::SetVolume;
+  command.value = volume;
+  return Push(command);
+}
+
+void MusicStreamWorker::Pump(float deltaTime) {
+  if (IsThreaded()) {
+    return;
+  }
+  Step(deltaTime);
+}
+
+bool MusicStreamWorker::Push(const Command &command) {
+  // 書き込み側はゲームスレッドのみ（単一書き込み）
+  const size_t head = head_.load(std::memory_order_relaxed);
+  const size_t tail = tail_.load(std::memory_order_acquire);
+  if (head - tail >= COMMAND_CAPACITY) {
+    if (droppedCommands_.fetch_add(1, std::memory_order_relaxed) == 0) {
+      LOG_WARN("MusicStreamWorker: command queue full, dropping commands");
+    }
+    return false;
+  }
+  commands_[head & (COMMAND_CAPACITY - 1)] = command;
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+void MusicStreamWorker::ThreadLoop() {
+  using Clock = std::chrono::steady_clock;
+  auto last = Clock::now();
+  while (!stopRequested_.load(std::memory_order_acquire)) {
+    const auto now = Clock::now();
+    const float deltaTime = std::chrono::duration<float>(now - last).count();
+    last = now;
+    Step(deltaTime);
+    std::this_thread::sleep_for(kPumpInterval);
+  }
+}
+
+void MusicStreamWorker::Step(float deltaTime) {
+  size_t tail = tail_.load(std::memory_order_relaxed);
+  const size_t head = head_.load(std::memory_order_acquire);
+  for (; tail != head; ++tail) {
+    Apply(commands_[tail & (COMMAND_CAPACITY - 1)]);
+  }
+  tail_.store(tail, std::memory_order_release);
+
+  for (Stream &stream : streams_) {
+    if (!stream.music) {
+      continue;
+    }
+    if (!::IsMusicStreamPlaying(*stream.music)) {
+      // ループしない曲が最後まで再生された。古い Play の終了で新しい番号を上書きしないよう最大値を残す
+      uint64_t ended = endedTicket_.load(std::memory_order_relaxed);
+      while (ended < stream.ticket &&
+             !endedTicket_.compare_exchange_weak(ended, stream.ticket,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+      }
+      stream = Stream{};
+      continue;
+    }
+
+    if (stream.gain != stream.target) {
+      if (stream.rate <= 0.0f) {
+        stream.gain = stream.target;
+      } else {
+        const float delta = stream.rate * deltaTime;
+        stream.gain = (stream.gain < stream.target)
+                          ? std::min(stream.target, stream.gain + delta)
+                          : std::max(stream.target, stream.gain - delta);
+      }
+    }
+    if (stream.stopAtZero && stream.gain <= 0.0f) {
+      StopStream(stream);
+      continue;
+    }
+
+    const float volume = stream.gain * volume_;
+    if (volume != stream.appliedVolume) {
+      ::SetMusicVolume(*stream.music, volume);
+      stream.appliedVolume = volume;
+    }
+    ::UpdateMusicStream(*stream.music);
+  }
+}
+
+void MusicStreamWorker::Apply(const Command &command) {
+  switch (command.type) {
+  case Command::Type::Play: {
+    const float rate = (command.value > 0.0f) ? 1.0f / command.value : 0.0f;
+    Stream *slot = nullptr;
+    for (Stream &stream : streams_) {
+      if (stream.music == command.music) {
+        slot = &stream;
+      }
+    }
+    for (Stream &stream : streams_) {
+      if (stream.music && &stream != slot) {
+        stream.target = 0.0f;
+        stream.rate = rate;
+        stream.stopAtZero = true;
+      }
+    }
+
+    if (!slot) {
+      // 空きがなければ最も小さく鳴っているストリームを止めて使う
+      for (Stream &stream : streams_) {
+        if (!stream.music) {
+          slot = &stream;
+          break;
+        }
+        if (!slot || stream.gain < slot->gain) {
+          slot = &stream;
+        }
+      }
+      StopStream(*slot);
+      slot->music = command.music;
+      slot->gain = (rate > 0.0f) ? 0.0f : 1.0f;
+    }
+    if (!::IsMusicStreamPlaying(*slot->music)) {
+      ::PlayMusicStream(*slot->music);
+      slot->appliedVolume = -1.0f;
+    }
+    slot->target = 1.0f;
+    slot->rate = rate;
+    slot->stopAtZero = false;
+    slot->ticket = command.ticket;
+    break;
+  }
+  case Command::Type::Stop: {
+    const float rate = (command.value > 0.0f) ? 1.0f / command.value : 0.0f;
+    for (Stream &stream : streams_) {
+      if (stream.music) {
+        stream.target = 0.0f;
+        stream.rate = rate;
+        stream.stopAtZero = true;
+      }
+    }
+    break;
+  }
+  case Command::Type::SetVolume:
+    volume_ = std::max(0.0f, std::min(1.0f, command.value));
+    break;
+  }
+}
+
+void MusicStreamWorker::StopStream(Stream &stream) {
+  if (stream.music && ::IsMusicStreamPlaying(*stream.music)) {
+    ::StopMusicStream(*stream.music);
+  }
+  stream = Stream{};
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,101 @@
+#pragma once
+
+// 標準ライブラリ
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief BGM ストリームの更新（バッファ補充）・フェード・音量をまとめて受け持つワーカー
+///
+/// Music に触れるのはワーカースレッドだけで、ゲームスレッドは Play/Stop/SetVolume を
+/// 固定長のロックフリーキュー（単一書き込み・単一読み出し）へ積むだけです。ワーカーは
+/// 数ミリ秒ごとにコマンドを処理し、フェードを進めて UpdateMusicStream を呼ぶため、
+/// ゲームスレッドのフレームが長引いても BGM のバッファが枯れません。
+/// スレッドを使えない環境（Web）ではスレッドを起こさず、Pump() をゲームスレッドから呼びます。
+class MusicStreamWorker {
+public:
+  static constexpr size_t MAX_STREAMS = 4;         // フェード中の重なりを含む同時ストリーム数
+  static constexpr size_t COMMAND_CAPACITY = 64;   // 2の冪
+  static_assert((COMMAND_CAPACITY & (COMMAND_CAPACITY - 1)) == 0,
+                "COMMAND_CAPACITY must be a power of two");
+
+  /// @param threaded false ならスレッドを起こさない（Pump() を呼ぶ側が更新する）
+  explicit MusicStreamWorker(bool threaded);
+  ~MusicStreamWorker();
+
+  MusicStreamWorker(const MusicStreamWorker &) = delete;
+  MusicStreamWorker &operator=(const MusicStreamWorker &) = delete;
+
+  /// @brief music を再生し、それ以外の再生中ストリームを fadeSeconds かけてクロスフェードで止める
+  /// @details 読み込み（LoadMusicStream）は呼び出し側で済ませておく。以降 music はワーカーが所有する。
+  bool Play(Music *music, float fadeSeconds);
+  /// @brief 全ストリームを fadeSeconds かけて止める
+  bool Stop(float fadeSeconds);
+  /// @brief 全ストリームに掛ける音量（master * BGM）
+  bool SetVolume(float volume);
+
+  /// @brief コマンドを処理してフェードとバッファ補充を deltaTime 秒進める（スレッドなしのとき用）
+  void Pump(float deltaTime);
+
+  bool IsThreaded() const { return thread_.joinable(); }
+  /// @brief 最後に受け付けた Play の曲が（ループせずに）最後まで再生されたか
+  /// @details ゲームスレッドから呼ぶ。Stop やクロスフェードで止めた場合は含まない。
+  bool HasLastPlayEnded() const {
+    return lastPlayTicket_ != 0 &&
+           endedTicket_.load(std::memory_order_acquire) >= lastPlayTicket_;
+  }
+  /// @brief キューが満杯で捨てたコマンド数
+  uint64_t GetDroppedCommands() const {
+    return droppedCommands_.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Command {
+    enum class Type : uint8_t { Play, Stop, SetVolume };
+    Type type = Type::Stop;
+    Music *music = nullptr;
+    float value = 0.0f;  // SetVolume: 音量 / Play・Stop: フェード秒数
+    uint64_t ticket = 0; // Play: 受付順の通し番号
+  };
+
+  // 以下はワーカー側（スレッドなしなら Pump の呼び出し側）だけが触る
+  struct Stream {
+    Music *music = nullptr;
+    float gain = 0.0f;     // フェードの現在値 [0, 1]
+    float target = 0.0f;
+    float rate = 0.0f;     // 1秒あたりの gain 変化量（0 なら即時）
+    bool stopAtZero = false;
+    float appliedVolume = -1.0f;
+    uint64_t ticket = 0;   // このストリームを最後に鳴らした Play の通し番号
+  };
+
+  bool Push(const Command &command);
+  void ThreadLoop();
+  void Step(float deltaTime);
+  void Apply(const Command &command);
+  void StopStream(Stream &stream);
+
+  std::array<Command, COMMAND_CAPACITY> commands_;
+  std::atomic<size_t> head_{0};  // 次に書き込む位置（ゲームスレッド）
+  std::atomic<size_t> tail_{0};  // 次に読む位置（ワーカー）
+  std::atomic<uint64_t> droppedCommands_{0};
+  uint64_t lastPlayTicket_ = 0;             // ゲームスレッドのみ
+  std::atomic<uint64_t> endedTicket_{0};    // 最後まで再生された Play の通し番号の最大値（ワーカーが書く）
+
+  std::array<Stream, MAX_STREAMS> streams_;
+  float volume_ = 1.0f;
+
+  std::atomic<bool> stopRequested_{false};
+  std::thread thread_;
+};
+
+} // namespace core
+} // namespace game
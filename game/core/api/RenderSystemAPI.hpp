@@ -1,6 +1,7 @@
 #pragma once
 
 // 標準ライブラリ
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -9,6 +10,7 @@
 #include "../config/RenderTypes.hpp"
 #include "../config/RenderPrimitives.hpp"
 #include "../config/GameConfig.hpp"
+#include "TextLayoutCache.hpp"
 
 namespace game {
 namespace core {
@@ -20,6 +22,25 @@ class RenderSystemAPI {
 public:
   using ImGuiRenderCallback = std::function<void()>;
 
+  /// @brief スプライトバッチの統計（1フレーム分）
+  struct SpriteBatchStats {
+    int drawCalls = 0;               // テクスチャ単位にまとめた描画回数
+    int quads = 0;                   // 投入された矩形数
+    int textureSwitches = 0;         // layer 整列後のテクスチャ切り替え回数
+  };
+
+  /// @brief バッチに積まれた1矩形
+  struct SpriteBatchItem {
+    Texture2D texture{};
+    Rectangle source{};
+    Rectangle dest{};
+    Vector2 origin{};
+    float rotation = 0.0f;
+    Color tint{};
+    int layer = 0;
+    uint32_t order = 0;
+  };
+
   explicit RenderSystemAPI(BaseSystemAPI* owner);
   ~RenderSystemAPI() = default;
 
@@ -35,6 +56,11 @@ public:
   void EndRender();
   void EndFrame(ImGuiRenderCallback imGuiCallback = nullptr);
 
+  /// @brief BeginRender～EndRender の途中で描画先を target へ切り替える
+  void BeginRenderTarget(const RenderTexture2D& target, bool clearBackground = true);
+  /// @brief BeginRenderTarget の描画先を閉じ、メインの描画先へ戻る（クリアしない）
+  void EndRenderTarget();
+
   void BeginImGui();
   void EndImGui();
   bool IsImGuiInitialized() const;
@@ -85,6 +111,28 @@ public:
   Vec2 MeasureTextWithFontCore(Font* font, const std::string& text,
                                float fontSize, float spacing = 1.0f) const;
 
+  // ========== テキストレイアウト ==========
+  // DrawText* / MeasureText* は内部で TextLayoutCache を引くため、同じ文字列の再計測・再デコードは発生しない。
+  // 折り返しが必要な場合は LayoutText* で行分割済みのレイアウトを取得し、行単位で描画する。
+  /// @brief 計測・折り返し済みのレイアウト（wrapWidth <= 0 なら改行のみで分割）
+  /// @note 戻り値は LRU から追い出されるまで有効。描画は同じフレームで行うこと
+  const TextLayout& LayoutTextDefault(const std::string& text, float fontSize,
+                                      float spacing = 1.0f,
+                                      float wrapWidth = 0.0f);
+  const TextLayout& LayoutTextWithFont(Font* font, const std::string& text,
+                                       float fontSize, float spacing = 1.0f,
+                                       float wrapWidth = 0.0f);
+  /// @brief LayoutText* で得たレイアウトの lineIndex 行目を描画
+  void DrawTextLayoutLineDefault(const TextLayout& layout, size_t lineIndex,
+                                 Vector2 position, Color color);
+  void DrawTextLayoutLineDefault(const TextLayout& layout, size_t lineIndex,
+                                 Vec2 position, ColorRGBA color);
+  void DrawTextLayoutLineWithFont(Font* font, const TextLayout& layout,
+                                  size_t lineIndex, Vector2 position,
+                                  Color color);
+  /// @brief レイアウトキャッシュの統計（ヒット率はデバッグUIに表示）
+  TextLayoutCache::Stats GetTextLayoutStats() const;
+
   void DrawRectangle(float x, float y, float width, float height, Color color);
   void DrawRectangle(float x, float y, float width, float height,
                      ColorRGBA color);
@@ -293,6 +341,25 @@ public:
   Color GetReadableTextColor(const std::string& textureKey,
                              float luminanceThreshold = 0.6f);
 
+  // ========== スプライトバッチ ==========
+  // Begin～Flush の間に投入した矩形を (layer, 投入順) で並べ替えて描画する。
+  // raylib は同一テクスチャの連続描画を1回のドローコールにまとめるため、同じアトラスページの
+  // 矩形が続く区間はそのまま1回にまとまる。同一 layer 内の前後関係は投入順のまま保証される。
+  void BeginSpriteBatch();
+  void SubmitSprite(const Texture2D& texture, Rectangle source, Rectangle dest,
+                    Vector2 origin, float rotation, Color tint, int layer = 0);
+  void FlushSpriteBatch();
+  bool IsSpriteBatchActive() const;
+  /// @brief 直前に完了したフレームの統計
+  const SpriteBatchStats& GetSpriteBatchStats() const;
+
+  // ========== パーティクル ==========
+  /// @brief 中心 (x[i], y[i])・一辺 size[i] の正方形を count 個、1回の四角形バッチで描画
+  /// @details 形状用テクスチャで rlBegin(RL_QUADS) を1回だけ開くため、粒子数に関わらず
+  ///          テクスチャ切り替えは発生しない。color[i].a に alpha[i] を掛けて描く。
+  void DrawParticleQuads(const float* x, const float* y, const float* size,
+                         const float* alpha, const Color* color, size_t count);
+
 private:
   BaseSystemAPI* owner_;
 };
@@ -0,0 +1,113 @@
+#include "ResourceDecodeQueue.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+namespace game {
+namespace core {
+
+ResourceDecodeQueue::ResourceDecodeQueue(std::vector<ResourceFileInfo> files,
+                                         int threadCount)
+    : files_(std::move(files)), results_(files_.size()),
+      ready_(files_.size(), 0), taken_(files_.size(), 0) {
+  const int count = std::max(1, threadCount);
+  workers_.reserve(static_cast<size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    workers_.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+ResourceDecodeQueue::~ResourceDecodeQueue() {
+  stopRequested_ = true;
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  for (size_t i = 0; i < results_.size(); ++i) {
+    if (ready_[i] && !taken_[i]) {
+      Release(results_[i]);
+    }
+  }
+}
+
+bool ResourceDecodeQueue::IsReady(size_t index) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return index < ready_.size() && ready_[index] != 0;
+}
+
+DecodedResource ResourceDecodeQueue::Take(size_t index) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (index >= results_.size() || taken_[index]) {
+    return DecodedResource{};
+  }
+  readyCondition_.wait(lock, [&]() { return ready_[index] != 0; });
+  taken_[index] = 1;
+  DecodedResource result = results_[index];
+  results_[index] = DecodedResource{};
+  return result;
+}
+
+int ResourceDecodeQueue::DefaultThreadCount() {
+  const unsigned int hw = std::thread::hardware_concurrency();
+  const int available = (hw > 1) ? static_cast<int>(hw) - 1 : 1;
+  return std::min(available, 8);
+}
+
+void ResourceDecodeQueue::WorkerLoop() {
+  while (!stopRequested_) {
+    const size_t index = nextIndex_.fetch_add(1);
+    if (index >= files_.size()) {
+      return;
+    }
+    DecodedResource decoded = Decode(files_[index]);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      results_[index] = decoded;
+      ready_[index] = 1;
+    }
+    readyCondition_.notify_all();
+  }
+}
+
+DecodedResource ResourceDecodeQueue::Decode(const ResourceFileInfo &file) {
+  DecodedResource decoded;
+  switch (file.type) {
+  case ResourceType::Texture:
+    decoded.image = ::LoadImage(file.path.c_str());
+    decoded.hasImage = (decoded.image.data != nullptr);
+    break;
+  case ResourceType::Sound: {
+    // mp3 はストリーミング再生（LoadMusicStream）のためメインスレッドで開く
+    std::string ext = std::filesystem::path(file.path).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (ext == ".wav" || ext == ".ogg") {
+      decoded.wave = ::LoadWave(file.path.c_str());
+      decoded.hasWave = (decoded.wave.data != nullptr);
+    }
+    break;
+  }
+  case ResourceType::Font:
+  case ResourceType::Json:
+    // どちらも読み込み時点では処理なし（フォントは SetDefaultFont、JSON は各マネージャが読む）
+    break;
+  }
+  return decoded;
+}
+
+void ResourceDecodeQueue::Release(DecodedResource &resource) {
+  if (resource.hasImage) {
+    UnloadImage(resource.image);
+  }
+  if (resource.hasWave) {
+    UnloadWave(resource.wave);
+  }
+  resource = DecodedResource{};
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,68 @@
+#pragma once
+
+// 標準ライブラリ
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+#include "ResourceSystemAPI.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief ワーカースレッドでデコード済みの CPU 側リソース
+struct DecodedResource {
+  bool hasImage = false;
+  bool hasWave = false;
+  Image image{};
+  Wave wave{};
+};
+
+/// @brief リソースファイルのデコード（PNG/WAV/OGG）をワーカープールで先行実行するキュー
+///
+/// ファイル一覧の順にワーカーがデコードし、メインスレッドは Take() で結果を受け取って
+/// GPU/オーディオデバイスへのアップロードだけを行います。
+/// Take() されなかった結果はデストラクタで解放します。
+class ResourceDecodeQueue {
+public:
+  ResourceDecodeQueue(std::vector<ResourceFileInfo> files, int threadCount);
+  ~ResourceDecodeQueue();
+
+  ResourceDecodeQueue(const ResourceDecodeQueue &) = delete;
+  ResourceDecodeQueue &operator=(const ResourceDecodeQueue &) = delete;
+
+  size_t GetFileCount() const { return files_.size(); }
+
+  /// @brief index のデコードが完了しているか
+  bool IsReady(size_t index) const;
+
+  /// @brief index の結果を受け取る（未完了なら完了まで待機）。所有権は呼び出し側へ移る
+  DecodedResource Take(size_t index);
+
+  /// @brief 環境に応じたワーカー数（メインスレッド分を1つ空ける）
+  static int DefaultThreadCount();
+
+private:
+  void WorkerLoop();
+  static DecodedResource Decode(const ResourceFileInfo &file);
+  static void Release(DecodedResource &resource);
+
+  std::vector<ResourceFileInfo> files_;
+  std::vector<DecodedResource> results_;
+  std::vector<char> ready_;
+  std::vector<char> taken_;
+
+  std::atomic<size_t> nextIndex_{0};
+  std::atomic<bool> stopRequested_{false};
+  mutable std::mutex mutex_;
+  std::condition_variable readyCondition_;
+  std::vector<std::thread> workers_;
+};
+
+} // namespace core
+} // namespace game
@@ -1,12 +1,15 @@
 #pragma once
 
 // 標準ライブラリ
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
 
 // プロジェクト内
 #include "../config/RenderTypes.hpp"
+#include "GlyphCache.hpp"
+#include "TextureResidency.hpp"
 
 namespace game {
 namespace core {
@@ -45,6 +48,16 @@ struct AssetLicenseEntry {
   std::string sourcePath;
 };
 
+/// @brief テクスチャハンドル（ResourceSystemAPI 内のテーブル添字、0 は無効）
+using TextureHandle = uint32_t;
+constexpr TextureHandle INVALID_TEXTURE_HANDLE = 0;
+
+/// @brief テクスチャ上の部分矩形（アトラス収録済みならアトラス内の位置）
+struct TextureRegion {
+  Texture2D* texture = nullptr;
+  Rectangle rect{};
+};
+
 /// @brief リソースAPI
 class ResourceSystemAPI {
 public:
@@ -53,6 +66,8 @@ public:
     unsigned int id = 0;
     int width = 0;
     int height = 0;
+    size_t residentBytes = 0;  // 常駐管理外（アトラス等）は w*h*4 の概算
+    int refCount = 0;
   };
 
   explicit ResourceSystemAPI(BaseSystemAPI* owner);
@@ -71,16 +86,52 @@ public:
   bool IsTextureKeyRegistered(const std::string& name) const;
   const std::vector<AssetLicenseEntry>& GetAssetLicenses() const;
 
+  /// @brief テクスチャ名をハンドルへ解決（生成時に1回だけ呼び、以降はハンドルで参照）
+  /// @details 実際の読み込みは GetTextureByHandle の初回呼び出しまで遅延します。
+  TextureHandle ResolveTextureHandle(const std::string& name);
+  /// @brief ハンドルからテクスチャを取得（配列参照のみ、未読み込みなら読み込む）
+  Texture2D* GetTextureByHandle(TextureHandle handle);
+  /// @brief ハンドルに対応する正規化済みテクスチャキー（ログ用）
+  const std::string& GetTextureHandleKey(TextureHandle handle) const;
+
+  /// @brief テクスチャの描画元矩形を取得（アトラス収録済みならアトラス上の矩形）
+  /// @details キャラクターのシートはロード完了時にアトラスへ詰められるため、
+  ///          GetTexture で単体テクスチャを取ると別途読み込みが発生します。
+  TextureRegion GetTextureRegion(const std::string& name);
+  TextureRegion GetTextureRegionByHandle(TextureHandle handle);
+  size_t GetTextureAtlasCount() const;
+
+  /// @brief シーン/ステージ単位の先読みセットを読み込み、参照を保持する（同名の既存セットは置き換え）
+  /// @details セット内のテクスチャは ReleaseTextureSet まで VRAM 予算による追い出しの対象外です。
+  void PreloadTextureSet(const std::string& setName,
+                         const std::vector<std::string>& textureKeys);
+  /// @brief 先読みセットの参照を外す（すぐには破棄せず、予算超過時に LRU で追い出される）
+  void ReleaseTextureSet(const std::string& setName);
+  void SetTextureBudgetBytes(size_t budgetBytes);
+  TextureResidency::Stats GetTextureResidencyStats() const;
+
   void* GetSound(const std::string& name);
   void* GetMusic(const std::string& name);
 
   void* GetFont(const std::string& name);
   void SetDefaultFont(const std::string& name, int fontSize);
   void* GetDefaultFont() const;
+  /// @brief JSON 内の文字列に現れるグリフを事前にラスタライズ（起動直後の描画時の取りこぼし対策）
+  /// @return 新たにラスタライズしたグリフ数
+  int PrewarmFontGlyphs(const std::string& fontName,
+                        const std::string& jsonDirectory);
+  /// @brief デフォルトフォントの動的グリフアトラスの統計
+  GlyphCache::Stats GetDefaultFontGlyphStats() const;
 
   int ScanResourceFiles();
   bool LoadNextResource(ProgressCallback callback = nullptr);
   bool HasMoreResources() const;
+  /// @brief 次のリソースのデコードが完了しているか（待たずにアップロードできるか）
+  bool IsNextResourceReady() const;
+  /// @brief デコード済みのリソースを予算時間内で順にアップロード（デコード待ちはしない）
+  /// @return 今回処理した件数
+  int LoadReadyResources(double timeBudgetSeconds,
+                         ProgressCallback callback = nullptr);
   LoadProgress GetCurrentProgress() const;
   void ResetLoadingState();
 
@@ -91,12 +142,25 @@ private:
                      const std::vector<std::string>& extensions);
   void ScanDirectoryRecursive(const std::string& dirPath, ResourceType type,
                               const std::vector<std::string>& extensions);
+  /// @brief 一括ロードせずキーだけ登録する（初回の GetTexture で読み込む）
+  void RegisterLazyTextures(const std::string& dirPath,
+                            const std::vector<std::string>& extensions);
   void ScanAssetLicenses();
   void LoadFont(const std::string& path, const std::string& name);
-  void LoadTexture(const std::string& path, const std::string& name);
-  void LoadSound(const std::string& path, const std::string& name);
+  void LoadTexture(const std::string& path, const std::string& name,
+                   Image* decoded = nullptr);
+  void LoadSound(const std::string& path, const std::string& name,
+                 Wave* decoded = nullptr);
   void LoadJson(const std::string& path, const std::string& name);
   Texture2D CreatePlaceholderTexture(const std::string& name);
+  /// @brief アトラス構築を1ステップ進める（パック / 1ページの合成と転送 / 仕上げ）
+  /// @return まだ残りのステップがあれば true
+  bool BuildNextTextureAtlasStep();
+  bool HasPendingTextureAtlasWork() const;
+  /// @brief 進捗表示用のアトラス構築ステップ総数（完了済みを含む）
+  int GetTextureAtlasStepTotal() const;
+  /// @brief アトラス構築の途中状態と進捗を破棄する（読み込みをやり直すとき）
+  void ResetTextureAtlasBuild();
 };
 
 } // namespace core
@@ -2,10 +2,13 @@
 
 // 標準ライブラリ
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 // プロジェクト内
 #include "../config/GameState.hpp"
+#include "../config/RenderTypes.hpp"
 
 namespace game {
 namespace core {
@@ -50,9 +53,19 @@ public:
     bool HasActiveOverlay() const;
     bool IsOverlayActive(OverlayState state) const;
     IOverlay* GetTopOverlay() const;
+    /// @brief 閉じたオーバーレイの再利用プールを keep 件まで減らす（シーン遷移時に CleanupState から呼ぶ）
+    void TrimOverlayPool(size_t keep = 0);
+
+    /// @brief 背面キャッシュを次の描画で取り直す（最上層の操作で背面の見た目が変わったときなど）
+    void InvalidateBackdrop() { backdropValid_ = false; }
+    /// @brief 背面キャッシュの使用可否（無効時は毎フレーム全層を描画）
+    void SetBackdropCacheEnabled(bool enabled);
+    bool IsBackdropCacheEnabled() const { return backdropCacheEnabled_; }
 
 private:
     static constexpr size_t kSceneCount = static_cast<size_t>(GameState::Count);
+    // シーン遷移時にプールへ残す閉じたオーバーレイの数
+    static constexpr size_t kOverlayPoolKeepAcrossScenes = 2;
 
     static size_t ToIndex(GameState state) {
         return static_cast<size_t>(state);
@@ -62,12 +75,28 @@ private:
         return ToIndex(state) < kSceneCount;
     }
 
+    /// @brief シーンと stack_[0, overlayCount) を backdrop_ へ描き込む
+    bool CaptureBackdrop(GameState state, IScene* scene, size_t overlayCount);
+    void DrawBackdrop();
+    void ReleaseBackdrop();
+    /// @brief 半透明オーバーレイの背面をキャッシュで描く状態か（このあいだシーンは更新しない）
+    bool IsSceneBehindBackdrop() const;
+    /// @brief 常駐テクスチャが VRAM 予算の9割以上か（オーバーレイのプールを手放す目安）
+    bool IsTextureMemoryTight() const;
+
     BaseSystemAPI* systemAPI_;
     UISystemAPI* uiAPI_;
     SharedContext* sharedContext_;
     std::unique_ptr<OverlayManager> overlayManager_;
     std::array<IScene*, kSceneCount> scenes_;
     GameState lastNonEditorState_ = GameState::Home;
+
+    // 背面キャッシュ（オーバーレイ表示中はシーンと最上層より奥が更新されないため1枚に焼いて使い回す）
+    RenderTexture2D backdrop_{};
+    bool backdropValid_ = false;
+    bool backdropCacheEnabled_ = true;
+    GameState backdropState_ = GameState::Initializing;
+    uint64_t backdropStackRevision_ = 0;
 };
 
 } // namespace core
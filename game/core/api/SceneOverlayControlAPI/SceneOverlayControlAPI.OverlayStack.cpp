@@ -40,5 +40,11 @@ IOverlay* SceneOverlayControlAPI::GetTopOverlay() const {
     return overlayManager_ ? overlayManager_->GetTopOverlay() : nullptr;
 }
 
+void SceneOverlayControlAPI::TrimOverlayPool(size_t keep) {
+    if (overlayManager_) {
+        overlayManager_->TrimPool(keep);
+    }
+}
+
 } // namespace core
 } // namespace game
@@ -1,16 +1,23 @@
 #include "../SceneOverlayControlAPI.hpp"
 
+// 外部ライブラリ
+#include <raylib.h>
+#include <rlgl.h>
+
 // プロジェクト内
 #include "../../../utils/Log.h"
 #include "../../config/SharedContext.hpp"
+#include "../BaseSystemAPI.hpp"
 #include "../DebugUIAPI.hpp"
 #include "../../states/IScene.hpp"
 #include "../../system/OverlayManager.hpp"
+#include "../../system/Profiler.hpp"
 
 namespace game {
 namespace core {
 
 void SceneOverlayControlAPI::Render(GameState state) {
+    PROFILE_SCOPE("SceneOverlayControlAPI::Render");
     if (!sharedContext_ || !overlayManager_) {
         LOG_ERROR("SceneOverlayControlAPI::Render: not initialized");
         return;
@@ -22,10 +29,91 @@ void SceneOverlayControlAPI::Render(GameState state) {
         return;
     }
 
+    const size_t overlayCount = overlayManager_->Count();
+    const size_t topOpaque = overlayManager_->FindTopOpaqueIndex();
+    if (overlayCount == 0) {
+        scene->Render();
+        scene->RenderOverlay();
+    } else if (topOpaque < overlayCount) {
+        // 不透明な全面オーバーレイより奥（シーンを含む）は見えないので描かない
+        overlayManager_->RenderRange(*sharedContext_, topOpaque, overlayCount);
+    } else {
+        // 更新されるのは最上層だけなので、それより奥はスタックが変わるまで同じ絵になる
+        // （シーンも Update で止めている。キャプチャは内部解像度なのでウィンドウサイズには依存しない）
+        const size_t frozenCount = overlayCount - 1;
+        const bool cacheHit = backdropValid_ && backdropState_ == state &&
+                              backdropStackRevision_ == overlayManager_->GetStackRevision();
+        if (backdropCacheEnabled_ && (cacheHit || CaptureBackdrop(state, scene, frozenCount))) {
+            DrawBackdrop();
+        } else {
+            scene->Render();
+            scene->RenderOverlay();
+            overlayManager_->RenderRange(*sharedContext_, 0, frozenCount);
+        }
+        overlayManager_->RenderRange(*sharedContext_, frozenCount, overlayCount);
+    }
+    scene->RenderHUD();
+}
+
+void SceneOverlayControlAPI::SetBackdropCacheEnabled(bool enabled) {
+    backdropCacheEnabled_ = enabled;
+    if (!enabled) {
+        ReleaseBackdrop();
+    }
+}
+
+bool SceneOverlayControlAPI::CaptureBackdrop(GameState state, IScene* scene, size_t overlayCount) {
+    PROFILE_SCOPE("SceneOverlayControlAPI::CaptureBackdrop");
+    if (!systemAPI_) {
+        return false;
+    }
+    auto& render = systemAPI_->Render();
+    if (backdrop_.id == 0) {
+        backdrop_ = LoadRenderTexture(render.GetInternalWidth(), render.GetInternalHeight());
+        if (backdrop_.id == 0) {
+            LOG_WARN("SceneOverlayControlAPI: failed to create backdrop render texture");
+            backdropCacheEnabled_ = false;
+            return false;
+        }
+    }
+
+    render.BeginRenderTarget(backdrop_);
     scene->Render();
     scene->RenderOverlay();
-    overlayManager_->Render(*sharedContext_);
-    scene->RenderHUD();
+    overlayManager_->RenderRange(*sharedContext_, 0, overlayCount);
+    render.EndRenderTarget();
+
+    backdropValid_ = true;
+    backdropState_ = state;
+    backdropStackRevision_ = overlayManager_->GetStackRevision();
+    return true;
+}
+
+bool SceneOverlayControlAPI::IsSceneBehindBackdrop() const {
+    if (!backdropCacheEnabled_ || !overlayManager_) {
+        return false;
+    }
+    const size_t overlayCount = overlayManager_->Count();
+    return overlayCount > 0 && overlayManager_->FindTopOpaqueIndex() >= overlayCount;
+}
+
+void SceneOverlayControlAPI::DrawBackdrop() {
+    const float width = static_cast<float>(backdrop_.texture.width);
+    const float height = static_cast<float>(backdrop_.texture.height);
+    // RenderTexture は上下反転して格納される。アルファも含めてそのまま写すため合成は無効にする
+    rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+    DrawTexturePro(backdrop_.texture, Rectangle{0.0f, 0.0f, width, -height},
+                   Rectangle{0.0f, 0.0f, width, height}, Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+void SceneOverlayControlAPI::ReleaseBackdrop() {
+    if (backdrop_.id != 0) {
+        UnloadRenderTexture(backdrop_);
+        backdrop_ = RenderTexture2D{};
+    }
+    backdropValid_ = false;
 }
 
 void SceneOverlayControlAPI::RenderImGui(GameState state) {
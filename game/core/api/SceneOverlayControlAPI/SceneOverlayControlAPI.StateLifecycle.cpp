@@ -4,6 +4,7 @@
 #include "../../../utils/Log.h"
 #include "../../config/SharedContext.hpp"
 #include "../../states/IScene.hpp"
+#include "../BaseSystemAPI.hpp"
 #include "../BattleProgressAPI.hpp"
 #include "../BattleSetupAPI.hpp"
 #include "../../system/OverlayManager.hpp"
@@ -23,6 +24,9 @@ bool SceneOverlayControlAPI::InitializeState(GameState state) {
         return false;
     }
 
+    // 前のシーンの絵が背面キャッシュに残らないようにする
+    InvalidateBackdrop();
+
     scene->SetSharedContext(sharedContext_);
     if (!scene->Initialize(systemAPI_)) {
         LOG_ERROR("SceneOverlayControlAPI::InitializeState: scene init failed");
@@ -61,6 +65,19 @@ void SceneOverlayControlAPI::CleanupState(GameState state) {
     if (state != GameState::Initializing) {
         overlayManager_->PopAllOverlays();
     }
+    // 閉じたオーバーレイは次のシーンではほぼ使われないため、直近の数件だけ残す。
+    // テクスチャが VRAM 予算近くまで使われているときは全て破棄して空ける
+    TrimOverlayPool(IsTextureMemoryTight() ? 0 : kOverlayPoolKeepAcrossScenes);
+    InvalidateBackdrop();
+}
+
+bool SceneOverlayControlAPI::IsTextureMemoryTight() const {
+    if (!systemAPI_) {
+        return false;
+    }
+    const auto stats = systemAPI_->Resource().GetTextureResidencyStats();
+    return stats.budgetBytes > 0 &&
+           stats.residentBytes >= stats.budgetBytes / 10 * 9;
 }
 
 void SceneOverlayControlAPI::ShutdownAllScenes() {
@@ -79,6 +96,7 @@ void SceneOverlayControlAPI::Shutdown() {
     if (overlayManager_) {
         overlayManager_->Shutdown();
     }
+    ReleaseBackdrop();
 }
 
 } // namespace core
@@ -10,11 +10,13 @@
 #include "../InputSystemAPI.hpp"
 #include "../../states/IScene.hpp"
 #include "../../system/OverlayManager.hpp"
+#include "../../system/Profiler.hpp"
 
 namespace game {
 namespace core {
 
 SceneOverlayUpdateResult SceneOverlayControlAPI::Update(GameState state, float deltaTime) {
+    PROFILE_SCOPE("SceneOverlayControlAPI::Update");
     SceneOverlayUpdateResult result;
     if (!sharedContext_ || !overlayManager_) {
         LOG_ERROR("SceneOverlayControlAPI::Update: not initialized");
@@ -52,7 +54,10 @@ SceneOverlayUpdateResult SceneOverlayControlAPI::Update(GameState state, float d
         return result;
     }
 
-    scene->Update(deltaTime);
+    // 背面をキャッシュで描いている間はシーンを止め、焼いた絵と中身がずれないようにする
+    if (!IsSceneBehindBackdrop()) {
+        scene->Update(deltaTime);
+    }
 
     if (state != GameState::Initializing) {
         overlayManager_->Update(*sharedContext_, deltaTime);
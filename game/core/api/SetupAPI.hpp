@@ -1,8 +1,10 @@
 #pragma once
 
 // 標準ライブラリ
-#include <vector>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 // 外部ライブラリ
 #include <entt/entt.hpp>
@@ -53,6 +55,9 @@ public:
         ecs::components::Faction faction,
         const SpawnOverrides* overrides = nullptr);
 
+    /// @brief スプライトシートのテクスチャハンドルを解決（描画系を持たないヘッドレス時は 0）
+    uint32_t ResolveTextureHandle(const std::string& sheetPath);
+
 private:
     BaseSystemAPI* systemAPI_;
     GameplayDataAPI* gameplayDataAPI_;
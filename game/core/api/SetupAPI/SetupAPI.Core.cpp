@@ -25,7 +25,8 @@ bool SetupAPI::Initialize(BaseSystemAPI* systemAPI,
                           GameplayDataAPI* gameplayDataAPI,
                           ECSystemAPI* ecsAPI,
                           SharedContext* sharedContext) {
-    if (!systemAPI || !ecsAPI || !gameplayDataAPI || !sharedContext) {
+    // systemAPI は描画/リソースを持たないヘッドレス実行（tools/）では null を許容
+    if (!ecsAPI || !gameplayDataAPI || !sharedContext) {
         LOG_ERROR("SetupAPI::Initialize: invalid argument(s)");
         return false;
     }
@@ -2,7 +2,9 @@
 
 // プロジェクト内
 #include "../../../utils/Log.h"
+#include "../BaseSystemAPI.hpp"
 #include "../ECSystemAPI.hpp"
+#include "../GameplayDataAPI.hpp"
 
 namespace game {
 namespace core {
@@ -17,7 +19,31 @@ entt::entity SetupAPI::CreateBattleEntityFromCharacter(
         return entt::null;
     }
 
-    return ecsAPI_->CreateBattleEntityFromCharacter(character, creationData, faction, overrides);
+    const entt::entity entity =
+        ecsAPI_->CreateBattleEntityFromCharacter(character, creationData, faction, overrides);
+
+    if (entity == entt::null) {
+        return entity;
+    }
+
+    // 描画時の文字列検索を避けるため、生成時にテクスチャハンドルを解決しておく
+    if (auto* sprite = ecsAPI_->Try<ecs::components::Sprite>(entity)) {
+        sprite->texture_handle = ResolveTextureHandle(character.move_sprite.sheet_path);
+    }
+    // 戦闘ループが文字列を引かずに済むよう、テンプレートの添字もここで解決する
+    if (gameplayDataAPI_) {
+        if (auto* tmpl = ecsAPI_->Try<ecs::components::TemplateIndex>(entity)) {
+            tmpl->index = gameplayDataAPI_->GetBattleTemplates().FindIndex(character.id);
+        }
+    }
+    return entity;
+}
+
+uint32_t SetupAPI::ResolveTextureHandle(const std::string& sheetPath) {
+    if (!systemAPI_) {
+        return INVALID_TEXTURE_HANDLE;
+    }
+    return systemAPI_->Resource().ResolveTextureHandle(sheetPath);
 }
 
 } // namespace core
@@ -0,0 +1,236 @@
+#include "SoundVoicePool.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+
+// プロジェクト内
+#include "../../utils/Log.h"
+
+namespace game {
+namespace core {
+
+SoundVoicePool::SoundVoicePool()
+    : samples_(1), volume_(1.0f), currentFrame_(1), playOrder_(0) {
+  categoryLimits_.fill(DEFAULT_CATEGORY_LIMIT);
+  categoryActive_.fill(0);
+}
+
+SoundVoicePool::~SoundVoicePool() { Clear(); }
+
+SoundHandle SoundVoicePool::Register(const std::string &name, Sound *source,
+                                     SoundCategory category, int priority,
+                                     int voiceCount) {
+  auto it = handleByName_.find(name);
+  if (it != handleByName_.end()) {
+    return it->second;
+  }
+  if (!source || category == SoundCategory::Count) {
+    return INVALID_SOUND_HANDLE;
+  }
+
+  // 別名で同じ Sound が登録済みならボイスを共有する（同じバッファを二重に鳴らさない）
+  for (SoundHandle handle = 1; handle < samples_.size(); ++handle) {
+    if (samples_[handle].source == source) {
+      handleByName_.emplace(name, handle);
+      return handle;
+    }
+  }
+
+  const SoundHandle handle = static_cast<SoundHandle>(samples_.size());
+  Sample sample;
+  sample.name = name;
+  sample.source = source;
+  sample.category = category;
+  sample.priority = priority;
+  sample.firstVoice = static_cast<uint32_t>(voices_.size());
+  sample.voiceCount = static_cast<uint32_t>(std::max(1, voiceCount));
+
+  // 先頭は元の Sound、残りは波形を共有する別名（再生位置と音量だけを個別に持つ）
+  for (uint32_t i = 0; i < sample.voiceCount; ++i) {
+    Voice voice;
+    voice.sound = (i == 0) ? *source : ::LoadSoundAlias(*source);
+    voice.isAlias = (i != 0);
+    voice.sample = handle;
+    ::SetSoundVolume(voice.sound, volume_);
+    voices_.push_back(voice);
+  }
+  samples_.push_back(std::move(sample));
+  handleByName_.emplace(name, handle);
+  LOG_DEBUG("SoundVoicePool: registered {} ({} voices)", name,
+            samples_[handle].voiceCount);
+  return handle;
+}
+
+SoundHandle SoundVoicePool::Find(const std::string &name) const {
+  auto it = handleByName_.find(name);
+  return it != handleByName_.end() ? it->second : INVALID_SOUND_HANDLE;
+}
+
+bool SoundVoicePool::Play(SoundHandle handle) {
+  if (handle == INVALID_SOUND_HANDLE || handle >= samples_.size()) {
+    return false;
+  }
+  Sample &sample = samples_[handle];
+  if (sample.lastPlayedFrame == currentFrame_) {
+    ++stats_.dedupHits;
+    return true;
+  }
+
+  // 自分のボイスの空きを探す（なければ自分の中で最も古いボイスを鳴らし直す）
+  Voice *chosen = nullptr;
+  Voice *oldestOwn = nullptr;
+  for (uint32_t i = 0; i < sample.voiceCount; ++i) {
+    Voice &voice = voices_[sample.firstVoice + i];
+    if (!voice.active) {
+      chosen = &voice;
+      break;
+    }
+    if (!oldestOwn || voice.startedOrder < oldestOwn->startedOrder) {
+      oldestOwn = &voice;
+    }
+  }
+
+  if (chosen) {
+    // 新たにボイスを増やす場合だけ分類の上限を確認する
+    const size_t category = CategoryIndex(sample.category);
+    if (categoryActive_[category] >= categoryLimits_[category]) {
+      Voice *victim = FindVictim(sample.category, sample.priority);
+      if (!victim) {
+        ++stats_.rejected;
+        return false;
+      }
+      StopVoice(*victim);
+      ++stats_.steals;
+    }
+  } else {
+    StopVoice(*oldestOwn);
+    ++stats_.steals;
+    chosen = oldestOwn;
+  }
+
+  StartVoice(*chosen);
+  sample.lastPlayedFrame = currentFrame_;
+  ++stats_.plays;
+  return true;
+}
+
+void SoundVoicePool::Stop(SoundHandle handle) {
+  if (handle == INVALID_SOUND_HANDLE || handle >= samples_.size()) {
+    return;
+  }
+  const Sample &sample = samples_[handle];
+  for (uint32_t i = 0; i < sample.voiceCount; ++i) {
+    StopVoice(voices_[sample.firstVoice + i]);
+  }
+}
+
+void SoundVoicePool::StopAll() {
+  for (Voice &voice : voices_) {
+    StopVoice(voice);
+  }
+}
+
+bool SoundVoicePool::IsPlaying(SoundHandle handle) const {
+  if (handle == INVALID_SOUND_HANDLE || handle >= samples_.size()) {
+    return false;
+  }
+  const Sample &sample = samples_[handle];
+  for (uint32_t i = 0; i < sample.voiceCount; ++i) {
+    const Voice &voice = voices_[sample.firstVoice + i];
+    if (voice.active && ::IsSoundPlaying(voice.sound)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SoundVoicePool::Update() {
+  for (Voice &voice : voices_) {
+    if (voice.active && !::IsSoundPlaying(voice.sound)) {
+      voice.active = false;
+      --categoryActive_[CategoryIndex(samples_[voice.sample].category)];
+    }
+  }
+  ++currentFrame_;
+}
+
+void SoundVoicePool::SetVolume(float volume) {
+  volume_ = volume;
+  for (Voice &voice : voices_) {
+    ::SetSoundVolume(voice.sound, volume_);
+  }
+}
+
+void SoundVoicePool::SetCategoryLimit(SoundCategory category, int maxVoices) {
+  if (category == SoundCategory::Count) {
+    return;
+  }
+  categoryLimits_[CategoryIndex(category)] = std::max(1, maxVoices);
+}
+
+void SoundVoicePool::Clear() {
+  StopAll();
+  for (Voice &voice : voices_) {
+    if (voice.isAlias) {
+      ::UnloadSoundAlias(voice.sound);
+    }
+  }
+  voices_.clear();
+  samples_.resize(1);
+  handleByName_.clear();
+  categoryActive_.fill(0);
+}
+
+SoundVoicePool::Stats SoundVoicePool::GetStats() const {
+  Stats stats = stats_;
+  stats.sounds = static_cast<int>(samples_.size()) - 1;
+  stats.voices = static_cast<int>(voices_.size());
+  for (const Voice &voice : voices_) {
+    if (voice.active) {
+      ++stats.activeVoices;
+    }
+  }
+  return stats;
+}
+
+void SoundVoicePool::StartVoice(Voice &voice) {
+  ::SetSoundVolume(voice.sound, volume_);
+  ::PlaySound(voice.sound);
+  voice.active = true;
+  voice.startedOrder = ++playOrder_;
+  ++categoryActive_[CategoryIndex(samples_[voice.sample].category)];
+}
+
+void SoundVoicePool::StopVoice(Voice &voice) {
+  if (!voice.active) {
+    return;
+  }
+  ::StopSound(voice.sound);
+  voice.active = false;
+  --categoryActive_[CategoryIndex(samples_[voice.sample].category)];
+}
+
+SoundVoicePool::Voice *SoundVoicePool::FindVictim(SoundCategory category,
+                                                  int priority) {
+  Voice *victim = nullptr;
+  int victimPriority = 0;
+  for (Voice &voice : voices_) {
+    if (!voice.active) {
+      continue;
+    }
+    const Sample &owner = samples_[voice.sample];
+    if (owner.category != category || owner.priority > priority) {
+      continue;
+    }
+    if (!victim || owner.priority < victimPriority ||
+        (owner.priority == victimPriority &&
+         voice.startedOrder < victim->startedOrder)) {
+      victim = &voice;
+      victimPriority = owner.priority;
+    }
+  }
+  return victim;
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,124 @@
+#pragma once
+
+// 標準ライブラリ
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief 効果音ハンドル（SoundVoicePool 内のテーブル添字、0 は無効）
+using SoundHandle = uint32_t;
+constexpr SoundHandle INVALID_SOUND_HANDLE = 0;
+
+/// @brief 効果音の分類（分類ごとに同時発音数の上限を持つ）
+enum class SoundCategory : uint8_t {
+  UI,
+  Battle,
+  System,
+  Count
+};
+
+/// @brief 効果音のボイスプール
+///
+/// 効果音は登録時に整数ハンドルへ解決し、再生時は配列参照だけで済ませます。
+/// 1つの効果音につき N 個のボイス（先頭は元の Sound、残りは LoadSoundAlias の別名）を持つため、
+/// 連打しても前の音を途中で切りません。分類ごとの同時発音数が上限に達した場合は、
+/// 優先度が低い順・開始の古い順にボイスを奪い、奪えるものがなければ再生しません。
+/// 同じ効果音を同じフレームに複数回再生した場合は最初の1回だけ鳴らします。
+class SoundVoicePool {
+public:
+  static constexpr int DEFAULT_VOICES_PER_SOUND = 4;
+  static constexpr int DEFAULT_CATEGORY_LIMIT = 8;
+
+  struct Stats {
+    int sounds = 0;
+    int voices = 0;
+    int activeVoices = 0;
+    uint64_t plays = 0;
+    uint64_t steals = 0;     // 上限超過で止めたボイス数
+    uint64_t dedupHits = 0;  // 同一フレームの重複として捨てた再生要求
+    uint64_t rejected = 0;   // 奪えるボイスがなく鳴らさなかった再生要求
+  };
+
+  SoundVoicePool();
+  ~SoundVoicePool();
+
+  SoundVoicePool(const SoundVoicePool &) = delete;
+  SoundVoicePool &operator=(const SoundVoicePool &) = delete;
+
+  /// @brief 効果音を登録してハンドルを返す（登録済みの名前なら既存のハンドル）
+  /// @param source 元の Sound（所有しない。Clear() より後まで生存していること）
+  /// @param priority 大きいほど他の音に奪われにくい
+  SoundHandle Register(const std::string &name, Sound *source,
+                       SoundCategory category, int priority = 0,
+                       int voiceCount = DEFAULT_VOICES_PER_SOUND);
+  /// @brief 名前からハンドルを取得（未登録なら INVALID_SOUND_HANDLE）
+  SoundHandle Find(const std::string &name) const;
+
+  /// @brief 空いているボイスで再生（同一フレームの重複は再生済みとして true）
+  bool Play(SoundHandle handle);
+  void Stop(SoundHandle handle);
+  void StopAll();
+  bool IsPlaying(SoundHandle handle) const;
+
+  /// @brief フレーム境界（再生が終わったボイスを回収し、重複判定をリセット）
+  void Update();
+
+  /// @brief 全ボイスの音量（master * SE）
+  void SetVolume(float volume);
+  void SetCategoryLimit(SoundCategory category, int maxVoices);
+
+  /// @brief 全ボイスを止めて別名を破棄（元の Sound より先に呼ぶ）
+  void Clear();
+
+  Stats GetStats() const;
+
+private:
+  struct Sample {
+    std::string name;
+    const Sound *source = nullptr;  // 登録元（別名で同じ Sound を登録したときの共有判定用）
+    SoundCategory category = SoundCategory::UI;
+    int priority = 0;
+    uint32_t firstVoice = 0;
+    uint32_t voiceCount = 0;
+    uint64_t lastPlayedFrame = 0;
+  };
+
+  struct Voice {
+    Sound sound{};
+    SoundHandle sample = INVALID_SOUND_HANDLE;
+    bool isAlias = false;
+    bool active = false;
+    uint64_t startedOrder = 0;  // 再生開始順（小さいほど古い）
+  };
+
+  static size_t CategoryIndex(SoundCategory category) {
+    return static_cast<size_t>(category);
+  }
+  void StartVoice(Voice &voice);
+  void StopVoice(Voice &voice);
+  /// @brief 分類内で奪うボイス（priority 以下で最も優先度が低く古いもの、なければ nullptr）
+  Voice *FindVictim(SoundCategory category, int priority);
+
+  // 添字 0 は無効ハンドル用の番兵
+  std::vector<Sample> samples_;
+  std::vector<Voice> voices_;
+  std::unordered_map<std::string, SoundHandle> handleByName_;
+  std::array<int, static_cast<size_t>(SoundCategory::Count)> categoryLimits_;
+  std::array<int, static_cast<size_t>(SoundCategory::Count)> categoryActive_;
+  float volume_;
+  uint64_t currentFrame_;
+  uint64_t playOrder_;
+  Stats stats_;
+};
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,221 @@
+#include "TextLayoutCache.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+namespace game {
+namespace core {
+
+namespace {
+
+uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+uint64_t FloatBits(float value) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+/// @brief raylib の MeasureTextEx と同じ規則のグリフ送り幅（スケール前）
+float GlyphAdvance(const Font &font, int codepoint) {
+  const int index = GetGlyphIndex(font, codepoint);
+  const GlyphInfo &glyph = font.glyphs[index];
+  return (glyph.advanceX != 0)
+             ? static_cast<float>(glyph.advanceX)
+             : font.recs[index].width + static_cast<float>(glyph.offsetX);
+}
+
+} // namespace
+
+TextLayoutCache::TextLayoutCache(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)) {}
+
+uint64_t TextLayoutCache::HashKey(const void *fontKey, const std::string &text,
+                                  float fontSize, float spacing,
+                                  float wrapWidth) {
+  uint64_t hash = std::hash<std::string_view>{}(text);
+  hash = HashCombine(hash, reinterpret_cast<uintptr_t>(fontKey));
+  hash = HashCombine(hash, FloatBits(fontSize));
+  hash = HashCombine(hash, FloatBits(spacing));
+  hash = HashCombine(hash, FloatBits(wrapWidth));
+  return hash;
+}
+
+bool TextLayoutCache::Matches(const Entry &entry, const void *fontKey,
+                              const std::string &text, float fontSize,
+                              float spacing, float wrapWidth) {
+  const Key &key = entry.key;
+  return key.font == fontKey && key.fontSize == fontSize &&
+         key.spacing == spacing && key.wrapWidth == wrapWidth &&
+         key.text == text;
+}
+
+TextLayoutCache::EntryList::iterator
+TextLayoutCache::Lookup(uint64_t hash, const void *fontKey,
+                        const std::string &text, float fontSize, float spacing,
+                        float wrapWidth) {
+  auto range = index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (Matches(*it->second, fontKey, text, fontSize, spacing, wrapWidth)) {
+      return it->second;
+    }
+  }
+  return entries_.end();
+}
+
+const TextLayout *TextLayoutCache::Find(const void *fontKey,
+                                        const std::string &text,
+                                        float fontSize, float spacing,
+                                        float wrapWidth) {
+  if (wrapWidth <= 0.0f) {
+    wrapWidth = 0.0f;
+  }
+  const uint64_t hash = HashKey(fontKey, text, fontSize, spacing, wrapWidth);
+  auto it = Lookup(hash, fontKey, text, fontSize, spacing, wrapWidth);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, it);
+  ++stats_.hits;
+  return &it->layout;
+}
+
+const TextLayout &TextLayoutCache::Get(const void *fontKey, const Font &font,
+                                       const std::string &text, float fontSize,
+                                       float spacing, float wrapWidth) {
+  if (wrapWidth <= 0.0f) {
+    wrapWidth = 0.0f;
+  }
+  const uint64_t hash = HashKey(fontKey, text, fontSize, spacing, wrapWidth);
+  auto it = Lookup(hash, fontKey, text, fontSize, spacing, wrapWidth);
+  if (it != entries_.end()) {
+    entries_.splice(entries_.begin(), entries_, it);
+    ++stats_.hits;
+    return it->layout;
+  }
+
+  ++stats_.misses;
+  entries_.emplace_front();
+  Entry &entry = entries_.front();
+  entry.key.font = fontKey;
+  entry.key.fontSize = fontSize;
+  entry.key.spacing = spacing;
+  entry.key.wrapWidth = wrapWidth;
+  entry.key.text = text;
+  entry.hash = hash;
+  Build(entry.layout, font, text, fontSize, spacing, wrapWidth);
+  index_.emplace(hash, entries_.begin());
+  EvictOverflow();
+  return entry.layout;
+}
+
+void TextLayoutCache::Build(TextLayout &layout, const Font &font,
+                            const std::string &text, float fontSize,
+                            float spacing, float wrapWidth) {
+  layout = TextLayout{};
+  layout.fontSize = fontSize;
+  layout.spacing = spacing;
+  if (text.empty() || font.glyphs == nullptr || font.baseSize == 0) {
+    return;
+  }
+
+  const float scale = fontSize / static_cast<float>(font.baseSize);
+  layout.codepoints.reserve(text.size());
+
+  TextLayout::Line line;
+  float lineAdvance = 0.0f;
+  float maxAdvance = 0.0f;
+  uint32_t maxCount = 0;
+
+  auto lineWidth = [spacing](uint32_t count, float advance) {
+    return (count > 0) ? advance + static_cast<float>(count - 1) * spacing
+                       : 0.0f;
+  };
+  auto finishLine = [&]() {
+    line.width = lineWidth(line.count, lineAdvance);
+    layout.lines.push_back(line);
+    maxAdvance = std::max(maxAdvance, lineAdvance);
+    maxCount = std::max(maxCount, line.count);
+    layout.codepoints.push_back('\n');
+    line = TextLayout::Line{};
+    line.first = static_cast<uint32_t>(layout.codepoints.size());
+    lineAdvance = 0.0f;
+  };
+
+  const char *cursor = text.c_str();
+  const char *end = cursor + text.size();
+  while (cursor < end) {
+    int bytes = 0;
+    const int codepoint = GetCodepointNext(cursor, &bytes);
+    cursor += std::max(bytes, 1);
+
+    if (codepoint == '\n') {
+      finishLine();
+      continue;
+    }
+
+    const float advance = GlyphAdvance(font, codepoint) * scale;
+    if (wrapWidth > 0.0f && line.count > 0 &&
+        lineWidth(line.count + 1, lineAdvance + advance) > wrapWidth) {
+      finishLine();
+    }
+    layout.codepoints.push_back(codepoint);
+    layout.glyphs.push_back(codepoint);
+    ++line.count;
+    lineAdvance += advance;
+  }
+
+  // 最終行（末尾が改行なら空行）。raylib と同じく行数ぶんの高さを持つ
+  line.width = lineWidth(line.count, lineAdvance);
+  layout.lines.push_back(line);
+  maxAdvance = std::max(maxAdvance, lineAdvance);
+  maxCount = std::max(maxCount, line.count);
+
+  std::sort(layout.glyphs.begin(), layout.glyphs.end());
+  layout.glyphs.erase(std::unique(layout.glyphs.begin(), layout.glyphs.end()),
+                      layout.glyphs.end());
+
+  const float lineCount = static_cast<float>(layout.lines.size());
+  layout.size.x = lineWidth(maxCount, maxAdvance);
+  layout.size.y = lineCount * fontSize + (lineCount - 1.0f) * LINE_SPACING;
+}
+
+void TextLayoutCache::EvictOverflow() {
+  while (entries_.size() > capacity_) {
+    auto last = std::prev(entries_.end());
+    auto range = index_.equal_range(last->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == last) {
+        index_.erase(it);
+        break;
+      }
+    }
+    entries_.pop_back();
+    ++stats_.evictions;
+  }
+}
+
+void TextLayoutCache::Clear() {
+  entries_.clear();
+  index_.clear();
+}
+
+void TextLayoutCache::SetCapacity(size_t capacity) {
+  capacity_ = std::max<size_t>(capacity, 1);
+  EvictOverflow();
+}
+
+TextLayoutCache::Stats TextLayoutCache::GetStats() const {
+  Stats stats = stats_;
+  stats.entries = entries_.size();
+  stats.capacity = capacity_;
+  return stats;
+}
+
+} // namespace core
+} // namespace game
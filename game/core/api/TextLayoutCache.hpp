@@ -0,0 +1,113 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief 1つの文字列を特定のフォント・サイズ・折り返し幅で並べた結果
+///
+/// codepoints は折り返し位置に '\n' を挿入済みで、そのまま DrawTextCodepoints に渡すと
+/// DrawTextEx と同じ配置で描画されます。glyphs は描画前にアトラスへ載せるべき重複なしの一覧です。
+struct TextLayout {
+  struct Line {
+    uint32_t first = 0;  // codepoints 内の開始位置
+    uint32_t count = 0;  // '\n' を含まない文字数
+    float width = 0.0f;
+  };
+
+  std::vector<int> codepoints;
+  std::vector<int> glyphs;
+  std::vector<Line> lines;
+  Vector2 size{0.0f, 0.0f};
+  float fontSize = 0.0f;
+  float spacing = 0.0f;
+};
+
+/// @brief 文字列の計測・折り返し結果の LRU キャッシュ
+///
+/// キーは (フォント, サイズ, 字間, 折り返し幅, 文字列)。ヒット時は文字列のハッシュと比較だけで済み、
+/// UTF-8 のデコードやグリフ幅の積算は初回（ミス時）にしか行いません。
+/// 折り返しは文字単位の貪欲法です（日本語の本文を想定し、単語境界は考慮しない）。
+class TextLayoutCache {
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 2048;
+  /// @brief raylib の既定行間（SetTextLineSpacing 未使用時）
+  static constexpr float LINE_SPACING = 2.0f;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t capacity = 0;
+  };
+
+  explicit TextLayoutCache(size_t capacity = DEFAULT_CAPACITY);
+
+  /// @brief レイアウトを取得（無ければ font のグリフ情報から作る）
+  /// @param fontKey フォントの同一性を表すキー（GlyphCache など、グリフ幅が変わらない間は同じ値）
+  /// @param font ミス時の計測に使うフォント（必要なグリフが載っていること）
+  /// @param wrapWidth 0 以下なら折り返さない
+  /// @note 戻り値は次の Get/Clear まで有効
+  const TextLayout &Get(const void *fontKey, const Font &font,
+                        const std::string &text, float fontSize, float spacing,
+                        float wrapWidth);
+
+  /// @brief ミス時に font を用意する手間を省くための事前確認
+  const TextLayout *Find(const void *fontKey, const std::string &text,
+                         float fontSize, float spacing, float wrapWidth);
+
+  void Clear();
+  void SetCapacity(size_t capacity);
+
+  Stats GetStats() const;
+
+private:
+  struct Key {
+    const void *font = nullptr;
+    float fontSize = 0.0f;
+    float spacing = 0.0f;
+    float wrapWidth = 0.0f;
+    std::string text;
+  };
+
+  struct Entry {
+    Key key;
+    uint64_t hash = 0;
+    TextLayout layout;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  static uint64_t HashKey(const void *fontKey, const std::string &text,
+                          float fontSize, float spacing, float wrapWidth);
+  static bool Matches(const Entry &entry, const void *fontKey,
+                      const std::string &text, float fontSize, float spacing,
+                      float wrapWidth);
+  static void Build(TextLayout &layout, const Font &font,
+                    const std::string &text, float fontSize, float spacing,
+                    float wrapWidth);
+
+  EntryList::iterator Lookup(uint64_t hash, const void *fontKey,
+                             const std::string &text, float fontSize,
+                             float spacing, float wrapWidth);
+  void EvictOverflow();
+
+  EntryList entries_;  // 先頭ほど最近使われた
+  std::unordered_multimap<uint64_t, EntryList::iterator> index_;
+  size_t capacity_;
+  Stats stats_;
+};
+
+} // namespace core
+} // namespace game
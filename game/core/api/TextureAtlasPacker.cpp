@@ -0,0 +1,104 @@
+#include "TextureAtlasPacker.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <numeric>
+
+namespace game {
+namespace core {
+
+namespace {
+int NextPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+} // namespace
+
+TextureAtlasPacker::TextureAtlasPacker(int maxPageSize, int padding)
+    : maxPageSize_(std::max(1, maxPageSize)),
+      padding_(std::max(0, padding)) {
+}
+
+std::vector<TextureAtlasPacker::Placement> TextureAtlasPacker::Pack(
+    const std::vector<Input>& inputs) {
+    std::vector<Placement> placements(inputs.size());
+    pageSizes_.clear();
+
+    std::vector<size_t> order(inputs.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (inputs[a].height != inputs[b].height) {
+            return inputs[a].height > inputs[b].height;
+        }
+        if (inputs[a].width != inputs[b].width) {
+            return inputs[a].width > inputs[b].width;
+        }
+        return inputs[a].key < inputs[b].key;
+    });
+
+    int page = -1;
+    int cursorX = 0;
+    int cursorY = 0;
+    int rowHeight = 0;
+    int usedWidth = 0;
+    int usedHeight = 0;
+
+    auto closePage = [&]() {
+        if (page >= 0) {
+            pageSizes_.push_back(PageSize{NextPowerOfTwo(usedWidth), NextPowerOfTwo(usedHeight)});
+        }
+    };
+    auto openPage = [&]() {
+        closePage();
+        ++page;
+        cursorX = 0;
+        cursorY = 0;
+        rowHeight = 0;
+        usedWidth = 0;
+        usedHeight = 0;
+    };
+
+    for (size_t index : order) {
+        const Input& in = inputs[index];
+        Placement& out = placements[index];
+        out.key = in.key;
+        out.width = in.width;
+        out.height = in.height;
+
+        const int w = in.width + padding_;
+        const int h = in.height + padding_;
+        if (in.width <= 0 || in.height <= 0 || w > maxPageSize_ || h > maxPageSize_) {
+            continue;  // 単体でページに収まらないものはアトラス対象外
+        }
+
+        if (page < 0) {
+            openPage();
+        }
+        if (cursorX + w > maxPageSize_) {
+            // 次の行へ
+            cursorX = 0;
+            cursorY += rowHeight;
+            rowHeight = 0;
+        }
+        if (cursorY + h > maxPageSize_) {
+            openPage();
+        }
+
+        out.page = page;
+        out.x = cursorX;
+        out.y = cursorY;
+        cursorX += w;
+        rowHeight = std::max(rowHeight, h);
+        usedWidth = std::max(usedWidth, cursorX);
+        usedHeight = std::max(usedHeight, cursorY + rowHeight);
+    }
+    closePage();
+
+    return placements;
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,52 @@
+#pragma once
+
+// 標準ライブラリ
+#include <string>
+#include <vector>
+
+namespace game {
+namespace core {
+
+/// @brief 矩形をシェルフ（行）方式で複数ページのアトラスへ詰める
+///
+/// 高さの降順に並べて左から行に詰め、収まらなければ次の行/次のページへ送ります。
+/// キャラクターのスプライトシートは横長・高さがほぼ揃っているため、この単純な方式で十分詰まります。
+class TextureAtlasPacker {
+public:
+    struct Input {
+        std::string key;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct Placement {
+        std::string key;
+        int page = -1;   // 収まらなかった場合は -1
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct PageSize {
+        int width = 0;
+        int height = 0;
+    };
+
+    TextureAtlasPacker(int maxPageSize, int padding);
+
+    /// @brief 配置を計算（入力順に関係なく結果は決定的）
+    /// @return 入力と同じ順序の配置結果
+    std::vector<Placement> Pack(const std::vector<Input>& inputs);
+
+    /// @brief 各ページの使用サイズ（Pack 後に有効、2の冪に切り上げ）
+    const std::vector<PageSize>& GetPageSizes() const { return pageSizes_; }
+
+private:
+    int maxPageSize_;
+    int padding_;
+    std::vector<PageSize> pageSizes_;
+};
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,281 @@
+#include "TextureResidency.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+
+// プロジェクト内
+#include "../../utils/Log.h"
+
+namespace game {
+namespace core {
+
+namespace {
+
+std::string NormalizeSlashes(std::string s) {
+  std::replace(s.begin(), s.end(), '\\', '/');
+  return s;
+}
+
+/// @brief FNV-1a 64bit（内容の重複判定用。サイズと組で比較する）
+uint64_t HashBytes(const unsigned char *data, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+std::shared_ptr<Texture2D> MakeTexturePtr(const Texture2D &texture) {
+  return std::shared_ptr<Texture2D>(new Texture2D(texture), [](Texture2D *t) {
+    if (t && t->id != 0) {
+      UnloadTexture(*t);
+    }
+    delete t;
+  });
+}
+
+} // namespace
+
+TextureResidency::TextureResidency(size_t budgetBytes)
+    : budgetBytes_(budgetBytes), residentBytes_(0), currentFrame_(1) {}
+
+TextureResidency::~TextureResidency() { Clear(); }
+
+uint32_t TextureResidency::FindPath(const std::string &path) const {
+  auto it = entryByPath_.find(path);
+  return it != entryByPath_.end() ? it->second : NO_ENTRY;
+}
+
+uint32_t TextureResidency::Find(const Texture2D *texture) const {
+  auto it = entryByTexture_.find(texture);
+  return it != entryByTexture_.end() ? it->second : NO_ENTRY;
+}
+
+std::shared_ptr<Texture2D> TextureResidency::Load(const std::string &rawPath,
+                                                  Image *decoded) {
+  auto releaseDecoded = [&]() {
+    if (decoded && decoded->data) {
+      UnloadImage(*decoded);
+      decoded->data = nullptr;
+    }
+  };
+
+  const std::string path = NormalizeSlashes(rawPath);
+  uint32_t index = FindPath(path);
+  if (index != NO_ENTRY) {
+    releaseDecoded();
+    Use(index);
+    return entries_[index].texture;
+  }
+
+  int dataSize = 0;
+  unsigned char *data = LoadFileData(path.c_str(), &dataSize);
+  if (!data || dataSize <= 0) {
+    if (data) {
+      UnloadFileData(data);
+    }
+    releaseDecoded();
+    return nullptr;
+  }
+
+  // 同じ内容のファイルは既存のテクスチャを共有する（アップロードしない）
+  const size_t fileSize = static_cast<size_t>(dataSize);
+  const uint64_t hash = HashBytes(data, fileSize);
+  auto range = entryByHash_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (entries_[it->second].fileSize == fileSize) {
+      UnloadFileData(data);
+      releaseDecoded();
+      index = it->second;
+      entryByPath_.emplace(path, index);
+      ++stats_.dedupHits;
+      LOG_INFO("TextureResidency: {} shares texture with {}", path,
+               entries_[index].path);
+      Use(index);
+      return entries_[index].texture;
+    }
+  }
+
+  Image image{};
+  if (decoded && decoded->data) {
+    image = *decoded;
+    decoded->data = nullptr;
+  } else {
+    const char *ext = GetFileExtension(path.c_str());
+    image = LoadImageFromMemory(ext ? ext : ".png", data, dataSize);
+  }
+  UnloadFileData(data);
+  if (!image.data) {
+    return nullptr;
+  }
+
+  Entry entry;
+  entry.path = path;
+  entry.contentHash = hash;
+  entry.fileSize = fileSize;
+  entry.texture = MakeTexturePtr(Texture2D{});
+  if (!Upload(entry, &image)) {
+    return nullptr;
+  }
+
+  index = static_cast<uint32_t>(entries_.size());
+  entries_.push_back(std::move(entry));
+  Entry &added = entries_.back();
+  entryByPath_.emplace(path, index);
+  entryByTexture_.emplace(added.texture.get(), index);
+  entryByHash_.emplace(hash, index);
+  LOG_INFO("Loaded texture: {} ({:.1f} MB resident)", path,
+           static_cast<double>(residentBytes_) / (1024.0 * 1024.0));
+
+  EnforceBudget();
+  return added.texture;
+}
+
+bool TextureResidency::Upload(Entry &entry, Image *image) {
+  Image loaded{};
+  if (!image) {
+    loaded = ::LoadImage(entry.path.c_str());
+    image = &loaded;
+  }
+  if (!image->data) {
+    return false;
+  }
+  const Texture2D texture = LoadTextureFromImage(*image);
+  UnloadImage(*image);
+  image->data = nullptr;
+  if (texture.id == 0) {
+    return false;
+  }
+
+  // オブジェクトは差し替えず中身だけ書き換える（保持中のポインタを生かす）
+  *entry.texture = texture;
+  entry.bytes = static_cast<size_t>(
+      GetPixelDataSize(texture.width, texture.height, texture.format));
+  entry.lastUsedFrame = currentFrame_;
+  residentBytes_ += entry.bytes;
+  ++stats_.uploads;
+  return true;
+}
+
+void TextureResidency::Evict(Entry &entry) {
+  if (entry.texture->id == 0) {
+    return;
+  }
+  UnloadTexture(*entry.texture);
+  entry.texture->id = 0;
+  residentBytes_ -= std::min(residentBytes_, entry.bytes);
+  ++stats_.evictions;
+  LOG_DEBUG("TextureResidency: evicted {} ({:.1f} MB resident)", entry.path,
+            static_cast<double>(residentBytes_) / (1024.0 * 1024.0));
+}
+
+void TextureResidency::EnforceBudget() {
+  while (residentBytes_ > budgetBytes_) {
+    Entry *victim = nullptr;
+    for (Entry &entry : entries_) {
+      if (entry.texture->id == 0 || entry.refCount > 0 ||
+          entry.lastUsedFrame >= currentFrame_) {
+        continue;
+      }
+      if (!victim || entry.lastUsedFrame < victim->lastUsedFrame) {
+        victim = &entry;
+      }
+    }
+    if (!victim) {
+      break;  // 残りはピン留め中か今フレームで使用中（予算超過を許容）
+    }
+    Evict(*victim);
+  }
+}
+
+void TextureResidency::Use(uint32_t index) {
+  if (index >= entries_.size()) {
+    return;
+  }
+  Entry &entry = entries_[index];
+  entry.lastUsedFrame = currentFrame_;
+  if (entry.texture->id == 0) {
+    if (!Upload(entry, nullptr)) {
+      LOG_WARN("TextureResidency: failed to reload {}", entry.path);
+      return;
+    }
+    EnforceBudget();
+  }
+}
+
+bool TextureResidency::Retain(const std::string &rawPath) {
+  const std::string path = NormalizeSlashes(rawPath);
+  uint32_t index = FindPath(path);
+  if (index == NO_ENTRY) {
+    if (!Load(path)) {
+      return false;
+    }
+    index = FindPath(path);
+  }
+  if (index == NO_ENTRY) {
+    return false;
+  }
+  ++entries_[index].refCount;
+  Use(index);
+  return true;
+}
+
+void TextureResidency::Release(const std::string &rawPath) {
+  const uint32_t index = FindPath(NormalizeSlashes(rawPath));
+  if (index == NO_ENTRY || entries_[index].refCount <= 0) {
+    return;
+  }
+  --entries_[index].refCount;
+  EnforceBudget();
+}
+
+void TextureResidency::AdvanceFrame() { ++currentFrame_; }
+
+void TextureResidency::SetBudgetBytes(size_t budgetBytes) {
+  budgetBytes_ = budgetBytes;
+  EnforceBudget();
+}
+
+void TextureResidency::Clear() {
+  for (Entry &entry : entries_) {
+    Evict(entry);
+  }
+  entries_.clear();
+  entryByPath_.clear();
+  entryByTexture_.clear();
+  entryByHash_.clear();
+  residentBytes_ = 0;
+}
+
+size_t TextureResidency::GetResidentBytes(const Texture2D *texture) const {
+  const uint32_t index = Find(texture);
+  if (index == NO_ENTRY || entries_[index].texture->id == 0) {
+    return 0;
+  }
+  return entries_[index].bytes;
+}
+
+int TextureResidency::GetRefCount(const Texture2D *texture) const {
+  const uint32_t index = Find(texture);
+  return index != NO_ENTRY ? entries_[index].refCount : 0;
+}
+
+TextureResidency::Stats TextureResidency::GetStats() const {
+  Stats stats = stats_;
+  stats.residentBytes = residentBytes_;
+  stats.budgetBytes = budgetBytes_;
+  stats.trackedTextures = static_cast<int>(entries_.size());
+  for (const Entry &entry : entries_) {
+    if (entry.texture->id != 0) {
+      ++stats.residentTextures;
+    }
+    if (entry.refCount > 0) {
+      ++stats.pinnedTextures;
+    }
+  }
+  return stats;
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,101 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief 単体テクスチャの VRAM 常駐管理
+///
+/// ファイル単位でテクスチャを読み込み、内容が同一のファイル（ハッシュとサイズが一致）は1枚を共有します。
+/// 常駐バイト数が予算を超えると、参照カウント0かつ現在のフレームで使われていないものを
+/// 最終使用フレームの古い順（LRU）に GPU から降ろします。降ろしても Texture2D オブジェクトは残り
+/// （id だけ 0 になる）、次に Use() されたときに同じオブジェクトへ読み直すため、保持中のポインタは無効になりません。
+class TextureResidency {
+public:
+  static constexpr size_t DEFAULT_BUDGET_BYTES = 128u * 1024u * 1024u;
+  static constexpr uint32_t NO_ENTRY = UINT32_MAX;
+
+  struct Stats {
+    size_t residentBytes = 0;
+    size_t budgetBytes = 0;
+    int trackedTextures = 0;
+    int residentTextures = 0;
+    int pinnedTextures = 0;
+    uint64_t uploads = 0;
+    uint64_t evictions = 0;
+    uint64_t dedupHits = 0;  // 既存テクスチャを共有したファイル数
+  };
+
+  explicit TextureResidency(size_t budgetBytes = DEFAULT_BUDGET_BYTES);
+  ~TextureResidency();
+
+  TextureResidency(const TextureResidency &) = delete;
+  TextureResidency &operator=(const TextureResidency &) = delete;
+
+  /// @brief path のテクスチャを取得（未読み込みなら読み込み、退避中なら読み直す）
+  /// @param decoded 先行デコード済みの画像（所有権を受け取り解放する）
+  /// @return 読み込めなければ nullptr
+  std::shared_ptr<Texture2D> Load(const std::string &path, Image *decoded = nullptr);
+
+  /// @brief テクスチャに対応するエントリ（管理外なら NO_ENTRY）
+  uint32_t Find(const Texture2D *texture) const;
+
+  /// @brief 使用を記録し、退避中なら読み直す
+  void Use(uint32_t index);
+  void Use(const Texture2D *texture) { Use(Find(texture)); }
+
+  /// @brief 参照カウントを増やす（0 より大きい間は追い出さない）。未読み込みなら読み込む
+  bool Retain(const std::string &path);
+  void Release(const std::string &path);
+
+  /// @brief フレーム境界（このフレームで使ったテクスチャは追い出し対象にしない）
+  void AdvanceFrame();
+
+  void SetBudgetBytes(size_t budgetBytes);
+  /// @brief 全テクスチャを破棄
+  void Clear();
+
+  /// @brief 常駐中のバイト数（管理外なら 0）
+  size_t GetResidentBytes(const Texture2D *texture) const;
+  int GetRefCount(const Texture2D *texture) const;
+
+  Stats GetStats() const;
+
+private:
+  struct Entry {
+    std::string path;  // 読み直しに使うファイル（共有元）
+    uint64_t contentHash = 0;
+    size_t fileSize = 0;
+    std::shared_ptr<Texture2D> texture;  // 退避中は id == 0
+    size_t bytes = 0;
+    int refCount = 0;
+    uint64_t lastUsedFrame = 0;
+  };
+
+  uint32_t FindPath(const std::string &path) const;
+  bool Upload(Entry &entry, Image *decoded);
+  void Evict(Entry &entry);
+  void EnforceBudget();
+
+  std::vector<Entry> entries_;
+  std::unordered_map<std::string, uint32_t> entryByPath_;
+  std::unordered_map<const Texture2D *, uint32_t> entryByTexture_;
+  std::unordered_multimap<uint64_t, uint32_t> entryByHash_;
+  size_t budgetBytes_;
+  size_t residentBytes_;
+  uint64_t currentFrame_;
+  Stats stats_;
+};
+
+} // namespace core
+} // namespace game
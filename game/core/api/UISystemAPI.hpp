@@ -109,8 +109,7 @@ public:
                           bool isHovered = false, bool isDisabled = false) const;
     float CalculatePulseAlpha(float time, float period = 1.5f,
                               float minAlpha = 0.8f, float maxAlpha = 1.0f) const;
-    void DrawParticles(float time, float areaX, float areaY, float areaW, float areaH,
-                       int count = 15) const;
+    void DrawParticles(const game::ParticlePool& pool) const;
 
 private:
     BaseSystemAPI* systemAPI_;
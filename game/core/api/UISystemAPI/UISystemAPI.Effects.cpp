@@ -34,12 +34,11 @@ float UISystemAPI::CalculatePulseAlpha(float time, float period,
     return ui::UIEffects::CalculatePulseAlpha(time, period, minAlpha, maxAlpha);
 }
 
-void UISystemAPI::DrawParticles(float time, float areaX, float areaY,
-                                float areaW, float areaH, int count) const {
+void UISystemAPI::DrawParticles(const game::ParticlePool& pool) const {
     if (!systemAPI_) {
         return;
     }
-    ui::UIEffects::DrawParticles(systemAPI_, time, areaX, areaY, areaW, areaH, count);
+    ui::UIEffects::DrawParticles(systemAPI_, pool);
 }
 
 } // namespace core
@@ -7,7 +7,9 @@ namespace core {
 namespace ecs {
 namespace components {
 
-/// @brief キャラクターIDコンポーネント（参照用）
+/// @brief キャラクターIDコンポーネント（参照用、コールド）
+///
+/// UI・エディタ・デバッグ表示向けです。戦闘ループは TemplateIndex でテンプレートを引きます。
 struct CharacterId {
     std::string id = "";  // キャラクターID（CharacterManagerのマスターデータ参照用）
 
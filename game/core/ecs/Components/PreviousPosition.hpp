@@ -0,0 +1,23 @@
+#pragma once
+
+namespace game {
+namespace core {
+namespace ecs {
+namespace components {
+
+/// @brief 直前の固定ティック開始時点の位置（描画補間用、POD）
+///
+/// 戦闘の固定ステップ更新の直前に Position から写し取られ、
+/// 描画側は Previous → Position を補間係数で線形補間します。
+struct PreviousPosition {
+    float x = 0.0f;
+    float y = 0.0f;
+
+    PreviousPosition() = default;
+    PreviousPosition(float x, float y) : x(x), y(y) {}
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace core
+} // namespace game
@@ -1,21 +1,24 @@
 #pragma once
 
-#include <string>
+#include <cstdint>
 
 namespace game {
 namespace core {
 namespace ecs {
 namespace components {
 
-/// @brief スプライトコンポーネント
+/// @brief スプライトコンポーネント（POD）
+///
+/// 戦闘ループと描画が毎フレーム読む寸法とテクスチャハンドルだけを持ちます。
+/// シートのパス（文字列）は SpriteSource に分けてあります。
 struct Sprite {
-    std::string sheet_path = "";  // スプライトシートパス
     int frame_width = 0;          // 1フレームの幅
     int frame_height = 0;         // 1フレームの高さ
+    uint32_t texture_handle = 0;  // ResourceSystemAPI のテクスチャハンドル（0=未解決）
 
     Sprite() = default;
-    Sprite(const std::string& path, int width, int height)
-        : sheet_path(path), frame_width(width), frame_height(height) {}
+    Sprite(int width, int height, uint32_t handle = 0)
+        : frame_width(width), frame_height(height), texture_handle(handle) {}
 };
 
 } // namespace components
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+namespace game {
+namespace core {
+namespace ecs {
+namespace components {
+
+/// @brief 生成時のスプライトシートパス（コールド）
+///
+/// Sprite::texture_handle が未解決のエンティティを描画時に解決するときと、
+/// エディタ・デバッグ表示だけが参照します。戦闘ループからは触りません。
+struct SpriteSource {
+    std::string sheet_path = "";
+
+    SpriteSource() = default;
+    SpriteSource(const std::string& path) : sheet_path(path) {}
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace core
+} // namespace game
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace game {
+namespace core {
+namespace ecs {
+namespace components {
+
+/// @brief BattleTemplateTable の添字（POD）
+///
+/// 戦闘ループは CharacterId の文字列ではなくこの添字でテンプレートを引きます。
+/// テンプレート表を持たない経路で生成された場合は -1（未解決）のままです。
+struct TemplateIndex {
+    int index = -1;
+
+    TemplateIndex() = default;
+    explicit TemplateIndex(int templateIndex) : index(templateIndex) {}
+
+    bool IsValid() const { return index >= 0; }
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace core
+} // namespace game
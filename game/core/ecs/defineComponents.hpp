@@ -7,13 +7,16 @@
 
 // コンポEネントインクルーチE
 #include "components/Position.hpp"
+#include "components/PreviousPosition.hpp"
 #include "components/Health.hpp"
 #include "components/Stats.hpp"
 #include "components/Movement.hpp"
 #include "components/Combat.hpp"
 #include "components/Sprite.hpp"
+#include "components/SpriteSource.hpp"
 #include "components/Animation.hpp"
 #include "components/CharacterId.hpp"
+#include "components/TemplateIndex.hpp"
 #include "components/Team.hpp"
 #include "components/Equipment.hpp"
 #include "components/PassiveSkills.hpp"
@@ -0,0 +1,79 @@
+#include "BattleTemplateTable.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+
+namespace game {
+namespace core {
+namespace entities {
+
+void BattleTemplateTable::Build(const std::unordered_map<std::string, Character>& masters) {
+    Clear();
+    templates_.reserve(masters.size());
+    indexById_.reserve(masters.size());
+
+    // unordered_map の走査順に依存しないよう ID 順で添字を振る
+    std::vector<const Character*> ordered;
+    ordered.reserve(masters.size());
+    for (const auto& [id, character] : masters) {
+        ordered.push_back(&character);
+    }
+    std::sort(ordered.begin(), ordered.end(),
+              [](const Character* a, const Character* b) { return a->id < b->id; });
+
+    std::unordered_map<std::string, uint32_t> sheetIds;
+    for (const Character* character : ordered) {
+        BattleTemplate entry;
+        entry.source = character;
+        entry.hp = character->GetTotalHP();
+        entry.attack = character->GetTotalAttack();
+        entry.defense = character->GetTotalDefense();
+        entry.moveSpeed = character->move_speed;
+        entry.attackSpan = character->attack_span;
+        entry.attackHitTime = character->attack_hit_time;
+        entry.attackSize = character->attack_size;
+        entry.cost = character->cost;
+        entry.moveSprite = MakeSprite(character->move_sprite, sheetIds);
+        entry.attackSprite = MakeSprite(character->attack_sprite, sheetIds);
+
+        indexById_.emplace(character->id, static_cast<int>(templates_.size()));
+        templates_.push_back(entry);
+    }
+}
+
+void BattleTemplateTable::Clear() {
+    templates_.clear();
+    indexById_.clear();
+    sheetPaths_.clear();
+}
+
+int BattleTemplateTable::FindIndex(const std::string& characterId) const {
+    const auto it = indexById_.find(characterId);
+    return (it != indexById_.end()) ? it->second : INVALID_INDEX;
+}
+
+const BattleTemplate* BattleTemplateTable::Find(const std::string& characterId) const {
+    const int index = FindIndex(characterId);
+    return (index != INVALID_INDEX) ? &templates_[static_cast<size_t>(index)] : nullptr;
+}
+
+BattleTemplate::Sprite BattleTemplateTable::MakeSprite(
+    const Character::SpriteInfo& info,
+    std::unordered_map<std::string, uint32_t>& sheetIds) {
+    BattleTemplate::Sprite sprite;
+    auto it = sheetIds.find(info.sheet_path);
+    if (it == sheetIds.end()) {
+        it = sheetIds.emplace(info.sheet_path, static_cast<uint32_t>(sheetPaths_.size())).first;
+        sheetPaths_.push_back(info.sheet_path);
+    }
+    sprite.sheetId = it->second;
+    sprite.frameWidth = info.frame_width;
+    sprite.frameHeight = info.frame_height;
+    sprite.frameCount = std::max(1, info.frame_count);
+    sprite.frameDuration = std::max(0.01f, info.frame_duration);
+    return sprite;
+}
+
+} // namespace entities
+} // namespace core
+} // namespace game
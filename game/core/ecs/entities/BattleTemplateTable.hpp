@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Character.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace game {
+namespace core {
+namespace entities {
+
+/// @brief 戦闘・HUDで毎フレーム参照する項目だけを詰めたキャラクターテンプレート
+///
+/// 数値は装備込みの素ステータス（GetTotal*）で、セーブ依存の強化は含みません。
+/// 名前やアイコンなど文字列は source（CharacterManager 内のマスター）から参照します。
+struct BattleTemplate {
+    struct Sprite {
+        uint32_t sheetId = 0;  // BattleTemplateTable::GetSheetPath() の添字
+        int frameWidth = 0;
+        int frameHeight = 0;
+        int frameCount = 1;
+        float frameDuration = 0.1f;
+    };
+
+    const Character* source = nullptr;
+    int hp = 0;
+    int attack = 0;
+    int defense = 0;
+    float moveSpeed = 0.0f;
+    float attackSpan = 0.0f;
+    float attackHitTime = 0.0f;
+    Vector2 attackSize{0.0f, 0.0f};
+    int cost = 0;
+    Sprite moveSprite;
+    Sprite attackSprite;
+};
+
+/// @brief キャラクターマスターから構築する不変・連続配置のテンプレート表
+///
+/// ID → 密な添字の対応を1度だけ作り、以降の参照は配列読み出しになります。
+/// マスターを差し替えたら Build() し直すこと（source ポインタと添字はそこで無効になる）。
+class BattleTemplateTable {
+public:
+    static constexpr int INVALID_INDEX = -1;
+
+    void Build(const std::unordered_map<std::string, Character>& masters);
+    void Clear();
+
+    /// @brief ID から添字を引く（見つからなければ INVALID_INDEX）
+    int FindIndex(const std::string& characterId) const;
+
+    /// @brief ID からテンプレートを引く（見つからなければ nullptr）
+    const BattleTemplate* Find(const std::string& characterId) const;
+
+    const BattleTemplate& Get(int index) const { return templates_[static_cast<size_t>(index)]; }
+    const std::vector<BattleTemplate>& GetAll() const { return templates_; }
+    size_t Size() const { return templates_.size(); }
+
+    /// @brief Sprite::sheetId に対応するスプライトシートのパス
+    const std::string& GetSheetPath(uint32_t sheetId) const { return sheetPaths_[sheetId]; }
+    size_t GetSheetCount() const { return sheetPaths_.size(); }
+
+private:
+    BattleTemplate::Sprite MakeSprite(const Character::SpriteInfo& info,
+                                      std::unordered_map<std::string, uint32_t>& sheetIds);
+
+    std::vector<BattleTemplate> templates_;
+    std::unordered_map<std::string, int> indexById_;
+    std::vector<std::string> sheetPaths_;
+};
+
+} // namespace entities
+} // namespace core
+} // namespace game
@@ -20,6 +20,7 @@ bool CharacterManager::Initialize(const std::string& json_path) {
     if (!json_path.empty()) {
         // JSON からローチE
         if (CharacterLoader::LoadFromJSON(json_path, masters_)) {
+            battleTemplates_.Build(masters_);
             return true;
         }
         // JSONロード失敗時はハ�Eドコード�E期化にフォールバック
@@ -28,6 +29,7 @@ bool CharacterManager::Initialize(const std::string& json_path) {
 
     // ハ�Eドコード�E期化�E�開発速度優先！E
     CharacterLoader::LoadHardcoded(masters_);
+    battleTemplates_.Build(masters_);
     return true;
 }
 
@@ -44,6 +46,11 @@ std::shared_ptr<Character> CharacterManager::GetCharacterTemplate(
     return ch;
 }
 
+const Character* CharacterManager::GetCharacterMaster(const std::string& character_id) const {
+    auto it = masters_.find(character_id);
+    return (it != masters_.end()) ? &it->second : nullptr;
+}
+
 std::vector<std::string> CharacterManager::GetAllCharacterIds() const {
     std::vector<std::string> ids;
     for (const auto& [id, _] : masters_) {
@@ -58,9 +65,11 @@ bool CharacterManager::HasCharacter(const std::string& character_id) const {
 
 void CharacterManager::SetMasters(const std::unordered_map<std::string, Character>& masters) {
     masters_ = masters;
+    battleTemplates_.Build(masters_);
 }
 
 void CharacterManager::Shutdown() {
+    battleTemplates_.Clear();
     masters_.clear();
 }
 
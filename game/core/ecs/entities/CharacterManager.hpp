@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BattleTemplateTable.hpp"
 #include "Character.hpp"
 #include <string>
 #include <unordered_map>
@@ -20,9 +21,16 @@ public:
     bool Initialize(const std::string& json_path = "");
 
     // マスターデータからキャラクターを取得
-    // （フレッシュなインスタンスを返す）
+    // （フレッシュなインスタンスを返す。書き換える用途のみ。参照だけなら GetCharacterMaster）
     std::shared_ptr<Character> GetCharacterTemplate(const std::string& character_id);
 
+    // マスターデータを参照で取得（コピーなし。見つからなければ nullptr）
+    // ポインタは次の SetMasters / Shutdown まで有効
+    const Character* GetCharacterMaster(const std::string& character_id) const;
+
+    // 戦闘/HUD向けの密なテンプレート表（ロード・SetMasters 時に再構築）
+    const BattleTemplateTable& GetBattleTemplates() const { return battleTemplates_; }
+
     // 全キャラクターIDを取得
     std::vector<std::string> GetAllCharacterIds() const;
 
@@ -44,6 +52,7 @@ public:
 private:
     // マスターデータ（ID -> Character）
     std::unordered_map<std::string, Character> masters_;
+    BattleTemplateTable battleTemplates_;
 
     // ロードは CharacterLoader に委譲
 };
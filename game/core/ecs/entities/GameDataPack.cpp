@@ -0,0 +1,908 @@
+#include "GameDataPack.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+// 外部ライブラリ
+#include <nlohmann/json.hpp>
+
+namespace game {
+namespace core {
+namespace entities {
+
+namespace {
+
+using json = nlohmann::json;
+
+enum SectionKind : uint32_t {
+    kCharacters,
+    kCharacterPassives,
+    kCharacterEquipment,
+    kPassives,
+    kEquipment,
+    kTowerAttachments,
+    kStages,
+    kStringRefs,
+    kBonusConditions,
+    kRewardMonsters,
+    kEnemySpawns,
+    kBossPhases,
+    kSectionCount
+};
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t stringTableOffset;
+    uint32_t stringTableSize;
+    uint32_t blobOffset;
+    uint32_t blobSize;
+    uint32_t reserved;
+};
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t recordSize;
+    uint32_t count;
+    uint32_t offset;
+};
+
+struct StrRef {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+struct ListRef {
+    uint32_t first = 0;
+    uint32_t count = 0;
+};
+
+struct SpriteRecord {
+    StrRef sheetPath;
+    int32_t frameWidth;
+    int32_t frameHeight;
+    int32_t frameCount;
+    float frameDuration;
+};
+
+struct CharacterRecord {
+    StrRef id;
+    StrRef name;
+    StrRef description;
+    StrRef rarityName;
+    StrRef iconPath;
+    int32_t rarity;
+    int32_t defaultLevel;
+    int32_t hp;
+    int32_t attack;
+    int32_t defense;
+    float moveSpeed;
+    float attackSpan;
+    uint32_t attackType;
+    uint32_t effectType;
+    float attackSizeX;
+    float attackSizeY;
+    float attackHitTime;
+    SpriteRecord moveSprite;
+    SpriteRecord attackSprite;
+    ListRef passives;   // kCharacterPassives
+    ListRef equipment;  // kCharacterEquipment
+    int32_t cost;
+    uint32_t defaultUnlocked;
+};
+
+struct PassiveRecord {
+    StrRef id;
+    StrRef name;
+    StrRef description;
+    float value;
+    uint32_t effectType;
+    uint32_t targetStat;
+    int32_t rarity;
+};
+
+struct EquipmentRecord {
+    StrRef id;
+    StrRef name;
+    StrRef description;
+    StrRef iconPath;
+    float attackBonus;
+    float defenseBonus;
+    float hpBonus;
+};
+
+struct TowerAttachmentRecord {
+    StrRef id;
+    StrRef name;
+    StrRef description;
+    uint32_t effectType;
+    uint32_t targetStat;
+    float valuePerLevel;
+    int32_t maxLevel;
+    int32_t rarity;
+};
+
+enum StageFlags : uint32_t {
+    kStageCleared = 1u << 0,
+    kStageLocked = 1u << 1,
+    kStageBoss = 1u << 2,
+    kStageInfinite = 1u << 3,
+    kStageCustom = 1u << 4,
+    kStageTutorial = 1u << 5,
+    kStageAllowGiveUp = 1u << 6,
+    kStageRewardCharacterEveryClear = 1u << 7,
+};
+
+struct StageRecord {
+    StrRef id;
+    StrRef chapterName;
+    StrRef stageName;
+    StrRef previewImageId;
+    int32_t stageNumber;
+    int32_t chapter;
+    int32_t difficulty;
+    int32_t starsEarned;
+    int32_t rewardGold;
+    int32_t rewardTickets;
+    int32_t waveCount;
+    int32_t recommendedLevel;
+    int32_t difficultyLevel;
+    uint32_t flags;
+    ListRef unlockOnClear;    // kStringRefs
+    ListRef bonusConditions;  // kBonusConditions
+    ListRef rewardMonsters;   // kRewardMonsters
+    ListRef enemySpawns;      // kEnemySpawns
+    ListRef bossPhases;       // kBossPhases
+    StrRef data;              // ブロブ内の CBOR
+};
+
+struct BonusConditionRecord {
+    StrRef description;
+    StrRef conditionType;
+    StrRef conditionOperator;
+    StrRef rewardType;
+    int32_t conditionValue;
+    int32_t rewardValue;
+};
+
+struct RewardMonsterRecord {
+    StrRef monsterId;
+    int32_t level;
+};
+
+struct EnemySpawnRecord {
+    StrRef monsterId;
+    StrRef spawnPattern;
+    int32_t minLevel;
+    int32_t maxLevel;
+    int32_t count;
+};
+
+struct BossPhaseRecord {
+    int32_t hpPercentMin;
+    int32_t hpPercentMax;
+    StrRef description;
+    ListRef actions;  // kStringRefs
+};
+
+static_assert(sizeof(float) == 4, "GameDataPack assumes 32-bit float");
+static_assert(std::is_trivially_copyable_v<CharacterRecord> &&
+                  std::is_trivially_copyable_v<StageRecord> &&
+                  std::is_trivially_copyable_v<BossPhaseRecord>,
+              "pack records must be trivially copyable");
+
+/// @brief ID 順に並べたマップの要素（出力をビルド間で安定させる）
+template<typename Map>
+std::vector<const typename Map::value_type*> SortedById(const Map& map) {
+    std::vector<const typename Map::value_type*> out;
+    out.reserve(map.size());
+    for (const auto& pair : map) {
+        out.push_back(&pair);
+    }
+    std::sort(out.begin(), out.end(),
+              [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+    return out;
+}
+
+class PackBuilder {
+public:
+    StrRef String(const std::string& text) {
+        auto it = stringIndex_.find(text);
+        if (it != stringIndex_.end()) {
+            return it->second;
+        }
+        StrRef ref;
+        ref.offset = static_cast<uint32_t>(strings_.size());
+        ref.length = static_cast<uint32_t>(text.size());
+        strings_.insert(strings_.end(), text.begin(), text.end());
+        stringIndex_.emplace(text, ref);
+        return ref;
+    }
+
+    StrRef Blob(const std::vector<uint8_t>& bytes) {
+        StrRef ref;
+        ref.offset = static_cast<uint32_t>(blob_.size());
+        ref.length = static_cast<uint32_t>(bytes.size());
+        blob_.insert(blob_.end(), bytes.begin(), bytes.end());
+        return ref;
+    }
+
+    template<typename Record>
+    uint32_t Append(SectionKind kind, const Record& record) {
+        auto& bytes = sections_[kind];
+        recordSizes_[kind] = sizeof(Record);
+        const uint32_t index = static_cast<uint32_t>(bytes.size() / sizeof(Record));
+        const auto* raw = reinterpret_cast<const uint8_t*>(&record);
+        bytes.insert(bytes.end(), raw, raw + sizeof(Record));
+        return index;
+    }
+
+    uint32_t Count(SectionKind kind) const {
+        return recordSizes_[kind] ? static_cast<uint32_t>(sections_[kind].size() /
+                                                          recordSizes_[kind])
+                                  : 0;
+    }
+
+    ListRef Strings(const std::vector<std::string>& values) {
+        ListRef list;
+        list.first = Count(kStringRefs);
+        for (const auto& value : values) {
+            Append(kStringRefs, String(value));
+        }
+        list.count = static_cast<uint32_t>(values.size());
+        return list;
+    }
+
+    std::vector<uint8_t> Finish() const {
+        auto align4 = [](size_t size) { return (size + 3) & ~size_t{3}; };
+
+        size_t offset = sizeof(Header) + sizeof(SectionEntry) * kSectionCount;
+        std::array<SectionEntry, kSectionCount> entries{};
+        for (uint32_t kind = 0; kind < kSectionCount; ++kind) {
+            entries[kind].kind = kind;
+            entries[kind].recordSize = recordSizes_[kind];
+            entries[kind].count = Count(static_cast<SectionKind>(kind));
+            entries[kind].offset = static_cast<uint32_t>(offset);
+            offset = align4(offset + sections_[kind].size());
+        }
+
+        Header header{};
+        header.magic = GameDataPack::MAGIC;
+        header.version = GameDataPack::VERSION;
+        header.sectionCount = kSectionCount;
+        header.stringTableOffset = static_cast<uint32_t>(offset);
+        header.stringTableSize = static_cast<uint32_t>(strings_.size());
+        offset = align4(offset + strings_.size());
+        header.blobOffset = static_cast<uint32_t>(offset);
+        header.blobSize = static_cast<uint32_t>(blob_.size());
+        offset += blob_.size();
+
+        std::vector<uint8_t> out(offset, 0);
+        std::memcpy(out.data(), &header, sizeof(header));
+        std::memcpy(out.data() + sizeof(header), entries.data(),
+                    sizeof(SectionEntry) * kSectionCount);
+        for (uint32_t kind = 0; kind < kSectionCount; ++kind) {
+            if (!sections_[kind].empty()) {
+                std::memcpy(out.data() + entries[kind].offset, sections_[kind].data(),
+                            sections_[kind].size());
+            }
+        }
+        if (!strings_.empty()) {
+            std::memcpy(out.data() + header.stringTableOffset, strings_.data(),
+                        strings_.size());
+        }
+        if (!blob_.empty()) {
+            std::memcpy(out.data() + header.blobOffset, blob_.data(), blob_.size());
+        }
+        return out;
+    }
+
+private:
+    std::array<std::vector<uint8_t>, kSectionCount> sections_{};
+    std::array<uint32_t, kSectionCount> recordSizes_{};
+    std::vector<char> strings_;
+    std::unordered_map<std::string, StrRef> stringIndex_;
+    std::vector<uint8_t> blob_;
+};
+
+class PackReader {
+public:
+    explicit PackReader(const std::vector<uint8_t>& bytes) : bytes_(bytes) {}
+
+    bool Open(std::string& error) {
+        if (bytes_.size() < sizeof(Header)) {
+            error = "file is too small";
+            return false;
+        }
+        std::memcpy(&header_, bytes_.data(), sizeof(Header));
+        if (header_.magic != GameDataPack::MAGIC) {
+            error = "bad magic";
+            return false;
+        }
+        if (header_.version != GameDataPack::VERSION) {
+            error = "unsupported version " + std::to_string(header_.version);
+            return false;
+        }
+        if (header_.sectionCount != kSectionCount ||
+            !InRange(sizeof(Header), sizeof(SectionEntry) * kSectionCount) ||
+            !InRange(header_.stringTableOffset, header_.stringTableSize) ||
+            !InRange(header_.blobOffset, header_.blobSize)) {
+            error = "corrupt header";
+            return false;
+        }
+        std::memcpy(sections_.data(), bytes_.data() + sizeof(Header),
+                    sizeof(SectionEntry) * kSectionCount);
+        for (const SectionEntry& entry : sections_) {
+            if (!InRange(entry.offset, static_cast<uint64_t>(entry.count) * entry.recordSize)) {
+                error = "corrupt section " + std::to_string(entry.kind);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename Record>
+    bool Check(SectionKind kind) const {
+        const SectionEntry& entry = sections_[kind];
+        return entry.count == 0 || entry.recordSize == sizeof(Record);
+    }
+
+    uint32_t Count(SectionKind kind) const { return sections_[kind].count; }
+
+    template<typename Record>
+    Record Get(SectionKind kind, uint32_t index) {
+        Record record{};
+        const SectionEntry& entry = sections_[kind];
+        if (index >= entry.count || entry.recordSize != sizeof(Record)) {
+            failed_ = true;
+            return record;
+        }
+        std::memcpy(&record,
+                    bytes_.data() + entry.offset + static_cast<size_t>(index) * sizeof(Record),
+                    sizeof(Record));
+        return record;
+    }
+
+    std::string String(const StrRef& ref) {
+        if (static_cast<uint64_t>(ref.offset) + ref.length > header_.stringTableSize) {
+            failed_ = true;
+            return {};
+        }
+        const char* base =
+            reinterpret_cast<const char*>(bytes_.data()) + header_.stringTableOffset;
+        return std::string(base + ref.offset, ref.length);
+    }
+
+    std::vector<std::string> Strings(const ListRef& list) {
+        std::vector<std::string> out;
+        out.reserve(list.count);
+        for (uint32_t i = 0; i < list.count; ++i) {
+            out.push_back(String(Get<StrRef>(kStringRefs, list.first + i)));
+        }
+        return out;
+    }
+
+    const uint8_t* Blob(const StrRef& ref) {
+        if (static_cast<uint64_t>(ref.offset) + ref.length > header_.blobSize) {
+            failed_ = true;
+            return nullptr;
+        }
+        return bytes_.data() + header_.blobOffset + ref.offset;
+    }
+
+    bool Failed() const { return failed_; }
+
+private:
+    bool InRange(uint64_t offset, uint64_t size) const {
+        return offset + size <= bytes_.size();
+    }
+
+    const std::vector<uint8_t>& bytes_;
+    Header header_{};
+    std::array<SectionEntry, kSectionCount> sections_{};
+    bool failed_ = false;
+};
+
+PassiveRecord MakePassiveRecord(PackBuilder& builder, const PassiveSkill& skill) {
+    PassiveRecord record{};
+    record.id = builder.String(skill.id);
+    record.name = builder.String(skill.name);
+    record.description = builder.String(skill.description);
+    record.value = skill.value;
+    record.effectType = static_cast<uint32_t>(skill.effect_type);
+    record.targetStat = static_cast<uint32_t>(skill.target_stat);
+    record.rarity = skill.rarity;
+    return record;
+}
+
+PassiveSkill ReadPassive(PackReader& reader, const PassiveRecord& record) {
+    PassiveSkill skill;
+    skill.id = reader.String(record.id);
+    skill.name = reader.String(record.name);
+    skill.description = reader.String(record.description);
+    skill.value = record.value;
+    skill.effect_type = static_cast<PassiveEffectType>(record.effectType);
+    skill.target_stat = static_cast<PassiveTargetStat>(record.targetStat);
+    skill.rarity = record.rarity;
+    return skill;
+}
+
+EquipmentRecord MakeEquipmentRecord(PackBuilder& builder, const Equipment& equipment) {
+    EquipmentRecord record{};
+    record.id = builder.String(equipment.id);
+    record.name = builder.String(equipment.name);
+    record.description = builder.String(equipment.description);
+    record.iconPath = builder.String(equipment.icon_path);
+    record.attackBonus = equipment.attack_bonus;
+    record.defenseBonus = equipment.defense_bonus;
+    record.hpBonus = equipment.hp_bonus;
+    return record;
+}
+
+Equipment ReadEquipment(PackReader& reader, const EquipmentRecord& record) {
+    Equipment equipment;
+    equipment.id = reader.String(record.id);
+    equipment.name = reader.String(record.name);
+    equipment.description = reader.String(record.description);
+    equipment.icon_path = reader.String(record.iconPath);
+    equipment.attack_bonus = record.attackBonus;
+    equipment.defense_bonus = record.defenseBonus;
+    equipment.hp_bonus = record.hpBonus;
+    return equipment;
+}
+
+SpriteRecord MakeSpriteRecord(PackBuilder& builder, const Character::SpriteInfo& sprite) {
+    SpriteRecord record{};
+    record.sheetPath = builder.String(sprite.sheet_path);
+    record.frameWidth = sprite.frame_width;
+    record.frameHeight = sprite.frame_height;
+    record.frameCount = sprite.frame_count;
+    record.frameDuration = sprite.frame_duration;
+    return record;
+}
+
+Character::SpriteInfo ReadSprite(PackReader& reader, const SpriteRecord& record) {
+    Character::SpriteInfo sprite;
+    sprite.sheet_path = reader.String(record.sheetPath);
+    sprite.frame_width = record.frameWidth;
+    sprite.frame_height = record.frameHeight;
+    sprite.frame_count = record.frameCount;
+    sprite.frame_duration = record.frameDuration;
+    return sprite;
+}
+
+void WriteCharacters(PackBuilder& builder, const GameDataPackContents& contents) {
+    for (const auto* pair : SortedById(contents.characters)) {
+        const Character& ch = pair->second;
+        CharacterRecord record{};
+        record.id = builder.String(ch.id);
+        record.name = builder.String(ch.name);
+        record.description = builder.String(ch.description);
+        record.rarityName = builder.String(ch.rarity_name);
+        record.iconPath = builder.String(ch.icon_path);
+        record.rarity = ch.rarity;
+        record.defaultLevel = ch.default_level;
+        record.hp = ch.hp;
+        record.attack = ch.attack;
+        record.defense = ch.defense;
+        record.moveSpeed = ch.move_speed;
+        record.attackSpan = ch.attack_span;
+        record.attackType = static_cast<uint32_t>(ch.attack_type);
+        record.effectType = static_cast<uint32_t>(ch.effect_type);
+        record.attackSizeX = ch.attack_size.x;
+        record.attackSizeY = ch.attack_size.y;
+        record.attackHitTime = ch.attack_hit_time;
+        record.moveSprite = MakeSpriteRecord(builder, ch.move_sprite);
+        record.attackSprite = MakeSpriteRecord(builder, ch.attack_sprite);
+
+        record.passives.first = builder.Count(kCharacterPassives);
+        for (const auto& skill : ch.default_passive_skills) {
+            builder.Append(kCharacterPassives, MakePassiveRecord(builder, skill));
+        }
+        record.passives.count = static_cast<uint32_t>(ch.default_passive_skills.size());
+
+        record.equipment.first = builder.Count(kCharacterEquipment);
+        for (const auto& eq : ch.default_equipment) {
+            builder.Append(kCharacterEquipment, MakeEquipmentRecord(builder, eq));
+        }
+        record.equipment.count = static_cast<uint32_t>(ch.default_equipment.size());
+
+        record.cost = ch.cost;
+        record.defaultUnlocked = ch.default_unlocked ? 1u : 0u;
+        builder.Append(kCharacters, record);
+    }
+}
+
+void ReadCharacters(PackReader& reader, GameDataPackContents& contents) {
+    const uint32_t count = reader.Count(kCharacters);
+    contents.characters.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto record = reader.Get<CharacterRecord>(kCharacters, i);
+        Character ch;
+        ch.id = reader.String(record.id);
+        ch.name = reader.String(record.name);
+        ch.description = reader.String(record.description);
+        ch.rarity_name = reader.String(record.rarityName);
+        ch.icon_path = reader.String(record.iconPath);
+        ch.rarity = record.rarity;
+        ch.default_level = record.defaultLevel;
+        ch.hp = record.hp;
+        ch.attack = record.attack;
+        ch.defense = record.defense;
+        ch.move_speed = record.moveSpeed;
+        ch.attack_span = record.attackSpan;
+        ch.attack_type = static_cast<AttackType>(record.attackType);
+        ch.effect_type = static_cast<EffectType>(record.effectType);
+        ch.attack_size = Vector2{record.attackSizeX, record.attackSizeY};
+        ch.attack_hit_time = record.attackHitTime;
+        ch.move_sprite = ReadSprite(reader, record.moveSprite);
+        ch.attack_sprite = ReadSprite(reader, record.attackSprite);
+        ch.default_passive_skills.reserve(record.passives.count);
+        for (uint32_t k = 0; k < record.passives.count; ++k) {
+            ch.default_passive_skills.push_back(ReadPassive(
+                reader,
+                reader.Get<PassiveRecord>(kCharacterPassives, record.passives.first + k)));
+        }
+        ch.default_equipment.reserve(record.equipment.count);
+        for (uint32_t k = 0; k < record.equipment.count; ++k) {
+            ch.default_equipment.push_back(ReadEquipment(
+                reader,
+                reader.Get<EquipmentRecord>(kCharacterEquipment, record.equipment.first + k)));
+        }
+        ch.cost = record.cost;
+        ch.default_unlocked = record.defaultUnlocked != 0;
+        contents.characters.emplace(ch.id, std::move(ch));
+    }
+}
+
+void WriteStages(PackBuilder& builder, const GameDataPackContents& contents) {
+    for (const auto* pair : SortedById(contents.stages)) {
+        const StageData& stage = pair->second;
+        StageRecord record{};
+        record.id = builder.String(stage.id);
+        record.chapterName = builder.String(stage.chapterName);
+        record.stageName = builder.String(stage.stageName);
+        record.previewImageId = builder.String(stage.previewImageId);
+        record.stageNumber = stage.stageNumber;
+        record.chapter = stage.chapter;
+        record.difficulty = stage.difficulty;
+        record.starsEarned = stage.starsEarned;
+        record.rewardGold = stage.rewardGold;
+        record.rewardTickets = stage.rewardTickets;
+        record.waveCount = stage.waveCount;
+        record.recommendedLevel = stage.recommendedLevel;
+        record.difficultyLevel = stage.difficultyLevel;
+        record.flags = (stage.isCleared ? kStageCleared : 0u) |
+                       (stage.isLocked ? kStageLocked : 0u) |
+                       (stage.isBoss ? kStageBoss : 0u) |
+                       (stage.isInfinite ? kStageInfinite : 0u) |
+                       (stage.isCustom ? kStageCustom : 0u) |
+                       (stage.isTutorial ? kStageTutorial : 0u) |
+                       (stage.allowGiveUp ? kStageAllowGiveUp : 0u) |
+                       (stage.rewardCharacterOnEveryClear ? kStageRewardCharacterEveryClear
+                                                          : 0u);
+        record.unlockOnClear = builder.Strings(stage.unlockOnClear);
+
+        record.bonusConditions.first = builder.Count(kBonusConditions);
+        for (const auto& bonus : stage.bonusConditions) {
+            BonusConditionRecord child{};
+            child.description = builder.String(bonus.description);
+            child.conditionType = builder.String(bonus.conditionType);
+            child.conditionOperator = builder.String(bonus.conditionOperator);
+            child.rewardType = builder.String(bonus.rewardType);
+            child.conditionValue = bonus.conditionValue;
+            child.rewardValue = bonus.rewardValue;
+            builder.Append(kBonusConditions, child);
+        }
+        record.bonusConditions.count = static_cast<uint32_t>(stage.bonusConditions.size());
+
+        record.rewardMonsters.first = builder.Count(kRewardMonsters);
+        for (const auto& monster : stage.rewardMonsters) {
+            RewardMonsterRecord child{};
+            child.monsterId = builder.String(monster.monsterId);
+            child.level = monster.level;
+            builder.Append(kRewardMonsters, child);
+        }
+        record.rewardMonsters.count = static_cast<uint32_t>(stage.rewardMonsters.size());
+
+        record.enemySpawns.first = builder.Count(kEnemySpawns);
+        for (const auto& spawn : stage.enemySpawns) {
+            EnemySpawnRecord child{};
+            child.monsterId = builder.String(spawn.monsterId);
+            child.spawnPattern = builder.String(spawn.spawnPattern);
+            child.minLevel = spawn.minLevel;
+            child.maxLevel = spawn.maxLevel;
+            child.count = spawn.count;
+            builder.Append(kEnemySpawns, child);
+        }
+        record.enemySpawns.count = static_cast<uint32_t>(stage.enemySpawns.size());
+
+        // 子要素（actions）を先に積み、フェーズ側はその範囲を指す
+        std::vector<BossPhaseRecord> phases;
+        phases.reserve(stage.bossPhases.size());
+        for (const auto& phase : stage.bossPhases) {
+            BossPhaseRecord child{};
+            child.hpPercentMin = phase.hpPercentMin;
+            child.hpPercentMax = phase.hpPercentMax;
+            child.description = builder.String(phase.description);
+            child.actions = builder.Strings(phase.actions);
+            phases.push_back(child);
+        }
+        record.bossPhases.first = builder.Count(kBossPhases);
+        for (const auto& phase : phases) {
+            builder.Append(kBossPhases, phase);
+        }
+        record.bossPhases.count = static_cast<uint32_t>(phases.size());
+
+        if (!stage.data.is_null()) {
+            record.data = builder.Blob(json::to_cbor(stage.data));
+        } else if (!stage.packedData.empty()) {
+            record.data = builder.Blob(stage.packedData);
+        }
+        builder.Append(kStages, record);
+    }
+}
+
+void ReadStages(PackReader& reader, GameDataPackContents& contents) {
+    const uint32_t count = reader.Count(kStages);
+    contents.stages.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto record = reader.Get<StageRecord>(kStages, i);
+        StageData stage;
+        stage.id = reader.String(record.id);
+        stage.chapterName = reader.String(record.chapterName);
+        stage.stageName = reader.String(record.stageName);
+        stage.previewImageId = reader.String(record.previewImageId);
+        stage.stageNumber = record.stageNumber;
+        stage.chapter = record.chapter;
+        stage.difficulty = record.difficulty;
+        stage.starsEarned = record.starsEarned;
+        stage.rewardGold = record.rewardGold;
+        stage.rewardTickets = record.rewardTickets;
+        stage.waveCount = record.waveCount;
+        stage.recommendedLevel = record.recommendedLevel;
+        stage.difficultyLevel = record.difficultyLevel;
+        stage.isCleared = (record.flags & kStageCleared) != 0;
+        stage.isLocked = (record.flags & kStageLocked) != 0;
+        stage.isBoss = (record.flags & kStageBoss) != 0;
+        stage.isInfinite = (record.flags & kStageInfinite) != 0;
+        stage.isCustom = (record.flags & kStageCustom) != 0;
+        stage.isTutorial = (record.flags & kStageTutorial) != 0;
+        stage.allowGiveUp = (record.flags & kStageAllowGiveUp) != 0;
+        stage.rewardCharacterOnEveryClear =
+            (record.flags & kStageRewardCharacterEveryClear) != 0;
+        stage.unlockOnClear = reader.Strings(record.unlockOnClear);
+
+        for (uint32_t k = 0; k < record.bonusConditions.count; ++k) {
+            const auto child = reader.Get<BonusConditionRecord>(
+                kBonusConditions, record.bonusConditions.first + k);
+            BonusCondition bonus;
+            bonus.description = reader.String(child.description);
+            bonus.conditionType = reader.String(child.conditionType);
+            bonus.conditionOperator = reader.String(child.conditionOperator);
+            bonus.rewardType = reader.String(child.rewardType);
+            bonus.conditionValue = child.conditionValue;
+            bonus.rewardValue = child.rewardValue;
+            stage.bonusConditions.push_back(std::move(bonus));
+        }
+        for (uint32_t k = 0; k < record.rewardMonsters.count; ++k) {
+            const auto child = reader.Get<RewardMonsterRecord>(
+                kRewardMonsters, record.rewardMonsters.first + k);
+            RewardMonster monster;
+            monster.monsterId = reader.String(child.monsterId);
+            monster.level = child.level;
+            stage.rewardMonsters.push_back(std::move(monster));
+        }
+        for (uint32_t k = 0; k < record.enemySpawns.count; ++k) {
+            const auto child =
+                reader.Get<EnemySpawnRecord>(kEnemySpawns, record.enemySpawns.first + k);
+            EnemySpawn spawn;
+            spawn.monsterId = reader.String(child.monsterId);
+            spawn.spawnPattern = reader.String(child.spawnPattern);
+            spawn.minLevel = child.minLevel;
+            spawn.maxLevel = child.maxLevel;
+            spawn.count = child.count;
+            stage.enemySpawns.push_back(std::move(spawn));
+        }
+        for (uint32_t k = 0; k < record.bossPhases.count; ++k) {
+            const auto child =
+                reader.Get<BossPhaseRecord>(kBossPhases, record.bossPhases.first + k);
+            BossPhase phase;
+            phase.hpPercentMin = child.hpPercentMin;
+            phase.hpPercentMax = child.hpPercentMax;
+            phase.description = reader.String(child.description);
+            phase.actions = reader.Strings(child.actions);
+            stage.bossPhases.push_back(std::move(phase));
+        }
+
+        if (record.data.length > 0) {
+            const uint8_t* blob = reader.Blob(record.data);
+            if (blob) {
+                // 展開は StageManager が初回取得時に行う（起動時に全ステージを解析しない）
+                stage.packedData.assign(blob, blob + record.data.length);
+            }
+        }
+        contents.stages.emplace(stage.id, std::move(stage));
+    }
+}
+
+void WriteMasters(PackBuilder& builder, const GameDataPackContents& contents) {
+    for (const auto* pair : SortedById(contents.passives)) {
+        builder.Append(kPassives, MakePassiveRecord(builder, pair->second));
+    }
+    for (const auto* pair : SortedById(contents.equipment)) {
+        builder.Append(kEquipment, MakeEquipmentRecord(builder, pair->second));
+    }
+    for (const auto* pair : SortedById(contents.towerAttachments)) {
+        const TowerAttachment& attachment = pair->second;
+        TowerAttachmentRecord record{};
+        record.id = builder.String(attachment.id);
+        record.name = builder.String(attachment.name);
+        record.description = builder.String(attachment.description);
+        record.effectType = static_cast<uint32_t>(attachment.effect_type);
+        record.targetStat = static_cast<uint32_t>(attachment.target_stat);
+        record.valuePerLevel = attachment.value_per_level;
+        record.maxLevel = attachment.max_level;
+        record.rarity = attachment.rarity;
+        builder.Append(kTowerAttachments, record);
+    }
+}
+
+void ReadMasters(PackReader& reader, GameDataPackContents& contents) {
+    for (uint32_t i = 0; i < reader.Count(kPassives); ++i) {
+        PassiveSkill skill = ReadPassive(reader, reader.Get<PassiveRecord>(kPassives, i));
+        contents.passives.emplace(skill.id, std::move(skill));
+    }
+    for (uint32_t i = 0; i < reader.Count(kEquipment); ++i) {
+        Equipment equipment =
+            ReadEquipment(reader, reader.Get<EquipmentRecord>(kEquipment, i));
+        contents.equipment.emplace(equipment.id, std::move(equipment));
+    }
+    for (uint32_t i = 0; i < reader.Count(kTowerAttachments); ++i) {
+        const auto record = reader.Get<TowerAttachmentRecord>(kTowerAttachments, i);
+        TowerAttachment attachment;
+        attachment.id = reader.String(record.id);
+        attachment.name = reader.String(record.name);
+        attachment.description = reader.String(record.description);
+        attachment.effect_type = static_cast<TowerAttachmentEffectType>(record.effectType);
+        attachment.target_stat = static_cast<TowerAttachmentTargetStat>(record.targetStat);
+        attachment.value_per_level = record.valuePerLevel;
+        attachment.max_level = record.maxLevel;
+        attachment.rarity = record.rarity;
+        contents.towerAttachments.emplace(attachment.id, std::move(attachment));
+    }
+}
+
+void SetError(std::string* error, const std::string& message) {
+    if (error) {
+        *error = message;
+    }
+}
+
+} // namespace
+
+bool GameDataPack::Write(const std::string& path, const GameDataPackContents& contents,
+                         std::string* error) {
+    if constexpr (std::endian::native != std::endian::little) {
+        SetError(error, "big-endian hosts are not supported");
+        return false;
+    }
+
+    std::vector<uint8_t> bytes;
+    try {
+        PackBuilder builder;
+        WriteCharacters(builder, contents);
+        WriteMasters(builder, contents);
+        WriteStages(builder, contents);
+        bytes = builder.Finish();
+    } catch (const std::exception& e) {
+        SetError(error, e.what());
+        return false;
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        SetError(error, "failed to open " + path);
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+        SetError(error, "failed to write " + path);
+        return false;
+    }
+    return true;
+}
+
+bool GameDataPack::Load(const std::string& path, GameDataPackContents& outContents,
+                        std::string* error) {
+    outContents = GameDataPackContents{};
+    if constexpr (std::endian::native != std::endian::little) {
+        SetError(error, "big-endian hosts are not supported");
+        return false;
+    }
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+        SetError(error, "failed to open " + path);
+        return false;
+    }
+    const std::streamoff size = in.tellg();
+    if (size <= 0) {
+        SetError(error, "empty file " + path);
+        return false;
+    }
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        SetError(error, "failed to read " + path);
+        return false;
+    }
+
+    PackReader reader(bytes);
+    std::string message;
+    if (!reader.Open(message)) {
+        SetError(error, path + ": " + message);
+        return false;
+    }
+    if (!reader.Check<CharacterRecord>(kCharacters) ||
+        !reader.Check<PassiveRecord>(kCharacterPassives) ||
+        !reader.Check<EquipmentRecord>(kCharacterEquipment) ||
+        !reader.Check<PassiveRecord>(kPassives) ||
+        !reader.Check<EquipmentRecord>(kEquipment) ||
+        !reader.Check<TowerAttachmentRecord>(kTowerAttachments) ||
+        !reader.Check<StageRecord>(kStages) || !reader.Check<StrRef>(kStringRefs) ||
+        !reader.Check<BonusConditionRecord>(kBonusConditions) ||
+        !reader.Check<RewardMonsterRecord>(kRewardMonsters) ||
+        !reader.Check<EnemySpawnRecord>(kEnemySpawns) ||
+        !reader.Check<BossPhaseRecord>(kBossPhases)) {
+        SetError(error, path + ": record layout mismatch");
+        return false;
+    }
+
+    try {
+        ReadCharacters(reader, outContents);
+        ReadMasters(reader, outContents);
+        ReadStages(reader, outContents);
+    } catch (const std::exception& e) {
+        SetError(error, path + ": " + e.what());
+        outContents = GameDataPackContents{};
+        return false;
+    }
+    if (reader.Failed()) {
+        SetError(error, path + ": reference out of range");
+        outContents = GameDataPackContents{};
+        return false;
+    }
+    return true;
+}
+
+bool GameDataPack::IsUpToDate(const std::string& packPath,
+                              const std::vector<std::string>& sourcePaths) {
+    std::error_code ec;
+    const auto packTime = std::filesystem::last_write_time(packPath, ec);
+    if (ec) {
+        return false;
+    }
+    for (const auto& source : sourcePaths) {
+        if (source.empty()) {
+            continue;
+        }
+        const auto sourceTime = std::filesystem::last_write_time(source, ec);
+        if (!ec && sourceTime > packTime) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace entities
+} // namespace core
+} // namespace game
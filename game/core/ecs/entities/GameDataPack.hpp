@@ -0,0 +1,57 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// プロジェクト内
+#include "Character.hpp"
+#include "StageManager.hpp"
+#include "TowerAttachment.hpp"
+
+namespace game {
+namespace core {
+namespace entities {
+
+/// @brief マスターデータ一式（パックの入出力単位）
+struct GameDataPackContents {
+    std::unordered_map<std::string, Character> characters;
+    std::unordered_map<std::string, PassiveSkill> passives;
+    std::unordered_map<std::string, Equipment> equipment;
+    std::unordered_map<std::string, StageData> stages;
+    std::unordered_map<std::string, TowerAttachment> towerAttachments;
+};
+
+/// @brief data/*.json をコンパイルしたバイナリパック（tools/game_data_compiler.cpp が生成）
+///
+/// 形式（リトルエンディアン、全フィールド4バイト境界）:
+///   [Header][SectionEntry x N][各セクションの固定長レコード配列][文字列表][ブロブ]
+/// 文字列は (offset, length) で文字列表を指し、可変長の子要素は (first, count) で別セクションを指します。
+/// 読み込みはヘッダ/範囲の検証とレコードのコピーのみで、字句解析は行いません。
+/// ステージの元JSON（StageData::data）はゲームロジックが直接参照するため CBOR ブロブとして格納し、
+/// 読み込み時は StageData::packedData にコピーするだけで、展開は StageManager が初回取得時に行います。
+/// 編集の正は JSON のままで、JSON の方が新しければ GameplayDataAPI は JSON から読み込みます。
+class GameDataPack {
+public:
+    static constexpr uint32_t MAGIC = 0x50445443;  // "CTDP"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr const char* DEFAULT_PATH = "data/gamedata.pack";
+
+    /// @brief パックを書き出す（失敗時は error に理由）
+    static bool Write(const std::string& path, const GameDataPackContents& contents,
+                      std::string* error = nullptr);
+
+    /// @brief パックを読み込む（マジック/バージョン/範囲が不正なら false）
+    static bool Load(const std::string& path, GameDataPackContents& outContents,
+                     std::string* error = nullptr);
+
+    /// @brief パックが存在し、sourcePaths のどれよりも新しいか
+    static bool IsUpToDate(const std::string& packPath,
+                           const std::vector<std::string>& sourcePaths);
+};
+
+} // namespace entities
+} // namespace core
+} // namespace game
@@ -47,6 +47,8 @@ std::shared_ptr<StageData> StageManager::GetStageDataById(const std::string& sta
         return nullptr;
     }
     
+    DecodePackedData(it->second);
+
     // マスターチE�Eタをコピ�Eして返す
     return std::make_shared<StageData>(it->second);
 }
@@ -62,6 +64,11 @@ std::shared_ptr<StageData> StageManager::GetStageData(int stageNumber) {
 }
 
 std::vector<StageData> StageManager::GetAllStageData() const {
+    // マスター側を一度だけ展開し、以降の呼び出しは展開済みをコピーするだけにする
+    for (auto& pair : stages_) {
+        DecodePackedData(pair.second);
+    }
+
     std::vector<StageData> result;
     result.reserve(stages_.size());
     
@@ -144,6 +151,19 @@ void StageManager::InitializeDefaultStages() {
     StageLoader::LoadDefault(stages_, stageNumberToId_);
 }
 
+void StageManager::DecodePackedData(StageData& stage) {
+    if (stage.packedData.empty()) {
+        return;
+    }
+    stage.data = nlohmann::json::from_cbor(stage.packedData, true, false);
+    if (stage.data.is_discarded()) {
+        LOG_WARN("Stage '{}': packed data is corrupted", stage.id);
+        stage.data = nlohmann::json::object();
+    }
+    stage.packedData.clear();
+    stage.packedData.shrink_to_fit();
+}
+
 void StageManager::Shutdown() {
     stages_.clear();
     stageNumberToId_.clear();
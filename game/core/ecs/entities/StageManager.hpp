@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -77,6 +78,7 @@ struct StageData {
     std::string previewImageId;  // プレビュー画像ID
     std::vector<std::string> unlockOnClear; // クリア時に解放されるステージID
     nlohmann::json data;         // 元のJSONデータ（ゲームロジック用）
+    std::vector<uint8_t> packedData;  // パック由来の未展開 CBOR（StageManager が初回取得時に data へ展開）
     
     // 拡張フィールド（monster_system.md対応）
     std::vector<BonusCondition> bonusConditions;  // ボーナス条件
@@ -136,7 +138,7 @@ public:
     // ステージ数
     size_t GetStageCount() const { return stages_.size(); }
 
-    // 全マスターデータ取得（デバッグ用）
+    // 全マスターデータ取得（デバッグ用。data は未展開のことがあるので平坦なフィールドだけを参照する）
     const std::unordered_map<std::string, StageData>& GetAllStages() const {
         return stages_;
     }
@@ -147,12 +149,16 @@ public:
 
 private:
     // マスターデータ（ID -> StageData）
-    std::unordered_map<std::string, StageData> stages_;
+    // packedData の遅延展開を const な取得からも書き戻せるよう mutable
+    mutable std::unordered_map<std::string, StageData> stages_;
     
     // stageNumber -> id のマッピング
     std::unordered_map<int, std::string> stageNumberToId_;
 
     // ロードは StageLoader に委譲
+
+    // packedData が残っていれば data へ展開する（パック読み込み時は展開を取得時まで遅らせる）
+    static void DecodePackedData(StageData& stage);
 };
 
 } // namespace entities
@@ -50,10 +50,10 @@ inline entt::entity CreateEntityFromCharacter(
     
     // Spriteコンポーネント（移動スプライトを使用）
     api.Add<ecs::components::Sprite>(entity, 
-        character.move_sprite.sheet_path,
         character.move_sprite.frame_width,
         character.move_sprite.frame_height
     );
+    api.Add<ecs::components::SpriteSource>(entity, character.move_sprite.sheet_path);
     
     // Animationコンポーネント（移動アニメーション）
     api.Add<ecs::components::Animation>(entity,
@@ -65,6 +65,7 @@ inline entt::entity CreateEntityFromCharacter(
     
     // CharacterIdコンポーネント（マスターデータ参照用）
     api.Add<ecs::components::CharacterId>(entity, character.id);
+    api.Add<ecs::components::TemplateIndex>(entity);
     
     LOG_INFO("Created entity from character: {} at ({}, {})", 
         character.id, 
@@ -1,7 +1,11 @@
 #include "BattleRenderer.hpp"
 
+// 標準ライブラリ
+#include <algorithm>
+
 // プロジェクト�E
 #include "../../utils/Log.h"
+#include "../system/Profiler.hpp"
 
 namespace game {
 namespace core {
@@ -39,21 +43,41 @@ void BattleRenderer::UpdateAnimations(ECSystemAPI* ecsAPI, float deltaTime) {
     }
 }
 
-void BattleRenderer::RenderEntities(ECSystemAPI* ecsAPI) {
+void BattleRenderer::RenderEntities(ECSystemAPI* ecsAPI, float interpolationAlpha) {
+    PROFILE_SCOPE("BattleRenderer::RenderEntities");
     if (!ecsAPI) {
         ecsAPI = ecsAPI_;
     }
     if (!ecsAPI) {
         return;
     }
+    // 同じアトラスページが続く区間を1回のドローコールにまとめる（前後関係は投入順のまま）
+    if (systemAPI_) {
+        systemAPI_->Render().BeginSpriteBatch();
+    }
+    const float alpha = std::clamp(interpolationAlpha, 0.0f, 1.0f);
     auto view = ecsAPI->View<ecs::components::Position, ecs::components::Sprite>();
     for (auto e : view) {
-        const auto& pos = view.get<ecs::components::Position>(e);
-        const auto& sprite = view.get<ecs::components::Sprite>(e);
+        ecs::components::Position pos = view.get<ecs::components::Position>(e);
+        // 固定ティック間の端数ぶん前回位置から補間し、高倍速でもカクつかせない
+        if (const auto* prev = ecsAPI->Try<ecs::components::PreviousPosition>(e)) {
+            pos.x = prev->x + (pos.x - prev->x) * alpha;
+            pos.y = prev->y + (pos.y - prev->y) * alpha;
+        }
+        auto& sprite = view.get<ecs::components::Sprite>(e);
+        // SetupAPI 経由以外で生成されたエンティティは初回描画時にハンドルを解決
+        if (sprite.texture_handle == INVALID_TEXTURE_HANDLE && systemAPI_) {
+            if (const auto* source = ecsAPI->Try<ecs::components::SpriteSource>(e)) {
+                sprite.texture_handle = systemAPI_->Resource().ResolveTextureHandle(source->sheet_path);
+            }
+        }
         const auto* anim = ecsAPI->Try<ecs::components::Animation>(e);
         const auto* team = ecsAPI->Try<ecs::components::Team>(e);
         RenderEntity(pos, sprite, anim, team);
     }
+    if (systemAPI_) {
+        systemAPI_->Render().FlushSpriteBatch();
+    }
 }
 
 void BattleRenderer::RenderEntity(const ecs::components::Position& pos,
@@ -64,19 +88,24 @@ void BattleRenderer::RenderEntity(const ecs::components::Position& pos,
         return;
     }
 
-    void* texturePtr = systemAPI_->Resource().GetTexture(sprite.sheet_path);
-    if (!texturePtr) {
-        LOG_WARN("Texture not found: {}", sprite.sheet_path);
+    // キャラクターのシートはアトラス上の部分矩形として返る
+    const TextureRegion region = systemAPI_->Resource().GetTextureRegionByHandle(sprite.texture_handle);
+    Texture2D* texture = region.texture;
+    if (!texture) {
+        LOG_WARN("Texture not found: handle {}", sprite.texture_handle);
         return;
     }
-    auto* texture = static_cast<Texture2D*>(texturePtr);
-    if (!texture || texture->id == 0) {
-        LOG_WARN("Texture invalid: {}", sprite.sheet_path);
+    if (texture->id == 0) {
+        LOG_WARN("Texture invalid: handle {}", sprite.texture_handle);
         return;
     }
 
     const bool flip = (team && team->faction == ecs::components::Faction::Player);
-    Rectangle src = MakeSourceRect(sprite, anim, texture->width, texture->height, flip);
+    Rectangle src = MakeSourceRect(sprite, anim,
+                                   static_cast<int>(region.rect.width),
+                                   static_cast<int>(region.rect.height), flip);
+    src.x += region.rect.x;
+    src.y += region.rect.y;
 
     // 描画サイズ（2倍スケール）
     const float drawWidth = static_cast<float>(sprite.frame_width) * 2.0f;
@@ -99,8 +128,8 @@ void BattleRenderer::RenderEntity(const ecs::components::Position& pos,
     // 位置は「足允E��準」ではなく簡易に左上基準（後で調整�E�E
     // 回転中心は足元（基底ライン上）
     // 左上基準で描画（元のコードと同じ基準点）
-    systemAPI_->Render().DrawTexturePro(*texture, src, dst, {0.0f, 0.0f}, 0.0f,
-                                        WHITE);
+    systemAPI_->Render().SubmitSprite(*texture, src, dst, {0.0f, 0.0f}, 0.0f,
+                                      WHITE);
 }
 
 Rectangle BattleRenderer::MakeSourceRect(const ecs::components::Sprite& sprite,
@@ -129,8 +158,9 @@ Rectangle BattleRenderer::MakeSourceRect(const ecs::components::Sprite& sprite,
         fh
     };
 
+    // raylib は負の幅を同じ範囲の左右反転として扱うため x はずらさない
+    // （ずらすと隣のコマ、アトラスでは隣のシートを参照してしまう）
     if (flipHorizontally) {
-        src.x += fw;
         src.width = -fw;
     }
 
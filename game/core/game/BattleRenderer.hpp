@@ -20,7 +20,8 @@ public:
 
     void SetEcsAPI(ECSystemAPI* ecsAPI) { ecsAPI_ = ecsAPI; }
     void UpdateAnimations(ECSystemAPI* ecsAPI, float deltaTime);
-    void RenderEntities(ECSystemAPI* ecsAPI);
+    /// @brief ユニットを描画（位置は PreviousPosition → Position を interpolationAlpha で補間）
+    void RenderEntities(ECSystemAPI* ecsAPI, float interpolationAlpha = 1.0f);
 
 private:
     BaseSystemAPI* systemAPI_;
@@ -0,0 +1,48 @@
+#include "CombatEventStream.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+
+namespace game {
+namespace core {
+namespace game {
+
+uint64_t CombatEventStream::Push(const CombatEvent& event) {
+    const uint64_t sequence = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[sequence & (CAPACITY - 1)];
+
+    // 書き込み中は 0 にしておき、読み出し側に不完全なコピーを捨てさせる
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    slot.event.sequence = sequence;
+    slot.sequence.store(sequence, std::memory_order_release);
+
+    head_.store(sequence + 1, std::memory_order_release);
+    return sequence;
+}
+
+void CombatEventStream::Clear() {
+    oldest_.store(head_.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+uint64_t CombatEventStream::OldestSequence() const {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t oldest = oldest_.load(std::memory_order_acquire);
+    const uint64_t windowStart = (head > CAPACITY) ? head - CAPACITY : 1;
+    return std::max(oldest, windowStart);
+}
+
+bool CombatEventStream::TryCopy(uint64_t sequence, CombatEvent& out) const {
+    const Slot& slot = slots_[sequence & (CAPACITY - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    out = slot.event;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,126 @@
+#pragma once
+
+// 標準ライブラリ
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// 外部ライブラリ
+#include <entt/entt.hpp>
+
+namespace game {
+namespace core {
+namespace game {
+
+/// @brief 戦闘中に発生した1回の攻撃判定（POD）
+///
+/// ID文字列は持たず entt::entity を保持します。表示用のIDが必要な消費側は
+/// 読み出し時に CharacterId を引きます（対象が既に消滅していることもある）。
+struct CombatEvent {
+    enum class Kind : uint8_t {
+        UnitHit,         // ユニットへの命中
+        EnemyTowerHit,   // 敵タワーへの命中
+        PlayerTowerHit,  // 自タワーへの命中
+        Miss             // 攻撃判定時に対象が射程外
+    };
+
+    uint64_t sequence = 0;  // 1始まりの単調増加番号
+    float time = 0.0f;      // 戦闘開始からの経過秒
+    entt::entity attacker = entt::null;
+    entt::entity target = entt::null;  // タワー/ミス時は entt::null
+    float x = 0.0f;                    // 命中位置（対象の Position / タワー座標）
+    float y = 0.0f;
+    int damage = 0;
+    Kind kind = Kind::Miss;
+    bool lethal = false;  // この命中で対象（ユニット/タワー）の HP が 0 以下になった
+
+    bool IsHit() const { return kind != Kind::Miss; }
+};
+
+static_assert(std::is_trivially_copyable_v<CombatEvent>,
+              "CombatEvent はリングへ値コピーするため trivially copyable であること");
+
+/// @brief 固定容量・確保なしの戦闘イベントリング（単一書き込み・複数読み出し）
+///
+/// 書き込み側（戦闘更新）は Push() で O(1) に追記し、容量を超えた分は古い順に上書きされます。
+/// 読み出し側はそれぞれ「次に読む sequence」をカーソルとして自分で保持し、
+/// ReadSince() で前回以降のイベントだけを受け取ります。カーソルが周回遅れになった場合は
+/// 残っている最古のイベントから読み直します（取りこぼした件数は戻り値で分かる）。
+/// 各スロットは sequence を seqlock として使うため、別スレッドからの読み出しでも
+/// 書き換え途中のイベントは破棄されます。
+class CombatEventStream {
+public:
+    static constexpr size_t CAPACITY = 1024;  // 2の冪
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    CombatEventStream() = default;
+    ~CombatEventStream() = default;
+
+    CombatEventStream(const CombatEventStream&) = delete;
+    CombatEventStream& operator=(const CombatEventStream&) = delete;
+
+    /// @brief イベントを追記（event.sequence は上書きされる）
+    /// @return 付与した sequence
+    uint64_t Push(const CombatEvent& event);
+
+    /// @brief 以降の読み出し対象から既存イベントを外す（sequence は巻き戻さない）
+    void Clear();
+
+    /// @brief 次に書き込まれる sequence（新規の読み出し側はこれをカーソル初期値にすれば過去分を読まない）
+    uint64_t NextSequence() const { return head_.load(std::memory_order_acquire); }
+
+    /// @brief 読み出し可能な最古の sequence
+    uint64_t OldestSequence() const;
+
+    size_t Size() const { return static_cast<size_t>(NextSequence() - OldestSequence()); }
+    bool Empty() const { return Size() == 0; }
+
+    /// @brief cursor 以降のイベントを古い順にコールバックし、cursor を末尾へ進める
+    /// @param cursor 読み出し側が保持する次の sequence（0 なら最古から）
+    /// @param fn void(const CombatEvent&)
+    /// @return 上書きされて読めなかった件数
+    template<typename Fn>
+    uint64_t ReadSince(uint64_t& cursor, Fn&& fn) const;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};  // 0 = 書き込み中/未使用
+        CombatEvent event;
+    };
+
+    bool TryCopy(uint64_t sequence, CombatEvent& out) const;
+
+    std::array<Slot, CAPACITY> slots_;
+    std::atomic<uint64_t> head_{1};    // 次に書き込む sequence
+    std::atomic<uint64_t> oldest_{1};  // Clear() 済みの境界
+};
+
+// ========== テンプレート実装 ==========
+
+template<typename Fn>
+inline uint64_t CombatEventStream::ReadSince(uint64_t& cursor, Fn&& fn) const {
+    const uint64_t head = NextSequence();
+    const uint64_t oldest = OldestSequence();
+    uint64_t dropped = 0;
+    if (cursor < oldest) {
+        // 0 は「最古から」の意味なので取りこぼしに数えない
+        dropped = (cursor == 0) ? 0 : (oldest - cursor);
+        cursor = oldest;
+    }
+
+    CombatEvent event;
+    for (; cursor < head; ++cursor) {
+        if (TryCopy(cursor, event)) {
+            fn(event);
+        } else {
+            ++dropped;  // 読み出し中に書き込み側が追い越した
+        }
+    }
+    return dropped;
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
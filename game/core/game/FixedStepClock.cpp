@@ -0,0 +1,63 @@
+#include "FixedStepClock.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+namespace core {
+namespace game {
+
+FixedStepClock::FixedStepClock(float tickRate, int maxSubsteps)
+    : tickRate_(DEFAULT_TICK_RATE), step_(1.0f / DEFAULT_TICK_RATE),
+      maxSubsteps_(DEFAULT_MAX_SUBSTEPS), accumulator_(0.0), tickCount_(0),
+      droppedTime_(0.0) {
+    SetTickRate(tickRate);
+    SetMaxSubsteps(maxSubsteps);
+}
+
+void FixedStepClock::SetTickRate(float tickRate) {
+    tickRate_ = std::clamp(tickRate, 1.0f, 1000.0f);
+    step_ = 1.0f / tickRate_;
+    accumulator_ = 0.0;
+}
+
+void FixedStepClock::SetMaxSubsteps(int maxSubsteps) {
+    maxSubsteps_ = std::max(1, maxSubsteps);
+}
+
+void FixedStepClock::Reset() {
+    accumulator_ = 0.0;
+    tickCount_ = 0;
+    droppedTime_ = 0.0;
+}
+
+int FixedStepClock::Accumulate(float deltaTime) {
+    if (!(deltaTime > 0.0f)) {
+        return 0;
+    }
+    const double step = static_cast<double>(step_);
+    accumulator_ += static_cast<double>(deltaTime);
+
+    int steps = static_cast<int>(std::floor(accumulator_ / step));
+    if (steps > maxSubsteps_) {
+        steps = maxSubsteps_;
+    }
+    accumulator_ -= static_cast<double>(steps) * step;
+    if (accumulator_ >= step) {
+        // 上限で打ち切った分は捨て、1ティック未満の端数だけ持ち越す
+        const double kept = std::fmod(accumulator_, step);
+        droppedTime_ += accumulator_ - kept;
+        accumulator_ = kept;
+    }
+    tickCount_ += static_cast<uint64_t>(steps);
+    return steps;
+}
+
+float FixedStepClock::GetAlpha() const {
+    return std::clamp(static_cast<float>(accumulator_ / static_cast<double>(step_)), 0.0f, 1.0f);
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,56 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstdint>
+
+namespace game {
+namespace core {
+namespace game {
+
+/// @brief 可変フレーム時間を固定長ティックへ分割する累積器
+///
+/// Accumulate() に（速度倍率を掛けた）経過時間を渡すと、このフレームで実行すべき
+/// ティック数を返します。1フレームのティック数は maxSubsteps で打ち切り、
+/// 超過分の時間は捨てます（ヒッチ時に処理が雪だるま式に増えるのを防ぐ）。
+/// 余りは次フレームへ持ち越し、GetAlpha() で描画補間係数として参照できます。
+class FixedStepClock {
+public:
+    static constexpr float DEFAULT_TICK_RATE = 60.0f;
+    static constexpr int DEFAULT_MAX_SUBSTEPS = 8;
+
+    FixedStepClock(float tickRate = DEFAULT_TICK_RATE, int maxSubsteps = DEFAULT_MAX_SUBSTEPS);
+    ~FixedStepClock() = default;
+
+    /// @brief 1秒あたりのティック数を設定（累積中の余りは破棄）
+    void SetTickRate(float tickRate);
+    float GetTickRate() const { return tickRate_; }
+    float GetStep() const { return step_; }
+
+    void SetMaxSubsteps(int maxSubsteps);
+    int GetMaxSubsteps() const { return maxSubsteps_; }
+
+    /// @brief 累積時間と統計を初期化
+    void Reset();
+
+    /// @brief 経過時間を加算し、実行すべきティック数を返す
+    int Accumulate(float deltaTime);
+
+    /// @brief 前ティックから次ティックまでの補間係数 [0, 1)
+    float GetAlpha() const;
+
+    uint64_t GetTickCount() const { return tickCount_; }
+    /// @brief maxSubsteps 超過で捨てたシミュレーション時間（秒）
+    double GetDroppedTime() const { return droppedTime_; }
+
+private:
+    float tickRate_;
+    float step_;
+    int maxSubsteps_;
+    double accumulator_;
+    uint64_t tickCount_;
+    double droppedTime_;
+};
+
+} // namespace game
+} // namespace core
+} // namespace game
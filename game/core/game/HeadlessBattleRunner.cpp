@@ -0,0 +1,157 @@
+#include "HeadlessBattleRunner.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <chrono>
+
+// プロジェクト内
+#include "../../utils/Log.h"
+#include "../api/BattleSetupAPI.hpp"
+#include "../api/ECSystemAPI.hpp"
+#include "../api/GameplayDataAPI.hpp"
+#include "../api/SetupAPI.hpp"
+#include "../ui/BattleHUDRenderer.hpp"
+
+namespace game {
+namespace core {
+namespace game {
+
+HeadlessBattleRunner::HeadlessBattleRunner()
+    : isInitialized_(false) {
+}
+
+HeadlessBattleRunner::~HeadlessBattleRunner() {
+    Shutdown();
+}
+
+bool HeadlessBattleRunner::Initialize() {
+    if (isInitialized_) {
+        return true;
+    }
+
+    gameplayDataAPI_ = std::make_unique<GameplayDataAPI>();
+    // 並列ワーカーが同じセーブを書き合わないよう、読み込みだけにする
+    gameplayDataAPI_->SetSaveWritesEnabled(false);
+    ecsAPI_ = std::make_unique<ECSystemAPI>();
+
+    setupAPI_ = std::make_unique<SetupAPI>();
+    if (!setupAPI_->Initialize(nullptr, gameplayDataAPI_.get(), ecsAPI_.get(), &sharedContext_)) {
+        LOG_ERROR("HeadlessBattleRunner: SetupAPI initialization failed");
+        return false;
+    }
+
+    battleSetupAPI_ = std::make_unique<BattleSetupAPI>();
+    if (!battleSetupAPI_->Initialize(gameplayDataAPI_.get(), setupAPI_.get(), &sharedContext_)) {
+        LOG_ERROR("HeadlessBattleRunner: BattleSetupAPI initialization failed");
+        return false;
+    }
+
+    battleProgressAPI_ = std::make_unique<BattleProgressAPI>();
+    if (!battleProgressAPI_->Initialize(&sharedContext_)) {
+        LOG_ERROR("HeadlessBattleRunner: BattleProgressAPI initialization failed");
+        return false;
+    }
+    sharedContext_.battleProgressAPI = battleProgressAPI_.get();
+
+    // シミュレーションはセーブデータを書き換えず、描画用の戦闘イベントも不要
+    battleProgressAPI_->SetResultPersistenceEnabled(false);
+    battleProgressAPI_->SetCombatEventsEnabled(false);
+
+    isInitialized_ = true;
+    return true;
+}
+
+void HeadlessBattleRunner::Shutdown() {
+    if (ecsAPI_) {
+        ecsAPI_->ResetForScene();
+    }
+    sharedContext_.battleProgressAPI = nullptr;
+    battleProgressAPI_.reset();
+    battleSetupAPI_.reset();
+    setupAPI_.reset();
+    ecsAPI_.reset();
+    if (gameplayDataAPI_) {
+        gameplayDataAPI_->Shutdown();
+        gameplayDataAPI_.reset();
+    }
+    isInitialized_ = false;
+}
+
+HeadlessBattleResult HeadlessBattleRunner::Run(const HeadlessBattleConfig& config) {
+    HeadlessBattleResult result;
+    result.stageId = config.stageId;
+    if (!isInitialized_) {
+        LOG_ERROR("HeadlessBattleRunner::Run: not initialized");
+        return result;
+    }
+
+    const float dt = (config.fixedDeltaTime > 0.0f) ? config.fixedDeltaTime : (1.0f / 60.0f);
+
+    // 前回の戦闘のエンティティを破棄し、編成を確定させてから戦闘を構築
+    ecsAPI_->ResetForScene();
+    sharedContext_.currentStageId = config.stageId;
+    if (!config.formation.IsEmpty()) {
+        sharedContext_.formationData = config.formation;
+    } else {
+        gameplayDataAPI_->ApplyToSharedContext(sharedContext_);
+    }
+    sharedContext_.battleSetupData =
+        battleSetupAPI_->BuildBattleSetupData(config.stageId, sharedContext_.formationData);
+    battleProgressAPI_->InitializeFromSetupData(sharedContext_.battleSetupData);
+    battleProgressAPI_->SetGameSpeed(1.0f);
+    battleProgressAPI_->SetPaused(false);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (battleProgressAPI_->GetBattleResult() == BattleProgressAPI::BattleResult::InProgress) {
+        if (battleProgressAPI_->GetBattleTime() >= config.maxBattleSeconds) {
+            result.timedOut = true;
+            break;
+        }
+        if (config.autoSpawn) {
+            AutoSpawn();
+        }
+        battleProgressAPI_->Update(dt);
+        ++result.ticks;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    result.wallSeconds = std::chrono::duration<double>(end - start).count();
+
+    const auto stats = battleProgressAPI_->GetBattleStats();
+    result.result = battleProgressAPI_->GetBattleResult();
+    result.clearTime = battleProgressAPI_->GetBattleTime();
+    result.playerTowerHp = battleProgressAPI_->GetPlayerTower().currentHp;
+    result.playerTowerMaxHp = battleProgressAPI_->GetPlayerTower().maxHp;
+    result.enemyTowerHp = battleProgressAPI_->GetEnemyTower().currentHp;
+    result.enemyTowerMaxHp = battleProgressAPI_->GetEnemyTower().maxHp;
+    result.spawnedUnitCount = stats.spawnedUnitCount;
+    result.totalGoldSpent = stats.totalGoldSpent;
+    return result;
+}
+
+void HeadlessBattleRunner::AutoSpawn() {
+    // 編成スロット順に、クールダウン明けかつ所持金が足りるユニットを出撃させる
+    const float now = battleProgressAPI_->GetBattleTime();
+    const auto& cooldowns = battleProgressAPI_->GetUnitCooldownUntil();
+    for (const auto& slot : sharedContext_.formationData.slots) {
+        const std::string& unitId = slot.second;
+        if (unitId.empty()) {
+            continue;
+        }
+        const auto it = cooldowns.find(unitId);
+        if (it != cooldowns.end() && now < it->second) {
+            continue;
+        }
+        const auto* tmpl = gameplayDataAPI_->GetBattleTemplate(unitId);
+        if (!tmpl || battleProgressAPI_->GetGold() < tmpl->cost) {
+            continue;
+        }
+        ui::BattleHUDAction action;
+        action.type = ui::BattleHUDActionType::SpawnUnit;
+        action.unitId = unitId;
+        battleProgressAPI_->HandleHUDAction(action);
+    }
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,86 @@
+#pragma once
+
+// 標準ライブラリ
+#include <memory>
+#include <string>
+
+// プロジェクト内
+#include "../api/BattleProgressAPI.hpp"
+#include "../config/SharedContext.hpp"
+
+namespace game {
+namespace core {
+
+class ECSystemAPI;
+class GameplayDataAPI;
+class SetupAPI;
+class BattleSetupAPI;
+
+namespace game {
+
+/// @brief ヘッドレス戦闘シミュレーションの設定
+struct HeadlessBattleConfig {
+    std::string stageId;
+    FormationData formation;              // 空ならセーブデータの編成を使用
+    float fixedDeltaTime = 1.0f / 60.0f;  // 固定ステップ（秒）
+    float maxBattleSeconds = 600.0f;      // 打ち切り時間（戦闘内時間）
+    bool autoSpawn = true;                // 出撃可能な編成ユニットを自動で出撃させる
+};
+
+/// @brief ヘッドレス戦闘シミュレーションの結果
+struct HeadlessBattleResult {
+    std::string stageId;
+    BattleProgressAPI::BattleResult result = BattleProgressAPI::BattleResult::InProgress;
+    bool timedOut = false;
+    float clearTime = 0.0f;
+    int playerTowerHp = 0;
+    int playerTowerMaxHp = 0;
+    int enemyTowerHp = 0;
+    int enemyTowerMaxHp = 0;
+    int spawnedUnitCount = 0;
+    int totalGoldSpent = 0;
+    int ticks = 0;
+    double wallSeconds = 0.0;
+
+    /// @brief シミュレーション秒 / 実時間秒（スループット）
+    double SimSecondsPerWallSecond() const {
+        return (wallSeconds > 0.0) ? static_cast<double>(clearTime) / wallSeconds : 0.0;
+    }
+};
+
+/// @brief ウィンドウ/オーディオなしで戦闘を固定ステップ実行するランナー
+///
+/// GameSystem と同じ順序で GameplayDataAPI / ECSystemAPI / SetupAPI /
+/// BattleSetupAPI / BattleProgressAPI を自前の SharedContext で構築します。
+/// インスタンスごとに独立した entt::registry を持つため、スレッド毎に1つ生成すれば並列実行できます。
+/// data/ 配下の相対パスを読むため、カレントディレクトリは data/ の親である必要があります。
+class HeadlessBattleRunner {
+public:
+    HeadlessBattleRunner();
+    ~HeadlessBattleRunner();
+
+    bool Initialize();
+    void Shutdown();
+    bool IsInitialized() const { return isInitialized_; }
+
+    /// @brief 1戦闘を最後まで（または打ち切り時間まで）実行
+    HeadlessBattleResult Run(const HeadlessBattleConfig& config);
+
+    GameplayDataAPI* GetGameplayDataAPI() { return gameplayDataAPI_.get(); }
+    const GameplayDataAPI* GetGameplayDataAPI() const { return gameplayDataAPI_.get(); }
+
+private:
+    void AutoSpawn();
+
+    std::unique_ptr<GameplayDataAPI> gameplayDataAPI_;
+    std::unique_ptr<ECSystemAPI> ecsAPI_;
+    std::unique_ptr<SetupAPI> setupAPI_;
+    std::unique_ptr<BattleSetupAPI> battleSetupAPI_;
+    std::unique_ptr<BattleProgressAPI> battleProgressAPI_;
+    SharedContext sharedContext_;
+    bool isInitialized_;
+};
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,109 @@
+#include "HitEffectEmitter.hpp"
+
+// プロジェクト内
+#include "../api/BattleProgressAPI.hpp"
+#include "../api/ECSystemAPI.hpp"
+#include "../ecs/defineComponents.hpp"
+
+namespace game {
+namespace core {
+namespace game {
+
+namespace {
+
+constexpr float kUp = -1.5707964f;  // 画面上方向（ラジアン）
+
+/// @brief ユニット命中の火花
+ParticleBurst MakeHitSpark(float x, float y) {
+    ParticleBurst burst;
+    burst.x = x;
+    burst.y = y;
+    burst.count = 10;
+    burst.angle = kUp;
+    burst.spread = 2.6f;
+    burst.speedMin = 120.0f;
+    burst.speedMax = 320.0f;
+    burst.lifeMin = 0.15f;
+    burst.lifeMax = 0.35f;
+    burst.sizeMin = 3.0f;
+    burst.sizeMax = 6.0f;
+    burst.color = Color{255, 214, 120, 255};
+    return burst;
+}
+
+/// @brief ユニット撃破の破片
+ParticleBurst MakeDeathBurst(float x, float y) {
+    ParticleBurst burst;
+    burst.x = x - 16.0f;
+    burst.y = y - 16.0f;
+    burst.width = 32.0f;
+    burst.height = 32.0f;
+    burst.count = 28;
+    burst.speedMin = 60.0f;
+    burst.speedMax = 280.0f;
+    burst.lifeMin = 0.4f;
+    burst.lifeMax = 0.8f;
+    burst.sizeMin = 4.0f;
+    burst.sizeMax = 9.0f;
+    burst.color = Color{235, 90, 70, 255};
+    return burst;
+}
+
+/// @brief タワー命中の外壁の破片（lethal なら量を増やす）
+ParticleBurst MakeTowerDebris(const BattleProgressAPI::TowerState& tower, bool lethal) {
+    ParticleBurst burst;
+    burst.x = tower.x - tower.width * 0.5f;
+    burst.y = tower.y - tower.height * 0.6f;
+    burst.width = tower.width;
+    burst.height = tower.height * 0.2f;
+    burst.count = lethal ? 80 : 12;
+    burst.angle = kUp;
+    burst.spread = 2.2f;
+    burst.speedMin = 80.0f;
+    burst.speedMax = lethal ? 420.0f : 260.0f;
+    burst.lifeMin = 0.3f;
+    burst.lifeMax = lethal ? 1.2f : 0.6f;
+    burst.sizeMin = 4.0f;
+    burst.sizeMax = 8.0f;
+    burst.color = Color{200, 190, 175, 255};
+    return burst;
+}
+
+} // namespace
+
+void HitEffectEmitter::Consume(const BattleProgressAPI& battle, const ECSystemAPI* ecsAPI,
+                               ParticlePool& pool) {
+    using Kind = CombatEvent::Kind;
+    battle.GetCombatEvents().ReadSince(cursor_, [&](const CombatEvent& event) {
+        switch (event.kind) {
+        case Kind::UnitHit: {
+            // イベント座標はスプライトの Position（左上基準）。BattleRenderer は2倍で
+            // (x, y - frame_height) から描くので、見た目の中心は (x + frame_width, y)
+            float cx = event.x;
+            const float cy = event.y;
+            if (ecsAPI && ecsAPI->Valid(event.target)) {
+                if (const auto* sprite = ecsAPI->Try<ecs::components::Sprite>(event.target)) {
+                    cx += static_cast<float>(sprite->frame_width);
+                }
+            }
+            pool.Emit(MakeHitSpark(cx, cy));
+            if (event.lethal) {
+                pool.Emit(MakeDeathBurst(cx, cy));
+            }
+            break;
+        }
+        case Kind::EnemyTowerHit:
+            pool.Emit(MakeTowerDebris(battle.GetEnemyTower(), event.lethal));
+            break;
+        case Kind::PlayerTowerHit:
+            pool.Emit(MakeTowerDebris(battle.GetPlayerTower(), event.lethal));
+            break;
+        case Kind::Miss:
+            break;
+        }
+    });
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,40 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstdint>
+
+// プロジェクト内
+#include "ParticlePool.hpp"
+
+namespace game {
+namespace core {
+
+class BattleProgressAPI;
+class ECSystemAPI;
+
+namespace game {
+
+/// @brief 戦闘イベントから命中/撃破エフェクトを ParticlePool へ発生させる
+///
+/// BattleProgressAPI の CombatEventStream を自前のカーソルで読むため、
+/// ダメージポップアップなど他の読み出し側とは独立して動きます。
+/// ユニットへの命中は火花、撃破（lethal）はより大きな破片、タワーへの命中は外壁の破片を出します。
+class HitEffectEmitter {
+public:
+    HitEffectEmitter() = default;
+    ~HitEffectEmitter() = default;
+
+    /// @brief 前回以降の戦闘イベントを読み、エフェクトを pool に発生させる
+    /// @param ecsAPI 命中位置をスプライト中心へ補正するのに使う（nullptr ならイベント座標のまま）
+    void Consume(const BattleProgressAPI& battle, const ECSystemAPI* ecsAPI, ParticlePool& pool);
+
+    /// @brief カーソルを初期化（次回は残っている最古のイベントから読む）
+    void Reset() { cursor_ = 0; }
+
+private:
+    uint64_t cursor_ = 0;  // 次に読む戦闘イベントの sequence
+};
+
+} // namespace game
+} // namespace core
+} // namespace game
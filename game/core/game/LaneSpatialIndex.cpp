@@ -0,0 +1,47 @@
+#include "LaneSpatialIndex.hpp"
+
+namespace game {
+namespace core {
+namespace game {
+
+void LaneSpatialIndex::Clear() {
+    players_.clear();
+    enemies_.clear();
+}
+
+void LaneSpatialIndex::Reserve(size_t countPerFaction) {
+    players_.reserve(countPerFaction);
+    enemies_.reserve(countPerFaction);
+}
+
+void LaneSpatialIndex::Add(ecs::components::Faction faction, entt::entity entity, float center) {
+    Bucket(faction).push_back(Entry{center, entity});
+}
+
+void LaneSpatialIndex::Build() {
+    auto byCenter = [](const Entry& a, const Entry& b) { return a.center < b.center; };
+    std::sort(players_.begin(), players_.end(), byCenter);
+    std::sort(enemies_.begin(), enemies_.end(), byCenter);
+}
+
+size_t LaneSpatialIndex::Count(ecs::components::Faction faction) const {
+    return Bucket(faction).size();
+}
+
+const std::vector<LaneSpatialIndex::Entry>& LaneSpatialIndex::Entries(
+    ecs::components::Faction faction) const {
+    return Bucket(faction);
+}
+
+std::vector<LaneSpatialIndex::Entry>& LaneSpatialIndex::Bucket(ecs::components::Faction faction) {
+    return (faction == ecs::components::Faction::Player) ? players_ : enemies_;
+}
+
+const std::vector<LaneSpatialIndex::Entry>& LaneSpatialIndex::Bucket(
+    ecs::components::Faction faction) const {
+    return (faction == ecs::components::Faction::Player) ? players_ : enemies_;
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -0,0 +1,109 @@
+#pragma once
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// 外部ライブラリ
+#include <entt/entt.hpp>
+
+// プロジェクト内
+#include "../ecs/defineComponents.hpp"
+
+namespace game {
+namespace core {
+namespace game {
+
+/// @brief レーン上のユニット中心Xを陣営ごとにソート保持する1次元空間インデックス
+///
+/// BattleProgressAPI がフレーム毎に Build し直し、最近傍の敵検索を
+/// O(log N) の二分探索で行うために使用します。
+/// 死亡判定などフレーム途中で変わる条件は、検索時の述語で除外します。
+class LaneSpatialIndex {
+public:
+    struct Entry {
+        float center = 0.0f;
+        entt::entity entity = entt::null;
+    };
+
+    LaneSpatialIndex() = default;
+    ~LaneSpatialIndex() = default;
+
+    void Clear();
+    void Reserve(size_t countPerFaction);
+
+    /// @brief エントリを追加（Build() までは未ソート）
+    void Add(ecs::components::Faction faction, entt::entity entity, float center);
+
+    /// @brief 追加済みエントリを中心X昇順に整列
+    void Build();
+
+    size_t Count(ecs::components::Faction faction) const;
+    const std::vector<Entry>& Entries(ecs::components::Faction faction) const;
+
+    /// @brief 指定陣営の中から center に最も近いエントリを返す
+    /// @param faction 検索対象の陣営
+    /// @param center 基準となる中心X
+    /// @param isCandidate 候補にできるか判定する述語（bool(entt::entity)）
+    /// @param outDistance 見つかった場合の距離（任意）
+    /// @return 見つからなければ entt::null
+    template<typename Predicate>
+    entt::entity FindNearest(ecs::components::Faction faction,
+                             float center,
+                             Predicate&& isCandidate,
+                             float* outDistance = nullptr) const;
+
+private:
+    std::vector<Entry>& Bucket(ecs::components::Faction faction);
+    const std::vector<Entry>& Bucket(ecs::components::Faction faction) const;
+
+    std::vector<Entry> players_;
+    std::vector<Entry> enemies_;
+};
+
+// ========== テンプレート実装 ==========
+
+template<typename Predicate>
+inline entt::entity LaneSpatialIndex::FindNearest(ecs::components::Faction faction,
+                                                  float center,
+                                                  Predicate&& isCandidate,
+                                                  float* outDistance) const {
+    const auto& entries = Bucket(faction);
+    if (entries.empty()) {
+        return entt::null;
+    }
+
+    // center 以上の最初の要素を起点に、左右へ広げながら最も近い候補を探す
+    const auto pivot = std::lower_bound(
+        entries.begin(), entries.end(), center,
+        [](const Entry& entry, float value) { return entry.center < value; });
+    std::ptrdiff_t right = pivot - entries.begin();
+    std::ptrdiff_t left = right - 1;
+    const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(entries.size());
+
+    while (left >= 0 || right < size) {
+        const float leftDist = (left >= 0) ? std::abs(center - entries[left].center) : 1e9f;
+        const float rightDist = (right < size) ? std::abs(entries[right].center - center) : 1e9f;
+        const bool takeLeft = (left >= 0) && (right >= size || leftDist <= rightDist);
+        const Entry& entry = takeLeft ? entries[left] : entries[right];
+        if (takeLeft) {
+            --left;
+        } else {
+            ++right;
+        }
+        if (!isCandidate(entry.entity)) {
+            continue;
+        }
+        if (outDistance) {
+            *outDistance = takeLeft ? leftDist : rightDist;
+        }
+        return entry.entity;
+    }
+    return entt::null;
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
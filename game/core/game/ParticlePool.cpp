@@ -0,0 +1,144 @@
+#include "ParticlePool.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cmath>
+
+// プロジェクト内
+#include "../api/RenderSystemAPI.hpp"
+#include "../system/Profiler.hpp"
+
+namespace game {
+namespace core {
+namespace game {
+
+namespace {
+
+/// @brief 速度・位置・寿命・アルファの積分
+/// @details 分岐がなく、restrict 付きの要素ごとの配列だけを読み書きするため -O3 で自動ベクトル化される。
+///          std::min/max は参照を返してベクトル化を妨げるので、丸めは三項演算子で書く。
+void IntegrateKernel(float* __restrict px, float* __restrict py,
+                     float* __restrict vx, float* __restrict vy,
+                     float* __restrict life, const float* __restrict invLife,
+                     float* __restrict alpha, size_t n, float dt,
+                     float gravityStep, float damping) {
+    for (size_t i = 0; i < n; ++i) {
+        vx[i] *= damping;
+        vy[i] = (vy[i] + gravityStep) * damping;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        life[i] -= dt;
+        const float t = life[i] * invLife[i];
+        alpha[i] = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    }
+}
+
+} // namespace
+
+ParticlePool::ParticlePool(size_t capacity, uint32_t seed)
+    : capacity_(capacity), alive_(0), gravityY_(0.0f), drag_(0.0f),
+      rngState_(seed != 0 ? seed : 1u), emitted_(0), dropped_(0),
+      x_(capacity), y_(capacity), vx_(capacity), vy_(capacity), life_(capacity),
+      invLife_(capacity), alpha_(capacity), size_(capacity), color_(capacity) {
+}
+
+void ParticlePool::SetForces(float gravityY, float drag) {
+    gravityY_ = gravityY;
+    drag_ = std::max(0.0f, drag);
+}
+
+float ParticlePool::NextFloat() {
+    // xorshift32（上位24bitを仮数に使う）
+    uint32_t s = rngState_;
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    rngState_ = s;
+    return static_cast<float>(s >> 8) * (1.0f / 16777216.0f);
+}
+
+int ParticlePool::Emit(const ParticleBurst& burst) {
+    if (burst.count <= 0) {
+        return 0;
+    }
+    const size_t requested = static_cast<size_t>(burst.count);
+    const size_t n = std::min(requested, capacity_ - alive_);
+    dropped_ += requested - n;
+
+    auto lerp = [](float a, float b, float t) { return a + (b - a) * t; };
+    for (size_t k = 0; k < n; ++k) {
+        const size_t i = alive_ + k;
+        const float dir = burst.angle + (NextFloat() - 0.5f) * burst.spread;
+        const float speed = lerp(burst.speedMin, burst.speedMax, NextFloat());
+        const float life = std::max(0.001f, lerp(burst.lifeMin, burst.lifeMax, NextFloat()));
+        x_[i] = burst.x + burst.width * NextFloat();
+        y_[i] = burst.y + burst.height * NextFloat();
+        vx_[i] = std::cos(dir) * speed;
+        vy_[i] = std::sin(dir) * speed;
+        life_[i] = life;
+        invLife_[i] = 1.0f / life;
+        alpha_[i] = 1.0f;
+        size_[i] = lerp(burst.sizeMin, burst.sizeMax, NextFloat());
+        color_[i] = burst.color;
+    }
+    alive_ += n;
+    emitted_ += n;
+    return static_cast<int>(n);
+}
+
+void ParticlePool::Update(float deltaTime) {
+    if (alive_ == 0 || deltaTime <= 0.0f) {
+        return;
+    }
+    PROFILE_SCOPE("ParticlePool::Update");
+
+    IntegrateKernel(x_.data(), y_.data(), vx_.data(), vy_.data(), life_.data(),
+                    invLife_.data(), alpha_.data(), alive_, deltaTime, gravityY_ * deltaTime,
+                    std::max(0.0f, 1.0f - drag_ * deltaTime));
+
+    // 寿命切れを末尾と入れ替えて詰める（順序は保たない）
+    size_t i = 0;
+    size_t end = alive_;
+    while (i < end) {
+        if (life_[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        --end;
+        x_[i] = x_[end];
+        y_[i] = y_[end];
+        vx_[i] = vx_[end];
+        vy_[i] = vy_[end];
+        life_[i] = life_[end];
+        invLife_[i] = invLife_[end];
+        alpha_[i] = alpha_[end];
+        size_[i] = size_[end];
+        color_[i] = color_[end];
+    }
+    alive_ = end;
+}
+
+void ParticlePool::Draw(RenderSystemAPI& render) const {
+    if (alive_ == 0) {
+        return;
+    }
+    render.DrawParticleQuads(x_.data(), y_.data(), size_.data(), alpha_.data(),
+                             color_.data(), alive_);
+}
+
+void ParticlePool::Clear() {
+    alive_ = 0;
+}
+
+ParticlePool::Stats ParticlePool::GetStats() const {
+    Stats stats;
+    stats.alive = alive_;
+    stats.capacity = capacity_;
+    stats.emitted = emitted_;
+    stats.dropped = dropped_;
+    return stats;
+}
+
+} // namespace game
+} // namespace core
+} // namespace game
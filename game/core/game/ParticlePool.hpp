@@ -0,0 +1,100 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// プロジェクト内
+#include "../config/RenderTypes.hpp"
+
+namespace game {
+namespace core {
+
+class RenderSystemAPI;
+
+namespace game {
+
+/// @brief 1回の発生要求（範囲はすべて [min, max] の一様乱数）
+struct ParticleBurst {
+    float x = 0.0f;       // 発生位置（width/height が 0 なら点、それ以外は矩形の左上）
+    float y = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+    int count = 0;
+    float angle = 0.0f;          // 射出方向の中心（ラジアン、0 = +X、画面座標なので +Y が下）
+    float spread = 6.2831853f;   // 射出方向の幅（ラジアン、既定は全方向）
+    float speedMin = 0.0f;
+    float speedMax = 0.0f;
+    float lifeMin = 0.5f;        // 寿命（秒）
+    float lifeMax = 0.5f;
+    float sizeMin = 2.0f;        // 一辺（px）
+    float sizeMax = 2.0f;
+    Color color = WHITE;         // 寿命に応じて a が 0 へ向かう
+};
+
+/// @brief 固定容量・SoA のパーティクルプール
+///
+/// 位置/速度/寿命/アルファを要素ごとの配列で持ち、生存中の粒子は常に先頭 [0, Alive()) に詰めます。
+/// Update() は分岐のない1本のループで全粒子を積分するため、コンパイラの自動ベクトル化が効きます
+/// （組み込み関数は使わないので Emscripten でもそのまま動く）。寿命が尽きた粒子は末尾と入れ替えて詰めます。
+/// 容量を超えた発生要求は捨てて Stats::dropped に数えます（確保は構築時の1回だけ）。
+/// 描画は RenderSystemAPI::DrawParticleQuads で全粒子を1回の四角形バッチとして投入します。
+class ParticlePool {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8192;
+
+    struct Stats {
+        size_t alive = 0;
+        size_t capacity = 0;
+        uint64_t emitted = 0;
+        uint64_t dropped = 0;  // 容量超過で発生させなかった数
+    };
+
+    explicit ParticlePool(size_t capacity = DEFAULT_CAPACITY, uint32_t seed = 0x9E3779B9u);
+    ~ParticlePool() = default;
+
+    /// @brief 全粒子に共通の加速度と減衰（gravityY は px/s^2、drag は 1/s）
+    void SetForces(float gravityY, float drag);
+
+    /// @brief 粒子を発生させる
+    /// @return 実際に発生させた数（容量不足なら burst.count より少ない）
+    int Emit(const ParticleBurst& burst);
+
+    /// @brief 全粒子を deltaTime 秒進め、寿命切れを取り除く
+    void Update(float deltaTime);
+
+    /// @brief 全粒子を1回のバッチで描画
+    void Draw(RenderSystemAPI& render) const;
+
+    void Clear();
+
+    size_t Alive() const { return alive_; }
+    size_t Capacity() const { return capacity_; }
+    Stats GetStats() const;
+
+private:
+    float NextFloat();  // [0, 1)
+
+    size_t capacity_;
+    size_t alive_;
+    float gravityY_;
+    float drag_;
+    uint32_t rngState_;
+    uint64_t emitted_;
+    uint64_t dropped_;
+
+    std::vector<float> x_;
+    std::vector<float> y_;
+    std::vector<float> vx_;
+    std::vector<float> vy_;
+    std::vector<float> life_;     // 残り寿命（秒）
+    std::vector<float> invLife_;  // 1 / 初期寿命
+    std::vector<float> alpha_;    // life_ * invLife_ を [0, 1] に丸めたもの
+    std::vector<float> size_;
+    std::vector<Color> color_;
+};
+
+} // namespace game
+} // namespace core
+} // namespace game
@@ -37,6 +37,8 @@ bool ResourceInitializer::Initialize(BaseSystemAPI* systemAPI) {
 
         // デフォルトフォントを設定
         systemAPI_->Resource().SetDefaultFont("NotoSansJP-Medium.ttf", 32);
+        // データ中の文字列に出るグリフだけ先に用意（残りは描画時に追加）
+        systemAPI_->Resource().PrewarmFontGlyphs("NotoSansJP-Medium.ttf", "data");
         LOG_INFO("Default font set successfully");
 
         // ディレクトリスキャンを実行
@@ -233,20 +233,22 @@ void EditorScene::Render() {
     systemAPI_->Render().DrawRectangle(panelX, panelY, panelW, panelH,
                                        ToCoreColor(ui::OverlayColors::PANEL_BG));
 
-    void* texturePtr = systemAPI_->Resource().GetTexture(ch->attack_sprite.sheet_path);
-    if (!texturePtr) {
+    const auto& sprite = previewUseMoveSprite_ ? ch->move_sprite : ch->attack_sprite;
+    // シートはアトラス上の部分矩形として返る（単体テクスチャを別に読まない）
+    const TextureRegion region = systemAPI_->Resource().GetTextureRegion(sprite.sheet_path);
+    if (!region.texture) {
         systemAPI_->Render().DrawTextDefault(
-            "Attack sprite not found", panelX + 20.0f, panelY + 20.0f, 18.0f,
+            previewUseMoveSprite_ ? "Move sprite not found" : "Attack sprite not found",
+            panelX + 20.0f, panelY + 20.0f, 18.0f,
             ToCoreColor(ui::OverlayColors::TEXT_MUTED));
         return;
     }
 
-    auto* texture = static_cast<Texture2D*>(texturePtr);
-    if (!texture || texture->id == 0) {
+    Texture2D* texture = region.texture;
+    if (texture->id == 0) {
         return;
     }
 
-    const auto& sprite = previewUseMoveSprite_ ? ch->move_sprite : ch->attack_sprite;
     const int frameCount = std::max(1, sprite.frame_count);
     const float fw = static_cast<float>(sprite.frame_width);
     const float fh = static_cast<float>(sprite.frame_height);
@@ -255,7 +257,7 @@ void EditorScene::Render() {
     const float clampedTime = std::min(previewTime_, previewDuration);
     const int frame = std::min(static_cast<int>(clampedTime / frameDuration),
                                frameCount - 1);
-    Rectangle src{fw * static_cast<float>(frame), 0.0f, fw, fh};
+    Rectangle src{region.rect.x + fw * static_cast<float>(frame), region.rect.y, fw, fh};
 
     const float dstX = panelX + (panelW - fw) * 0.5f;
     const float dstY = panelY + (panelH - fh) * 0.5f;
@@ -1555,7 +1557,7 @@ void EditorScene::RenderStageTab() {
 void EditorScene::RenderBattleDebugTab() {
     if (sharedContext_ && sharedContext_->battleProgressAPI) {
         auto* battle = sharedContext_->battleProgressAPI;
-        attackLogEnabled_ = battle->IsAttackLogEnabled();
+        attackLogEnabled_ = battle->IsCombatEventsEnabled();
         float speed = battle->GetGameSpeed();
         bool paused = battle->IsPaused();
         if (ImGui::SliderFloat("GameSpeed", &speed, 0.1f, 3.0f, "%.2f")) {
@@ -1565,29 +1567,49 @@ void EditorScene::RenderBattleDebugTab() {
             battle->SetPaused(paused);
         }
         ImGui::SameLine();
-        if (ui::ImGuiSound::Button(systemAPI_, "Step 1/60")) {
-            battle->Update(1.0f / 60.0f);
+        if (ui::ImGuiSound::Button(systemAPI_, "Step 1 tick")) {
+            battle->StepFixed();
         }
 
         ImGui::Separator();
         if (ui::ImGuiSound::Checkbox(systemAPI_, "AttackLogEnabled", &attackLogEnabled_)) {
-            battle->SetAttackLogEnabled(attackLogEnabled_);
+            battle->SetCombatEventsEnabled(attackLogEnabled_);
         }
         ImGui::SameLine();
         if (ui::ImGuiSound::Button(systemAPI_, "ClearLog")) {
-            battle->ClearAttackLog();
+            battle->ClearCombatEvents();
         }
         ui::ImGuiSound::Checkbox(systemAPI_, "ShowAttackLog", &showAttackLog_);
         if (showAttackLog_) {
             ImGui::BeginChild("AttackLog", ImVec2(0, 160), true);
-            for (const auto& entry : battle->GetAttackLog()) {
-                ImGui::Text("[%.2f] %s -> %s dmg=%d %s",
-                            entry.time,
-                            entry.attackerId.c_str(),
-                            entry.targetId.c_str(),
-                            entry.damage,
-                            entry.hit ? "hit" : "miss");
-            }
+            using CombatEvent = ::game::core::game::CombatEvent;
+            // 表示用IDは描画時に解決する（既に倒されたエンティティは despawned）
+            auto describe = [this](entt::entity entity) -> const char* {
+                if (entity == entt::null || !sharedContext_->ecsAPI ||
+                    !sharedContext_->ecsAPI->Valid(entity)) {
+                    return "despawned";
+                }
+                const auto* cid = sharedContext_->ecsAPI->Try<ecs::components::CharacterId>(entity);
+                return cid ? cid->id.c_str() : "unknown";
+            };
+            auto describeTarget = [&](const CombatEvent& event) -> const char* {
+                switch (event.kind) {
+                case CombatEvent::Kind::EnemyTowerHit: return "tower_enemy";
+                case CombatEvent::Kind::PlayerTowerHit: return "tower_player";
+                case CombatEvent::Kind::Miss: return "none";
+                default: return describe(event.target);
+                }
+            };
+            uint64_t cursor = 0;
+            battle->GetCombatEvents().ReadSince(cursor, [&](const CombatEvent& event) {
+                ImGui::Text("[%.2f] #%llu %s -> %s dmg=%d %s",
+                            event.time,
+                            static_cast<unsigned long long>(event.sequence),
+                            describe(event.attacker),
+                            describeTarget(event),
+                            event.damage,
+                            event.IsHit() ? "hit" : "miss");
+            });
             ImGui::EndChild();
         }
 
@@ -1646,7 +1668,7 @@ void EditorScene::RenderBattleDebugTab() {
                 if (sharedContext_->setupAPI && sharedContext_->ecsAPI &&
                     sharedContext_->gameplayDataAPI) {
                     const auto& charId = characterIds_[spawnCharacterIndex_];
-                    auto character = sharedContext_->gameplayDataAPI->GetCharacterTemplate(charId);
+                    const auto* character = sharedContext_->gameplayDataAPI->GetCharacterMaster(charId);
                     if (character) {
                         entities::EntityCreationData creationData;
                         creationData.character_id = character->id;
@@ -8,11 +8,24 @@
 #include "../ui/OverlayColors.hpp"
 #include "../config/RenderPrimitives.hpp"
 #include <algorithm>
+#include <filesystem>
 
 namespace game {
 namespace core {
 namespace states {
 
+namespace {
+constexpr const char* kTexturePreloadSet = "GameScene";
+constexpr const char* kHitSoundName = "battle_hit";
+
+/// @brief 命中音のファイルが置かれているか（任意アセットなので無ければ鳴らさない）
+bool HasHitSoundAsset() {
+    std::error_code ec;
+    return std::filesystem::exists("data/assets/sounds/battle_hit.wav", ec) ||
+           std::filesystem::exists("data/assets/sounds/battle_hit.ogg", ec);
+}
+} // namespace
+
 GameScene::GameScene()
     : systemAPI_(nullptr), sharedContext_(nullptr), inputAPI_(nullptr),
       battleProgressAPI_(nullptr), requestTransition_(false),
@@ -32,10 +45,27 @@ bool GameScene::Initialize(BaseSystemAPI* systemAPI) {
     systemAPI_ = systemAPI;
     LOG_INFO("GameScene initialization started");
 
+    // このステージの背景だけを先読みし、シーン中は VRAM 予算による追い出しから外す
+    if (sharedContext_ && !sharedContext_->currentStageId.empty()) {
+        systemAPI_->Resource().PreloadTextureSet(
+            kTexturePreloadSet, {GetStageBackgroundPath(sharedContext_->currentStageId)});
+    }
+
     // HUD�E�上部�E�下部バ�E�E�E
     battleHud_ = std::make_unique<::game::core::ui::BattleHUDRenderer>(systemAPI_);
+    if (sharedContext_) {
+        // 戦闘中は編成が変わらないため、枠ごとのテンプレート添字はここで一度だけ解決する
+        battleHud_->SetFormation(sharedContext_->formationData, sharedContext_->gameplayDataAPI);
+    }
     battleRenderer_ = std::make_unique<::game::core::game::BattleRenderer>(
         systemAPI_, sharedContext_ ? sharedContext_->ecsAPI : nullptr);
+    hitParticles_ = std::make_unique<::game::core::game::ParticlePool>();
+    hitParticles_->SetForces(900.0f, 1.5f);
+    hitEffects_.Reset();
+    // 命中音は毎回の文字列解決を避けるため、ここでハンドルに解決しておく
+    hitSound_ = HasHitSoundAsset()
+        ? systemAPI_->Audio().ResolveSound(kHitSoundName, SoundCategory::Battle)
+        : INVALID_SOUND_HANDLE;
 
     LOG_INFO("GameScene initialized successfully");
     return true;
@@ -49,15 +79,19 @@ void GameScene::Update(float deltaTime) {
     // ポ�Eズ中�E�また�Eオーバ�Eレイ表示中�E��EゲームロジチE��を更新しなぁE
     if (!pausedNow) {
         const float gameSpeed = battleProgressAPI_ ? battleProgressAPI_->GetGameSpeed() : 1.0f;
+        // 速度倍率やフレーム落ちに関わらず戦闘は固定ティックで進め、アニメーションも進んだ分だけ送る
+        float simulatedTime = deltaTime * gameSpeed;
         if (battleProgressAPI_) {
-            battleProgressAPI_->Update(deltaTime * gameSpeed);
+            const int ticks = battleProgressAPI_->AdvanceFixed(deltaTime * gameSpeed);
+            simulatedTime = static_cast<float>(ticks) * battleProgressAPI_->GetFixedStep();
         }
         if (battleRenderer_ && sharedContext_ && sharedContext_->ecsAPI) {
-            battleRenderer_->UpdateAnimations(sharedContext_->ecsAPI, deltaTime * gameSpeed);
+            battleRenderer_->UpdateAnimations(sharedContext_->ecsAPI, simulatedTime);
         }
         
-        // ダメージホップアップ更新
-        UpdateDamagePopups(deltaTime * gameSpeed);
+        // ダメージポップアップと命中エフェクトも、実際に消化したティック分だけ進める
+        UpdateDamagePopups(simulatedTime);
+        UpdateHitEffects(simulatedTime);
     }
 
     // 入力�E琁E��常に更新�E�E
@@ -98,6 +132,10 @@ void GameScene::Shutdown() {
 
     battleHud_.reset();
     battleRenderer_.reset();
+    hitParticles_.reset();
+    if (systemAPI_) {
+        systemAPI_->Resource().ReleaseTextureSet(kTexturePreloadSet);
+    }
     if (sharedContext_ && sharedContext_->ecsAPI) {
         sharedContext_->ecsAPI->ResetForScene();
     }
@@ -288,7 +326,13 @@ void GameScene::RenderBattle() {
 
     // ユニット描画
     if (battleRenderer_ && sharedContext_ && sharedContext_->ecsAPI) {
-        battleRenderer_->RenderEntities(sharedContext_->ecsAPI);
+        const float alpha = battleProgressAPI_ ? battleProgressAPI_->GetInterpolationAlpha() : 1.0f;
+        battleRenderer_->RenderEntities(sharedContext_->ecsAPI, alpha);
+    }
+
+    // 命中/撃破エフェクト（全粒子を1回で描画）
+    if (hitParticles_) {
+        hitParticles_->Draw(systemAPI_->Render());
     }
 
     // ダメージホップアップ描画
@@ -432,59 +476,24 @@ void GameScene::UpdateDamagePopups(float deltaTime) {
         return;
     }
 
-    // 新しい攻撃ログエントリを検出
-    const auto& attackLog = battleProgressAPI_->GetAttackLog();
-    const size_t currentLogSize = attackLog.size();
-    
-    if (currentLogSize > lastAttackLogSize_) {
-        // 新しいエントリを追加
-        for (size_t i = lastAttackLogSize_; i < currentLogSize; ++i) {
-            const auto& entry = attackLog[i];
-            if (!entry.hit || entry.damage <= 0) {
-                continue;
+    // 前回のカーソル以降に発生した命中だけを取り出す（位置はイベントに記録済み）
+    battleProgressAPI_->GetCombatEvents().ReadSince(
+        combatEventCursor_, [this](const ::game::core::game::CombatEvent& event) {
+            if (event.kind != ::game::core::game::CombatEvent::Kind::UnitHit || event.damage <= 0) {
+                return;
             }
-
-            // エンティティの位置を取得（targetIdで検索）
-            Vec2 entityPos = {0.0f, 0.0f};
-            bool found = false;
-            
-            // CharacterIdコンポーネントで検索
-            auto view = sharedContext_->ecsAPI->View<ecs::components::Position, ecs::components::CharacterId>();
-            for (auto e : view) {
-                const auto& charId = view.get<ecs::components::CharacterId>(e);
-                if (charId.id == entry.targetId) {
-                    const auto& pos = view.get<ecs::components::Position>(e);
-                    entityPos = {pos.x, pos.y};
-                    found = true;
-                    break;
-                }
+            DamagePopup popup;
+            popup.position = {event.x, event.y};
+            popup.damage = event.damage;
+            popup.lifetime = 1.0f;  // 1秒表示
+            popup.maxLifetime = 1.0f;
+            popup.color = ToCoreColor(ui::OverlayColors::DANGER_RED);
+            damagePopups_.push_back(popup);
+            // 同じフレームの命中はボイスプール側で1回にまとめられる
+            if (hitSound_ != INVALID_SOUND_HANDLE) {
+                systemAPI_->Audio().PlaySound(hitSound_);
             }
-
-            if (!found) {
-                // Positionコンポーネントのみで検索（最後のエンティティを使用）
-                auto posView = sharedContext_->ecsAPI->View<ecs::components::Position>();
-                if (!posView.empty()) {
-                    // 簡易的に最後のエンティティの位置を使用
-                    auto it = posView.rbegin();
-                    const auto& pos = posView.get<ecs::components::Position>(*it);
-                    entityPos = {pos.x, pos.y};
-                    found = true;
-                }
-            }
-
-            if (found) {
-                DamagePopup popup;
-                popup.position = entityPos;
-                popup.damage = entry.damage;
-                popup.lifetime = 1.0f;  // 1秒表示
-                popup.maxLifetime = 1.0f;
-                popup.color = ToCoreColor(ui::OverlayColors::DANGER_RED);
-                damagePopups_.push_back(popup);
-            }
-        }
-    }
-
-    lastAttackLogSize_ = currentLogSize;
+        });
 
     // ポップアップの更新（上方向に移動、フェードアウト）
     for (auto& popup : damagePopups_) {
@@ -505,6 +514,15 @@ void GameScene::UpdateDamagePopups(float deltaTime) {
     }
 }
 
+void GameScene::UpdateHitEffects(float deltaTime) {
+    if (!battleProgressAPI_ || !hitParticles_) {
+        return;
+    }
+    hitEffects_.Consume(*battleProgressAPI_,
+                        sharedContext_ ? sharedContext_->ecsAPI : nullptr, *hitParticles_);
+    hitParticles_->Update(deltaTime);
+}
+
 void GameScene::RenderDamagePopups() {
     for (const auto& popup : damagePopups_) {
         // アルファ値を計算
@@ -5,6 +5,8 @@
 #include "../config/SharedContext.hpp"
 #include "../config/GameState.hpp"
 #include "../game/BattleRenderer.hpp"
+#include "../game/HitEffectEmitter.hpp"
+#include "../game/ParticlePool.hpp"
 #include "../api/BattleProgressAPI.hpp"
 #include "../ui/BattleHUDRenderer.hpp"
 #include <memory>
@@ -92,7 +94,12 @@ private:
         ColorRGBA color;    // 色（デフォルト：赤）
     };
     std::vector<DamagePopup> damagePopups_;
-    size_t lastAttackLogSize_ = 0;  // 前回フレームの攻撃ログサイズ
+    uint64_t combatEventCursor_ = 0;  // 次に読む戦闘イベントの sequence
+
+    // ========== 命中/撃破エフェクト ==========
+    std::unique_ptr<::game::core::game::ParticlePool> hitParticles_;
+    ::game::core::game::HitEffectEmitter hitEffects_;
+    SoundHandle hitSound_ = INVALID_SOUND_HANDLE;
 
     // ========== 冁E��処琁E==========
 
@@ -119,6 +126,9 @@ private:
     
     /// @brief ダメージホップアップを描画
     void RenderDamagePopups();
+
+    /// @brief 戦闘イベントから命中/撃破エフェクトを発生させ、粒子を更新
+    void UpdateHitEffects(float deltaTime);
 };
 
 } // namespace states
@@ -154,6 +154,14 @@ void HomeScreen::RenderHUD() {
         header_->Render(systemAPI_);
     }
 
+    // セーブはバックグラウンドで書くため、失敗はここで知らせる
+    if (sharedContext_ && sharedContext_->gameplayDataAPI &&
+        sharedContext_->gameplayDataAPI->HasSaveError()) {
+        systemAPI_->Render().DrawTextDefault("セーブに失敗しました（ディスクの空き容量や権限を確認してください）",
+                                             20.0f, 96.0f, 20.0f,
+                                             ui::OverlayColors::TEXT_ERROR);
+    }
+
     // タブバー描画 (y: 990-1080)
     if (tabbar_) {
         tabbar_->Render(systemAPI_);
@@ -67,6 +67,8 @@ bool InitScene::Initialize(BaseSystemAPI *systemAPI) {
 
     // デフォルトフォントを設定
     systemAPI_->Resource().SetDefaultFont("NotoSansJP-Medium.ttf", 32);
+    // データ中の文字列に出るグリフだけ先に用意（残りは描画時に追加）
+    systemAPI_->Resource().PrewarmFontGlyphs("NotoSansJP-Medium.ttf", "data");
     LOG_INFO("Default font set successfully");
 
     // ディレクトリスキャンを実行
@@ -118,7 +120,7 @@ void InitScene::Update(float deltaTime) {
     LOG_INFO("Starting resource loading");
   }
 
-  // 読み込み処理（毎フレーム1つずつ）
+  // 読み込み処理（フレーム予算内でまとめて進める）
   if (initState_.scanningCompleted && initState_.initializationStarted) {
     if (systemAPI_->Resource().HasMoreResources()) {
       updateCurrentDisplay(systemAPI_->Resource().GetCurrentProgress());
@@ -140,43 +142,25 @@ void InitScene::Update(float deltaTime) {
     smoothProgress_ +=
         (targetProgress - smoothProgress_) * smoothSpeed * deltaTime;
 
+    // デコードはワーカーで先行しているため、ここでは完了済みのものをアップロードするだけ
     const float frameBudget = std::min(deltaTime, 1.0f / 60.0f);
-    const double startTime = GetTime();
-    bool loadedAny = false;
-    while (systemAPI_->Resource().HasMoreResources()) {
-      if (loadedAny) {
-        const double elapsed = GetTime() - startTime;
-        if (elapsed >= static_cast<double>(frameBudget)) {
-          break;
-        }
-      }
-
-      try {
-        bool hasMore = systemAPI_->Resource().LoadNextResource(
-            [this](const LoadProgress &progress) {
-              initState_.currentProgress = progress.current;
-              initState_.totalProgress = progress.total;
-              updateCategoryStats(progress);
-            });
-        loadedAny = true;
-
-        if (!hasMore) {
-          initState_.initializationCompleted = true;
-          initState_.currentMessage = "初期化完了";
-          initState_.currentPath = "";
-          LOG_INFO("Resource initialization completed successfully");
-          break;
-        }
-      } catch (const std::exception &e) {
-        loadedAny = true;
-        LOG_WARN("Error loading resource: {}", e.what());
-        if (!systemAPI_->Resource().HasMoreResources()) {
-          initState_.initializationCompleted = true;
-          initState_.currentMessage = "初期化完了";
-          initState_.currentPath = "";
-          break;
-        }
-      }
+    try {
+      systemAPI_->Resource().LoadReadyResources(
+          static_cast<double>(frameBudget),
+          [this](const LoadProgress &progress) {
+            initState_.currentProgress = progress.current;
+            initState_.totalProgress = progress.total;
+            updateCategoryStats(progress);
+          });
+    } catch (const std::exception &e) {
+      LOG_WARN("Error loading resource: {}", e.what());
+    }
+
+    if (!systemAPI_->Resource().HasMoreResources()) {
+      initState_.initializationCompleted = true;
+      initState_.currentMessage = "初期化完了";
+      initState_.currentPath = "";
+      LOG_INFO("Resource initialization completed successfully");
     }
   }
 }
@@ -6,6 +6,9 @@
 #include "../ui/OverlayColors.hpp"
 #include "../ui/UiAssetKeys.hpp"
 
+namespace {
+constexpr const char *kTexturePreloadSet = "TitleScreen";
+} // namespace
 
 namespace game {
 namespace core {
@@ -14,7 +17,7 @@ TitleScreen::TitleScreen()
     : systemAPI_(nullptr), inputAPI_(nullptr), sharedContext_(nullptr),
       sceneOverlayAPI_(nullptr), isInitialized_(false),
       hasTransitionRequest_(false), requestedNextState_(GameState::Title),
-      requestQuit_(false), background_texture_(nullptr),
+      requestQuit_(false), background_handle_(INVALID_TEXTURE_HANDLE),
       has_background_(false) {
   title_text_ = "tower of defense";
   version_text_ = "v1.0";
@@ -178,7 +181,10 @@ void TitleScreen::Shutdown() {
     return;
   }
 
-  background_texture_ = nullptr;
+  if (systemAPI_) {
+    systemAPI_->Resource().ReleaseTextureSet(kTexturePreloadSet);
+  }
+  background_handle_ = INVALID_TEXTURE_HANDLE;
   has_background_ = false;
 
   isInitialized_ = false;
@@ -209,14 +215,18 @@ bool TitleScreen::RequestQuit() {
 // ========== 描画ヘルパ�E ==========
 
 void TitleScreen::RenderBackground() {
-  if (has_background_ && background_texture_ && background_texture_->id != 0) {
+  Texture2D *background =
+      has_background_
+          ? systemAPI_->Resource().GetTextureByHandle(background_handle_)
+          : nullptr;
+  if (background && background->id != 0) {
     // 画像背景描画
-    Rect source = {0.0f, 0.0f, static_cast<float>(background_texture_->width),
-                   static_cast<float>(background_texture_->height)};
+    Rect source = {0.0f, 0.0f, static_cast<float>(background->width),
+                   static_cast<float>(background->height)};
     Rect dest = {0.0f, 0.0f, 1920.0f, 1080.0f};
     Vec2 origin = {0.0f, 0.0f};
-    systemAPI_->Render().DrawTexturePro(*background_texture_, source, dest,
-                                        origin, 0.0f, ToCoreColor(WHITE));
+    systemAPI_->Render().DrawTexturePro(*background, source, dest, origin,
+                                        0.0f, ToCoreColor(WHITE));
   } else {
     // グラチE�Eション背景
     DrawGradientBackground();
@@ -354,14 +364,18 @@ bool TitleScreen::LoadBackgroundImage() {
 
   if (!systemAPI_) {
     LOG_ERROR("TitleScreen: systemAPI is null");
-    background_texture_ = nullptr;
+    background_handle_ = INVALID_TEXTURE_HANDLE;
     has_background_ = false;
     return false;
   }
 
   if (systemAPI_->Resource().TextureExists(bg_path)) {
-    background_texture_ = systemAPI_->Resource().GetTexturePtr(bg_path);
-    if (background_texture_ && background_texture_->id != 0) {
+    // タイトル表示中は VRAM 予算による追い出しから外す（Shutdown で解放）
+    systemAPI_->Resource().PreloadTextureSet(kTexturePreloadSet, {bg_path});
+    background_handle_ = systemAPI_->Resource().ResolveTextureHandle(bg_path);
+    const Texture2D *background =
+        systemAPI_->Resource().GetTextureByHandle(background_handle_);
+    if (background && background->id != 0) {
       has_background_ = true;
       LOG_INFO("Background image loaded: {}", bg_path);
       return true;
@@ -371,7 +385,8 @@ bool TitleScreen::LoadBackgroundImage() {
     LOG_WARN("Background image not found: {}", bg_path);
   }
 
-  background_texture_ = nullptr;
+  systemAPI_->Resource().ReleaseTextureSet(kTexturePreloadSet);
+  background_handle_ = INVALID_TEXTURE_HANDLE;
   has_background_ = false;
   return false;
 }
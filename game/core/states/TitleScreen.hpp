@@ -95,7 +95,7 @@ private:
     std::string version_text_;
     
     // リソース
-    Texture2D* background_texture_;
+    TextureHandle background_handle_;  // 描画のたびにハンドルから引く（追い出し後は再読み込みされる）
     bool has_background_;
     
     // 設定
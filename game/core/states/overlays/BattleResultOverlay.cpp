@@ -191,6 +191,14 @@ void BattleResultOverlay::Shutdown() {
     systemAPI_ = nullptr;
 }
 
+void BattleResultOverlay::OnShow() {
+    requestClose_ = false;
+    hasTransitionRequest_ = false;
+    requestedNextState_ = GameState::Home;
+    nextStageEnabled_ = false;
+    nextStageId_.clear();
+}
+
 OverlayState BattleResultOverlay::GetState() const {
     return isVictory_ ? OverlayState::BattleVictory : OverlayState::BattleDefeat;
 }
@@ -287,63 +287,46 @@ void CharacterEnhancementOverlay::SortCharacterList(SharedContext &ctx) {
     return;
   }
 
-  std::sort(
-      unit_info_panel_.entries.begin(), unit_info_panel_.entries.end(),
-      [this, &ctx](const entities::Character *a, const entities::Character *b) {
-        if (!a || !b)
-          return false;
-
+  // キーはセーブ変更時だけ作り直される表から引く（比較中は整数比較のみ）
+  using RosterEntry = RosterView::Entry;
+  ctx.gameplayDataAPI->GetRosterView().Sort(
+      unit_info_panel_.entries,
+      [this](const RosterEntry &a, const RosterEntry &b) {
         auto cmpInt = [this](int lhs, int rhs) {
           return sortAscending_ ? (lhs < rhs) : (lhs > rhs);
         };
-        auto cmpStr = [this](const std::string &lhs, const std::string &rhs) {
-          return sortAscending_ ? (lhs < rhs) : (rhs < lhs);
-        };
 
         switch (currentSortKey_) {
         case SortKey::Name:
-          if (a->name != b->name)
-            return cmpStr(a->name, b->name);
+          if (a.nameRank != b.nameRank)
+            return cmpInt(a.nameRank, b.nameRank);
           break;
         case SortKey::Rarity:
-          if (a->rarity != b->rarity)
-            return cmpInt(a->rarity, b->rarity);
+          if (a.rarity != b.rarity)
+            return cmpInt(a.rarity, b.rarity);
           break;
         case SortKey::Cost:
-          if (a->cost != b->cost)
-            return cmpInt(a->cost, b->cost);
+          if (a.cost != b.cost)
+            return cmpInt(a.cost, b.cost);
           break;
-        case SortKey::Level: {
-          int levelA = 1;
-          int levelB = 1;
-          if (ctx.gameplayDataAPI) {
-            levelA = ctx.gameplayDataAPI->GetCharacterState(a->id).level;
-            levelB = ctx.gameplayDataAPI->GetCharacterState(b->id).level;
-          }
-          if (levelA != levelB)
-            return cmpInt(levelA, levelB);
+        case SortKey::Level:
+          if (a.level != b.level)
+            return cmpInt(a.level, b.level);
           break;
-        }
-        case SortKey::Owned: {
-          bool ownedA = true;
-          bool ownedB = true;
-          if (ctx.gameplayDataAPI) {
-            ownedA = ctx.gameplayDataAPI->GetCharacterState(a->id).unlocked;
-            ownedB = ctx.gameplayDataAPI->GetCharacterState(b->id).unlocked;
-          }
-          if (ownedA != ownedB) {
+        case SortKey::Owned:
+          if (a.unlocked != b.unlocked) {
             // 所持している方を先に（降順の場合はtrue > false）
-            return sortAscending_ ? (!ownedA && ownedB) : (ownedA && !ownedB);
+            return sortAscending_ ? (!a.unlocked && b.unlocked)
+                                  : (a.unlocked && !b.unlocked);
           }
           break;
         }
-        }
         // タイブレーカー
-        if (a->rarity != b->rarity)
-          return a->rarity > b->rarity;
-        if (a->cost != b->cost)
-          return a->cost < b->cost;
-        return a->name < b->name;
+        if (a.rarity != b.rarity)
+          return a.rarity > b.rarity;
+        if (a.cost != b.cost)
+          return a.cost < b.cost;
+        return a.nameRank < b.nameRank;
       });
 }
 
@@ -355,7 +338,7 @@ void CharacterEnhancementOverlay::SelectCharacter(
 
   // ロックされたキャラは選択できない
   if (ctx.gameplayDataAPI) {
-    const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+    const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
     if (!st.unlocked) {
       LOG_WARN("CharacterEnhancementOverlay: Attempted to select locked "
                "character: {}",
@@ -727,14 +710,14 @@ void CharacterEnhancementOverlay::RenderUnitInfoPanel() {
     // 名前: Lv{level}:{name}
     int level = 1;
     if (sharedContext_ && sharedContext_->gameplayDataAPI) {
-      const auto st =
+      const auto &st =
           sharedContext_->gameplayDataAPI->GetCharacterState(entry->id);
       level = std::max(1, st.level);
     }
     // ロック状態を取得
     bool is_locked = false;
     if (sharedContext_ && sharedContext_->gameplayDataAPI) {
-      const auto st =
+      const auto &st =
           sharedContext_->gameplayDataAPI->GetCharacterState(entry->id);
       is_locked = !st.unlocked;
     }
@@ -864,7 +847,7 @@ void CharacterEnhancementOverlay::RenderStatusPanel(SharedContext &ctx) {
   const auto *character = GetSelectedCharacter();
   bool is_locked = false;
   if (character && ctx.gameplayDataAPI) {
-    const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+    const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
     is_locked = !st.unlocked;
   }
 
@@ -2625,7 +2608,7 @@ void CharacterEnhancementOverlay::OnItemSlotClick(int slot_id) {
   // ロックされたキャラは編集できない
   const auto *character = GetSelectedCharacter();
   if (character && sharedContext_ && sharedContext_->gameplayDataAPI) {
-    const auto st =
+    const auto &st =
         sharedContext_->gameplayDataAPI->GetCharacterState(character->id);
     if (!st.unlocked) {
       return; // ロックされている場合は操作を無効化
@@ -2715,7 +2698,7 @@ void CharacterEnhancementOverlay::OnLevelUpClick(SharedContext &ctx) {
     return;
   }
   // ロックされたキャラは編集できない
-  const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+  const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
   if (!st.unlocked) {
     return; // ロックされている場合は操作を無効化
   }
@@ -2762,7 +2745,7 @@ void CharacterEnhancementOverlay::OnLevelUpBatchClick(SharedContext &ctx,
     return;
   }
   // ロックされたキャラは編集できない
-  const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+  const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
   if (!st.unlocked) {
     return; // ロックされている場合は操作を無効化
   }
@@ -2817,7 +2800,7 @@ void CharacterEnhancementOverlay::OnLevelDownClick(SharedContext &ctx) {
     return;
   }
   // ロックされたキャラは編集できない
-  const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+  const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
   if (!st.unlocked) {
     return; // ロックされている場合は操作を無効化
   }
@@ -2856,7 +2839,7 @@ void CharacterEnhancementOverlay::OnLevelDownBatchClick(SharedContext &ctx,
     return;
   }
   // ロックされたキャラは編集できない
-  const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+  const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
   if (!st.unlocked) {
     return; // ロックされている場合は操作を無効化
   }
@@ -7,9 +7,11 @@
 #include "../../ecs/entities/CharacterStatCalculator.hpp"
 #include "../../ui/OverlayColors.hpp"
 #include <algorithm>
+#include <array>
 #include <iomanip>
-#include <regex>
+#include <limits>
 #include <sstream>
+#include <utility>
 
 namespace game {
 namespace core {
@@ -25,21 +27,86 @@ constexpr float kTabBarHeight = 40.0f;
 constexpr float kTabBarGap = 4.0f;
 constexpr float kTabButtonWidth = 110.0f;
 constexpr float kTabButtonGap = 10.0f;
+constexpr int kNoIdNumber = 9999;
+
+/// @brief 名前の照合キー（カタカナはひらがな、全角英数は半角、英大文字は小文字に寄せたコードポイント列）
+std::u32string MakeCollationKey(const std::string &text) {
+  std::u32string key;
+  key.reserve(text.size());
+  size_t i = 0;
+  while (i < text.size()) {
+    const unsigned char lead = static_cast<unsigned char>(text[i]);
+    size_t length = 1;
+    char32_t cp = lead;
+    if ((lead & 0xE0) == 0xC0) {
+      length = 2;
+      cp = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+      length = 3;
+      cp = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+      length = 4;
+      cp = lead & 0x07;
+    }
+    if (length > 1 && i + length <= text.size()) {
+      for (size_t k = 1; k < length; ++k) {
+        cp = (cp << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+      }
+    } else {
+      // 不正なシーケンスは1バイトずつ扱う
+      length = 1;
+      cp = lead;
+    }
+    i += length;
 
-// UTF-8の次のコード�Eイント墁E��へ進める�E�不正な場合�E1バイト進める�E�E
-size_t Utf8Next(const std::string &s, size_t i) {
-  if (i >= s.size())
-    return s.size();
-  const unsigned char c = static_cast<unsigned char>(s[i]);
-  if (c < 0x80)
-    return i + 1;
-  if ((c & 0xE0) == 0xC0)
-    return std::min(s.size(), i + 2);
-  if ((c & 0xF0) == 0xE0)
-    return std::min(s.size(), i + 3);
-  if ((c & 0xF8) == 0xF0)
-    return std::min(s.size(), i + 4);
-  return i + 1;
+    if (cp >= 0xFF01 && cp <= 0xFF5E) {
+      cp -= 0xFEE0;
+    }
+    if (cp >= U'A' && cp <= U'Z') {
+      cp += 0x20;
+    }
+    if (cp >= 0x30A1 && cp <= 0x30F6) {
+      cp -= 0x60;
+    }
+    key.push_back(cp);
+  }
+  return key;
+}
+
+/// @brief bits 幅に丸めた値（降順なら反転）をパック済みキーの1フィールドにする
+uint64_t PackField(int64_t value, int bits, bool ascending) {
+  const uint64_t mask = (uint64_t{1} << bits) - 1;
+  const uint64_t clamped =
+      (value < 0) ? 0 : std::min(static_cast<uint64_t>(value), mask);
+  return ascending ? clamped : (mask - clamped);
+}
+
+/// @brief (キー, 元の添字) をキーの昇順に並べる LSD 基数ソート（安定。全要素で同じ桁は飛ばす）
+void RadixSortKeys(std::vector<std::pair<uint64_t, uint32_t>> &items) {
+  if (items.size() < 2) {
+    return;
+  }
+  uint64_t differing = 0;
+  for (const auto &item : items) {
+    differing |= item.first ^ items.front().first;
+  }
+  std::vector<std::pair<uint64_t, uint32_t>> scratch(items.size());
+  for (int shift = 0; shift < 64; shift += 8) {
+    if (((differing >> shift) & 0xFF) == 0) {
+      continue;
+    }
+    std::array<size_t, 257> offsets{};
+    for (const auto &item : items) {
+      ++offsets[((item.first >> shift) & 0xFF) + 1];
+    }
+    for (size_t b = 1; b < offsets.size(); ++b) {
+      offsets[b] += offsets[b - 1];
+    }
+    for (const auto &item : items) {
+      scratch[offsets[(item.first >> shift) & 0xFF]++] = item;
+    }
+    items.swap(scratch);
+  }
 }
 
 } // namespace
@@ -734,6 +801,10 @@ void CodexOverlay::Render(SharedContext &ctx) {
     return;
   }
 
+  // 全面を不透明に塗る（GetCoverage が OpaqueFullScreen のため背面は描画されない）
+  systemAPI_->Render().DrawRectangle(0, 0, 1920, 1080,
+                                     ui::OverlayColors::MAIN_BG);
+
   LayoutPanels();
   EnsureEntriesLoaded(ctx);
 
@@ -954,29 +1025,26 @@ void CodexOverlay::RenderListPanel() {
         if (iconPath.empty()) {
           return;
         }
-        void *texturePtr = systemAPI_->Resource().GetTexture(iconPath);
-        if (!texturePtr) {
-          return;
-        }
-        Texture2D *texture = static_cast<Texture2D *>(texturePtr);
-        if (!texture || texture->id == 0) {
+        // アトラス収録済みのアイコンは部分矩形、それ以外は単体テクスチャ全体が返る
+        const TextureRegion region =
+            systemAPI_->Resource().GetTextureRegion(iconPath);
+        if (!region.texture || region.texture->id == 0 ||
+            region.rect.width <= 0.0f || region.rect.height <= 0.0f) {
           return;
         }
-        Rectangle src{0.0f, 0.0f, static_cast<float>(texture->width),
-                      static_cast<float>(texture->height)};
+        const Rectangle src = region.rect;
         const float pad = 6.0f;
         const float maxW =
             std::max(0.0f, list_panel_.card_width - pad * 2.0f);
         const float maxH =
             std::max(0.0f, list_panel_.card_height - pad * 2.0f - 20.0f);
         const float scale =
-            std::min(maxW / static_cast<float>(texture->width),
-                     maxH / static_cast<float>(texture->height));
-        const float drawW = static_cast<float>(texture->width) * scale;
-        const float drawH = static_cast<float>(texture->height) * scale;
+            std::min(maxW / src.width, maxH / src.height);
+        const float drawW = src.width * scale;
+        const float drawH = src.height * scale;
         Rectangle dst{cardX + (list_panel_.card_width - drawW) * 0.5f,
                       cardY + pad, drawW, drawH};
-        systemAPI_->Render().DrawTexturePro(*texture, src, dst,
+        systemAPI_->Render().DrawTexturePro(*region.texture, src, dst,
                                             {0.0f, 0.0f}, 0.0f, WHITE);
       };
 
@@ -1156,24 +1224,27 @@ void CodexOverlay::RenderCharacterViewport() {
 
         if (sprite_info && !sprite_info->sheet_path.empty() &&
             sprite_info->frame_count > 0) {
-          void *texturePtr =
-              systemAPI_->Resource().GetTexture(sprite_info->sheet_path);
-          if (texturePtr) {
-            Texture2D *texture = static_cast<Texture2D *>(texturePtr);
+          // シートはアトラス上の部分矩形として返る（単体テクスチャを別に読まない）
+          const TextureRegion region =
+              systemAPI_->Resource().GetTextureRegion(sprite_info->sheet_path);
+          if (region.texture) {
+            Texture2D *texture = region.texture;
+            const int sheetW = static_cast<int>(region.rect.width);
+            const int sheetH = static_cast<int>(region.rect.height);
 
             // 現在のフレームのソース矩形（グリッド対応: 正方形シート等）
             const int cols = (sprite_info->frame_width > 0)
-                ? (texture->width / sprite_info->frame_width) : 1;
+                ? (sheetW / sprite_info->frame_width) : 1;
             const int rows = (cols > 0 && sprite_info->frame_height > 0)
-                ? (texture->height / sprite_info->frame_height) : 1;
+                ? (sheetH / sprite_info->frame_height) : 1;
             const int total = cols * rows;
             const int safeFrame = (total > 0)
                 ? (character_viewport_.animation_frame % total) : 0;
             const int row = (cols > 0) ? (safeFrame / cols) : 0;
             const int col = (cols > 0) ? (safeFrame % cols) : safeFrame;
             Rectangle sourceRect = {
-                static_cast<float>(col * sprite_info->frame_width),
-                static_cast<float>(row * sprite_info->frame_height),
+                region.rect.x + static_cast<float>(col * sprite_info->frame_width),
+                region.rect.y + static_cast<float>(row * sprite_info->frame_height),
                 static_cast<float>(sprite_info->frame_width),
                 static_cast<float>(sprite_info->frame_height)};
 
@@ -1834,54 +1905,15 @@ void CodexOverlay::RenderInfoPanel() {
     const float fontSize = static_cast<float>(info_panel_.font_size);
     const float maxWidth = info_panel_.width - info_panel_.padding * 2.0f;
 
-    // キャチE��ュキー�E�タチEID/説明長/幁E��E
-    const std::string key = std::to_string(static_cast<int>(activeTab_)) + ":" +
-                            entry->id + ":" +
-                            std::to_string(entry->description.size());
-    if (infoCachedKey_ != key ||
-        std::abs(infoCachedMaxWidth_ - maxWidth) > 0.5f) {
-      infoCachedKey_ = key;
-      infoCachedMaxWidth_ = maxWidth;
-      infoWrappedLines_.clear();
-
-      // 幁E�Eースで折り返し�E�ETF-8墁E��を維持E��E
-      std::string line;
-      line.reserve(64);
-      size_t i = 0;
-      while (i < entry->description.size()) {
-        // 改行�E強制折り返し
-        if (entry->description[i] == '\n') {
-          infoWrappedLines_.push_back(line);
-          line.clear();
-          ++i;
-          continue;
-        }
-        const size_t next = Utf8Next(entry->description, i);
-        const std::string cp = entry->description.substr(i, next - i);
-
-        std::string candidate = line;
-        candidate += cp;
-
-        const Vector2 sz =
-            systemAPI_->Render().MeasureTextDefault(candidate, fontSize);
-        if (sz.x > maxWidth && !line.empty()) {
-          infoWrappedLines_.push_back(line);
-          line = cp;
-        } else {
-          line = std::move(candidate);
-        }
-        i = next;
-      }
-      if (!line.empty()) {
-        infoWrappedLines_.push_back(line);
-      }
-    }
+    // 折り返しは描画APIのレイアウトキャッシュに任せる（文字単位・幅ベース）
+    const TextLayout &layout = systemAPI_->Render().LayoutTextDefault(
+        entry->description, fontSize, 1.0f, maxWidth);
 
     // スクロール�E�クランプ！E
     const float availableH =
         info_panel_.height - info_panel_.padding * 2.0f - kPanelHeaderH;
     const float totalH =
-        static_cast<float>(infoWrappedLines_.size()) * info_panel_.line_height;
+        static_cast<float>(layout.lines.size()) * info_panel_.line_height;
     const float maxScroll = std::max(0.0f, totalH - availableH);
     if (infoScrollPx_ < 0.0f)
       infoScrollPx_ = 0.0f;
@@ -1892,7 +1924,7 @@ void CodexOverlay::RenderInfoPanel() {
                      static_cast<int>(maxWidth), static_cast<int>(availableH));
 
     float currentY = y - infoScrollPx_;
-    for (const auto &ln : infoWrappedLines_) {
+    for (size_t li = 0; li < layout.lines.size(); ++li) {
       if (currentY + info_panel_.line_height < y) {
         currentY += info_panel_.line_height;
         continue;
@@ -1900,8 +1932,8 @@ void CodexOverlay::RenderInfoPanel() {
       if (currentY > y + availableH) {
         break;
       }
-      systemAPI_->Render().DrawTextDefault(ln, x, currentY, fontSize,
-                                           ui::OverlayColors::TEXT_PRIMARY);
+      systemAPI_->Render().DrawTextLayoutLineDefault(
+          layout, li, Vector2{x, currentY}, ui::OverlayColors::TEXT_PRIMARY);
       currentY += info_panel_.line_height;
     }
     EndScissorMode();
@@ -1943,7 +1975,6 @@ void CodexOverlay::SwitchTab(CodexTab tab) {
   character_viewport_.error_message.clear();
 
   infoScrollPx_ = 0.0f;
-  infoCachedKey_.clear();
 
   dropdownKind_ = DropdownKind::None;
   dropdownSlotIndex_ = -1;
@@ -1968,7 +1999,6 @@ void CodexOverlay::OnListItemClick(int index) {
   LOG_INFO("CodexOverlay: Selected entry: {} ({})", e.name, e.id);
 
   infoScrollPx_ = 0.0f;
-  infoCachedKey_.clear();
 
   dropdownKind_ = DropdownKind::None;
   dropdownSlotIndex_ = -1;
@@ -2050,32 +2080,53 @@ const entities::PassiveSkill *CodexOverlay::GetSelectedPassive() const {
 }
 
 int CodexOverlay::ExtractIdNumber(const std::string &id) {
-  // IDから数値部刁E��抽出�E�侁E "cat_001" -> 1, "dog_001" -> 1�E�E
-  std::regex pattern(R"(_(\d+)$)");
-  std::smatch match;
-  if (std::regex_search(id, match, pattern)) {
-    try {
-      return std::stoi(match[1].str());
-    } catch (...) {
-      return 9999; // パ�Eス失敗時は最後に
+  // IDから末尾の数値部分を抽出（例: "cat_001" -> 1）。"_数字" で終わらなければ最後に回す
+  size_t begin = id.size();
+  while (begin > 0 && id[begin - 1] >= '0' && id[begin - 1] <= '9') {
+    --begin;
+  }
+  if (begin == id.size() || begin == 0 || id[begin - 1] != '_') {
+    return kNoIdNumber;
+  }
+  int value = 0;
+  for (size_t i = begin; i < id.size(); ++i) {
+    const int digit = id[i] - '0';
+    if (value > (std::numeric_limits<int>::max() - digit) / 10) {
+      return kNoIdNumber; // int に収まらない
     }
+    value = value * 10 + digit;
+  }
+  return value;
+}
+
+void CodexOverlay::AssignNameRanks(std::vector<CodexEntry> &entries) {
+  std::vector<std::pair<std::u32string, size_t>> keys;
+  keys.reserve(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    keys.emplace_back(MakeCollationKey(entries[i].name), i);
+  }
+  std::sort(keys.begin(), keys.end());
+  uint32_t rank = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i > 0 && keys[i - 1].first != keys[i].first) {
+      ++rank;
+    }
+    entries[keys[i].second].name_rank = rank;
   }
-  return 9999;
 }
 
 void CodexOverlay::SortCharactersById(std::vector<CodexEntry> &entries) {
   std::sort(entries.begin(), entries.end(),
             [](const CodexEntry &a, const CodexEntry &b) {
-              const int num_a = ExtractIdNumber(a.id);
-              const int num_b = ExtractIdNumber(b.id);
-              if (num_a != num_b) {
-                return num_a < num_b;
+              if (a.id_number != b.id_number) {
+                return a.id_number < b.id_number;
               }
               return a.id < b.id;
             });
 }
 
 void CodexOverlay::SortEntries(int tabIndex, SharedContext& ctx) {
+  (void)ctx;
   if (tabIndex < 0 || tabIndex >= 3) {
     return;
   }
@@ -2087,63 +2138,43 @@ void CodexOverlay::SortEntries(int tabIndex, SharedContext& ctx) {
   
   const bool ascending = sortAscending_[tabIndex];
   const SortKey sortKey = currentSortKey_[tabIndex];
-  
-  std::sort(entries.begin(), entries.end(),
-            [this, tabIndex, ascending, sortKey, &ctx](const CodexEntry &a, const CodexEntry &b) {
-              auto cmpInt = [ascending](int lhs, int rhs) {
-                return ascending ? (lhs < rhs) : (lhs > rhs);
-              };
-              auto cmpStr = [ascending](const std::string& lhs, const std::string& rhs) {
-                return ascending ? (lhs < rhs) : (rhs < lhs);
-              };
-              
-              // キャラクタータブ
-              if (tabIndex == TabIndex(CodexTab::Characters) && a.character && b.character) {
-                switch (sortKey) {
-                  case SortKey::Name:
-                    if (a.name != b.name) return cmpStr(a.name, b.name);
-                    break;
-                  case SortKey::Rarity:
-                    if (a.character->rarity != b.character->rarity) 
-                      return cmpInt(a.character->rarity, b.character->rarity);
-                    break;
-                  case SortKey::Cost:
-                    if (a.character->cost != b.character->cost) 
-                      return cmpInt(a.character->cost, b.character->cost);
-                    break;
-                  case SortKey::Level: {
-                    int levelA = 1;
-                    int levelB = 1;
-                    if (ctx.gameplayDataAPI) {
-                      levelA = ctx.gameplayDataAPI->GetCharacterState(a.id).level;
-                      levelB = ctx.gameplayDataAPI->GetCharacterState(b.id).level;
-                    }
-                    if (levelA != levelB) return cmpInt(levelA, levelB);
-                    break;
-                  }
-                  case SortKey::Owned: {
-                    bool ownedA = a.is_discovered;
-                    bool ownedB = b.is_discovered;
-                    if (ownedA != ownedB) {
-                      return ascending ? (!ownedA && ownedB) : (ownedA && !ownedB);
-                    }
-                    break;
-                  }
-                }
-                // タイブレーカー
-                if (a.character->rarity != b.character->rarity) 
-                  return a.character->rarity > b.character->rarity;
-                if (a.character->cost != b.character->cost) 
-                  return a.character->cost < b.character->cost;
-                return a.name < b.name;
-              }
-              // Equipment/Passivesタブ（名前でソート）
-              else {
-                return cmpStr(a.name, b.name);
-              }
-              
-              return a.id < b.id;
-            });
+
+  // 比較はエントリ構築時に計算済みのキーを 64bit に詰めて行う（同値は入力順 = ID 番号順を維持）
+  std::vector<std::pair<uint64_t, uint32_t>> keys;
+  keys.reserve(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const CodexEntry &e = entries[i];
+    uint64_t key = 0;
+    if (tabIndex == TabIndex(CodexTab::Characters) && e.character) {
+      int64_t primary = 0;
+      switch (sortKey) {
+        case SortKey::Name: primary = e.name_rank; break;
+        case SortKey::Rarity: primary = e.character->rarity; break;
+        case SortKey::Cost: primary = e.character->cost; break;
+        case SortKey::Level: primary = e.level; break;
+        case SortKey::Owned: primary = e.is_discovered ? 1 : 0; break;
+      }
+      // [主キー 24][レア降順 8][コスト昇順 16][名前順 16]（コストは 255 を超えるため 16bit）
+      key = (PackField(primary, 24, ascending) << 40) |
+            (PackField(e.character->rarity, 8, false) << 32) |
+            (PackField(e.character->cost, 16, true) << 16) |
+            PackField(e.name_rank, 16, true);
+    } else {
+      // Equipment/Passivesタブ（名前でソート）
+      key = (PackField(e.name_rank, 32, ascending) << 32) |
+            PackField(e.id_number, 32, true);
+    }
+    keys.emplace_back(key, static_cast<uint32_t>(i));
+  }
+
+  RadixSortKeys(keys);
+
+  std::vector<CodexEntry> sorted;
+  sorted.reserve(entries.size());
+  for (const auto &[key, index] : keys) {
+    sorted.push_back(std::move(entries[index]));
+  }
+  entries.swap(sorted);
 }
 
 void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
@@ -2156,6 +2187,7 @@ void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
   // キャラ
   if (ctx.gameplayDataAPI) {
     const auto &masters = ctx.gameplayDataAPI->GetAllCharacterMasters();
+    const RosterView &roster = ctx.gameplayDataAPI->GetRosterView();
     auto &out = tabEntries_[TabIndex(CodexTab::Characters)];
     out.reserve(masters.size());
     for (const auto &[id, ch] : masters) {
@@ -2164,13 +2196,22 @@ void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
       e.id = id;
       e.name = ch.name;
       e.description = ch.description;
-      e.is_discovered =
-          ctx.gameplayDataAPI
-              ? ctx.gameplayDataAPI->GetCharacterState(id).unlocked
-              : ch.default_unlocked;
+      e.id_number = ExtractIdNumber(id);
+      e.roster_index = roster.FindIndex(id);
+      if (e.roster_index != RosterView::INVALID_INDEX) {
+        const RosterView::Entry &state = roster.Get(e.roster_index);
+        e.is_discovered = state.unlocked;
+        e.level = state.level;
+      } else {
+        const auto &state = ctx.gameplayDataAPI->GetCharacterState(id);
+        e.is_discovered = state.unlocked;
+        e.level = state.level;
+      }
       e.character = &ch;
       out.push_back(std::move(e));
     }
+    SortCharactersById(out);
+    AssignNameRanks(out);
     SortEntries(TabIndex(CodexTab::Characters), ctx);
     if (!out.empty()) {
       tabSelectedIndex_[TabIndex(CodexTab::Characters)] = 0;
@@ -2193,9 +2234,11 @@ void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
         e.name = eq->name;
         e.description = eq->description;
         e.is_discovered = true;
+        e.id_number = ExtractIdNumber(e.id);
         e.equipment = eq;
         out.push_back(std::move(e));
       }
+      AssignNameRanks(out);
       SortEntries(TabIndex(CodexTab::Equipment), ctx);
       if (!out.empty())
         tabSelectedIndex_[TabIndex(CodexTab::Equipment)] = 0;
@@ -2215,9 +2258,11 @@ void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
         e.name = ps->name;
         e.description = ps->description;
         e.is_discovered = true;
+        e.id_number = ExtractIdNumber(e.id);
         e.passive = ps;
         out.push_back(std::move(e));
       }
+      AssignNameRanks(out);
       SortEntries(TabIndex(CodexTab::Passives), ctx);
       if (!out.empty())
         tabSelectedIndex_[TabIndex(CodexTab::Passives)] = 0;
@@ -2228,10 +2273,21 @@ void CodexOverlay::EnsureEntriesLoaded(SharedContext &ctx) {
 
 void CodexOverlay::RefreshCharacterUnlockedState(SharedContext& ctx) {
   if (!ctx.gameplayDataAPI) return;
+  // RosterView はセーブ変更時のみ作り直されるため、毎フレームの参照は添字アクセスだけで済む
+  const RosterView& roster = ctx.gameplayDataAPI->GetRosterView();
   auto& chars = tabEntries_[TabIndex(CodexTab::Characters)];
   for (auto& e : chars) {
     if (e.type != CodexEntry::Type::Character || e.id.empty()) continue;
-    e.is_discovered = ctx.gameplayDataAPI->GetCharacterState(e.id).unlocked;
+    if (e.roster_index != RosterView::INVALID_INDEX &&
+        static_cast<size_t>(e.roster_index) < roster.Size()) {
+      const RosterView::Entry& state = roster.Get(e.roster_index);
+      e.is_discovered = state.unlocked;
+      e.level = state.level;
+    } else {
+      const auto& state = ctx.gameplayDataAPI->GetCharacterState(e.id);
+      e.is_discovered = state.unlocked;
+      e.level = state.level;
+    }
   }
 }
 
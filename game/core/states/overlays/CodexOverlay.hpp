@@ -4,6 +4,7 @@
 #include "../../ecs/entities/Character.hpp"
 #include "../../ecs/entities/ItemPassiveManager.hpp"
 #include "../../system/PlayerDataManager.hpp"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <array>
@@ -41,6 +42,8 @@ public:
     void Shutdown() override;
 
     OverlayState GetState() const override { return OverlayState::Codex; }
+    /// @brief 画面全体を不透明に塗るため、背面のシーン/オーバーレイは描画されない
+    OverlayCoverage GetCoverage() const override { return OverlayCoverage::OpaqueFullScreen; }
     bool RequestClose() const override;
     bool RequestTransition(GameState& nextState) const override;
 
@@ -64,6 +67,12 @@ private:
         std::string description;
         bool is_discovered = true;
 
+        // ソート用キー（EnsureEntriesLoaded で一度だけ計算。level/is_discovered はセーブ変更時に追従）
+        int id_number = 9999;     // ID 末尾の数値（"cat_001" -> 1、無ければ末尾扱い）
+        uint32_t name_rank = 0;   // タブ内での名前の照合順位（同じ照合キーは同順位）
+        int roster_index = -1;    // RosterView の添字（キャラのみ）
+        int level = 1;
+
         // 参�E先（所有権なし！E
         const entities::Character* character = nullptr;
         const entities::Equipment* equipment = nullptr;
@@ -143,9 +152,6 @@ private:
 
     // 右説明パネル�E�折り返し/スクロールのキャチE��ュ�E�E
     float infoScrollPx_ = 0.0f;
-    float infoCachedMaxWidth_ = -1.0f;
-    std::string infoCachedKey_;
-    std::vector<std::string> infoWrappedLines_;
     
     // ソート関連（タブごと）
     enum class SortKey {
@@ -189,6 +195,7 @@ private:
     
     // ========== IDソート用 ==========
     static int ExtractIdNumber(const std::string& id);
+    static void AssignNameRanks(std::vector<CodexEntry>& entries);
     void SortCharactersById(std::vector<CodexEntry>& entries);
     void SortEntries(int tabIndex, SharedContext& ctx);
     void EnsureEntriesLoaded(SharedContext& ctx);
@@ -53,6 +53,17 @@ void CustomStageEnemyQueueOverlay::Shutdown() {
     targetStageId_.clear();
 }
 
+void CustomStageEnemyQueueOverlay::OnShow() {
+    requestClose_ = false;
+    hasTransitionRequest_ = false;
+}
+
+void CustomStageEnemyQueueOverlay::OnHide() {
+    // 次に開いたときは SetTargetStageId() で対象が決まるまで空にしておく
+    SetTargetStageId(std::string());
+    availableCharacters_.clear();
+}
+
 void CustomStageEnemyQueueOverlay::SetTargetStageId(const std::string& stageId) {
     targetStageId_ = stageId;
     queue_.clear();
@@ -188,9 +199,10 @@ void CustomStageEnemyQueueOverlay::LoadAvailableCharacters(SharedContext& ctx) {
     for (const auto& charId : allCharacterIds) {
         auto charState = ctx.gameplayDataAPI->GetCharacterState(charId);
         if (charState.unlocked) {
-            auto character = ctx.gameplayDataAPI->GetCharacterTemplate(charId);
+            // マスターを直接指す（コピーの shared_ptr は即座に破棄されるため保持できない）
+            const auto* character = ctx.gameplayDataAPI->GetCharacterMaster(charId);
             if (character) {
-                availableCharacters_.push_back(character.get());
+                availableCharacters_.push_back(character);
             }
         }
     }
@@ -556,7 +568,7 @@ void CustomStageEnemyQueueOverlay::RenderQueueList(SharedContext& ctx) {
         // キャラクター情報を取得
         std::string charName = entry.enemyId;
         if (ctx.gameplayDataAPI) {
-            auto character = ctx.gameplayDataAPI->GetCharacterTemplate(entry.enemyId);
+            const auto* character = ctx.gameplayDataAPI->GetCharacterMaster(entry.enemyId);
             if (character) {
                 charName = character->name.empty() ? character->id : character->name;
             }
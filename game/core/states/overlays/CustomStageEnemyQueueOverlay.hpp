@@ -22,6 +22,10 @@ public:
     void Update(SharedContext& ctx, float deltaTime) override;
     void Render(SharedContext& ctx) override;
     void Shutdown() override;
+    void OnShow() override;
+    void OnHide() override;
+    bool IsReusable() const override { return true; }
+    OverlayCoverage GetCoverage() const override { return OverlayCoverage::Translucent; }
 
     OverlayState GetState() const override { return OverlayState::CustomStageEnemyQueue; }
     bool RequestClose() const override;
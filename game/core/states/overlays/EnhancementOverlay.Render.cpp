@@ -155,7 +155,7 @@ void EnhancementOverlay::RenderOverviewTab(SharedContext& ctx) {
     auto st = ctx.gameplayDataAPI->GetTowerEnhancements();
     auto attachments = ctx.gameplayDataAPI->GetTowerAttachments();
     const auto& masters = ctx.gameplayDataAPI->GetAllTowerAttachmentMasters();
-    const auto mul = system::CalculateTowerEnhancementMultipliers(st, attachments, masters);
+    const auto& mul = ctx.gameplayDataAPI->GetTowerEnhancementMultipliers();
     auto& render = systemAPI_->Render();
 
     constexpr float PANEL_GAP = 10.0f;
@@ -312,9 +312,7 @@ void EnhancementOverlay::RenderBaseEnhancementTab(SharedContext& ctx) {
     }
 
     auto st = ctx.gameplayDataAPI->GetTowerEnhancements();
-    auto attachments = ctx.gameplayDataAPI->GetTowerAttachments();
-    const auto& masters = ctx.gameplayDataAPI->GetAllTowerAttachmentMasters();
-    const auto mul = system::CalculateTowerEnhancementMultipliers(st, attachments, masters);
+    const auto& mul = ctx.gameplayDataAPI->GetTowerEnhancementMultipliers();
 
     const Vec2 mouse = ctx.inputAPI ? ctx.inputAPI->GetMousePositionInternal() : Vec2{0.0f, 0.0f};
     auto inRect = [&](const Rect& r) {
@@ -8,6 +8,7 @@
 #include "../../ui/UIEffects.hpp"
 #include <algorithm>
 #include <cmath>
+#include <utility>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -83,6 +84,8 @@ void FormationOverlay::Update(SharedContext &ctx, float deltaTime) {
 
   // アニメーション時間更新
   animation_time_ += deltaTime;
+  ui::UIEffects::UpdateAmbientParticles(ambient_particles_, deltaTime, 100.0f,
+                                        90.0f, 1720.0f, 900.0f, 15);
 
   // キャラクター一覧の更新�E��E回�Eみ�E�E
   if (m_characterList.available_characters.empty() && ctx.gameplayDataAPI) {
@@ -122,12 +125,14 @@ void FormationOverlay::Render(SharedContext &ctx) {
 
   using namespace ui;
 
+  // 全面を不透明に塗る（GetCoverage が OpaqueFullScreen のため背面は描画されない）
+  systemAPI_->Render().DrawRectangle(0, 0, 1920, 1080, OverlayColors::MAIN_BG);
+
   // オーバ�Eレイ背景�E�グラチE�Eション�E�E
   UIEffects::DrawGradientPanel(systemAPI_, 100.0f, 90.0f, 1720.0f, 900.0f);
 
   // 背景粒子エフェクチE
-  UIEffects::DrawParticles(systemAPI_, animation_time_, 100.0f, 90.0f, 1720.0f,
-                           900.0f, 15);
+  UIEffects::DrawParticles(systemAPI_, ambient_particles_);
 
   // タイトルバ�E�E�最初に描画して確実に上に表示�E�E
 
@@ -159,11 +164,13 @@ void FormationOverlay::Shutdown() {
 
   // スロチE��クリア
   for (int i = 0; i < 10; ++i) {
-    squad_slots_[i].assigned_character = nullptr;
+    SetSlotCharacter(squad_slots_[i], nullptr);
   }
 
   m_characterList.available_characters.clear();
+  m_characterList.icon_handles.clear();
   dragging_character_ = nullptr;
+  ambient_particles_.Clear();
 
   isInitialized_ = false;
   systemAPI_ = nullptr;
@@ -192,7 +199,7 @@ bool FormationOverlay::RequestTransition(GameState &nextState) const {
 void FormationOverlay::InitializeSlots() {
   for (int i = 0; i < 10; ++i) {
     squad_slots_[i].slot_id = i;
-    squad_slots_[i].assigned_character = nullptr;
+    SetSlotCharacter(squad_slots_[i], nullptr);
     squad_slots_[i].position = GetSlotPosition(i);
     squad_slots_[i].is_hovered = false;
     squad_slots_[i].is_dragging = false;
@@ -202,7 +209,7 @@ void FormationOverlay::InitializeSlots() {
 void FormationOverlay::RestoreFormationFromContext(SharedContext& ctx) {
   // 一旦クリア
   for (int i = 0; i < 10; ++i) {
-    squad_slots_[i].assigned_character = nullptr;
+    SetSlotCharacter(squad_slots_[i], nullptr);
   }
 
   if (!ctx.gameplayDataAPI) {
@@ -223,7 +230,7 @@ void FormationOverlay::RestoreFormationFromContext(SharedContext& ctx) {
     auto it = masters.find(characterId);
     if (it == masters.end()) continue;
 
-    squad_slots_[slotId].assigned_character = &it->second;
+    SetSlotCharacter(squad_slots_[slotId], &it->second);
   }
 
   LOG_INFO("FormationOverlay: Restored formation from SharedContext: {} slots", ctx.formationData.slots.size());
@@ -262,59 +269,51 @@ void FormationOverlay::FilterAvailableCharacters(SharedContext &ctx) {
 }
 
 void FormationOverlay::SortAvailableCharacters(const GameplayDataAPI* gameplayDataAPI) {
-  std::sort(m_characterList.available_characters.begin(),
-            m_characterList.available_characters.end(),
-            [this, gameplayDataAPI](const entities::Character *a,
-                                    const entities::Character *b) {
-              if (!a || !b)
-                return false;
-
-              auto cmpInt = [this](int lhs, int rhs) {
-                return sortAscending_ ? (lhs < rhs) : (lhs > rhs);
-              };
-              auto cmpStr = [this](const std::string& lhs, const std::string& rhs) {
-                return sortAscending_ ? (lhs < rhs) : (rhs < lhs);
-              };
-
-              switch (currentSortKey_) {
-                case SortKey::Name:
-                  if (a->name != b->name) return cmpStr(a->name, b->name);
-                  break;
-                case SortKey::Rarity:
-                  if (a->rarity != b->rarity) return cmpInt(a->rarity, b->rarity);
-                  break;
-                case SortKey::Cost:
-                  if (a->cost != b->cost) return cmpInt(a->cost, b->cost);
-                  break;
-                case SortKey::Level: {
-                  int levelA = 1;
-                  int levelB = 1;
-                  if (gameplayDataAPI) {
-                    levelA = gameplayDataAPI->GetCharacterState(a->id).level;
-                    levelB = gameplayDataAPI->GetCharacterState(b->id).level;
-                  }
-                  if (levelA != levelB) return cmpInt(levelA, levelB);
-                  break;
-                }
-                case SortKey::Owned: {
-                  bool ownedA = true;
-                  bool ownedB = true;
-                  if (gameplayDataAPI) {
-                    ownedA = gameplayDataAPI->GetCharacterState(a->id).unlocked;
-                    ownedB = gameplayDataAPI->GetCharacterState(b->id).unlocked;
-                  }
-                  if (ownedA != ownedB) {
-                    // 所持している方を先に（降順の場合はtrue > false）
-                    return sortAscending_ ? (!ownedA && ownedB) : (ownedA && !ownedB);
-                  }
-                  break;
-                }
-              }
-              // タイブレーカー
-              if (a->rarity != b->rarity) return a->rarity > b->rarity;
-              if (a->cost != b->cost) return a->cost < b->cost;
-              return a->name < b->name;
-            });
+  if (!gameplayDataAPI) {
+    return;
+  }
+
+  // キーはセーブ変更時だけ作り直される表から引く（比較中は整数比較のみ）
+  using RosterEntry = RosterView::Entry;
+  gameplayDataAPI->GetRosterView().Sort(
+      m_characterList.available_characters,
+      [this](const RosterEntry &a, const RosterEntry &b) {
+        auto cmpInt = [this](int lhs, int rhs) {
+          return sortAscending_ ? (lhs < rhs) : (lhs > rhs);
+        };
+
+        switch (currentSortKey_) {
+          case SortKey::Name:
+            if (a.nameRank != b.nameRank) return cmpInt(a.nameRank, b.nameRank);
+            break;
+          case SortKey::Rarity:
+            if (a.rarity != b.rarity) return cmpInt(a.rarity, b.rarity);
+            break;
+          case SortKey::Cost:
+            if (a.cost != b.cost) return cmpInt(a.cost, b.cost);
+            break;
+          case SortKey::Level:
+            if (a.level != b.level) return cmpInt(a.level, b.level);
+            break;
+          case SortKey::Owned:
+            if (a.unlocked != b.unlocked) {
+              // 所持している方を先に（降順の場合はtrue > false）
+              return sortAscending_ ? (!a.unlocked && b.unlocked) : (a.unlocked && !b.unlocked);
+            }
+            break;
+        }
+        // タイブレーカー
+        if (a.rarity != b.rarity) return a.rarity > b.rarity;
+        if (a.cost != b.cost) return a.cost < b.cost;
+        return a.nameRank < b.nameRank;
+      });
+
+  // カード描画で文字列キーを引かないよう、並び順に合わせて portrait のハンドルを解決しておく
+  m_characterList.icon_handles.clear();
+  m_characterList.icon_handles.reserve(m_characterList.available_characters.size());
+  for (const auto *character : m_characterList.available_characters) {
+    m_characterList.icon_handles.push_back(ResolveIconHandle(character));
+  }
 }
 
 // ========== 描画メソチE�� ==========
@@ -436,20 +435,16 @@ void FormationOverlay::RenderSlot(const SquadSlot &slot) {
     const entities::Character *ch = slot.assigned_character;
 
     // portrait を薄く背景に敷く（誰が誰か判別しやすくする�E�E
-    if (!ch->icon_path.empty()) {
-      void *texturePtr = systemAPI_->Resource().GetTexture(ch->icon_path);
-      if (texturePtr) {
-        Texture2D *texture = static_cast<Texture2D *>(texturePtr);
-        if (texture && texture->id != 0) {
-          Rectangle src{0.0f, 0.0f, static_cast<float>(texture->width),
-                        static_cast<float>(texture->height)};
-          Rectangle dst{slot.position.x, slot.position.y, slot.width,
-                        slot.height};
-          // 未選択時に編成に含まれているいる場合は不透明度を上げる
-          Color tint{255, 255, 255, static_cast<unsigned char>(slot.is_hovered ? 70 : 120)};
-          systemAPI_->Render().DrawTexturePro(*texture, src, dst, {0.0f, 0.0f},
-                                              0.0f, tint);
-        }
+    if (slot.icon_handle != INVALID_TEXTURE_HANDLE) {
+      const TextureRegion region =
+          systemAPI_->Resource().GetTextureRegionByHandle(slot.icon_handle);
+      if (region.texture && region.texture->id != 0) {
+        Rectangle dst{slot.position.x, slot.position.y, slot.width,
+                      slot.height};
+        // 未選択時に編成に含まれているいる場合は不透明度を上げる
+        Color tint{255, 255, 255, static_cast<unsigned char>(slot.is_hovered ? 70 : 120)};
+        systemAPI_->Render().DrawTexturePro(*region.texture, region.rect, dst,
+                                            {0.0f, 0.0f}, 0.0f, tint);
       }
     }
 
@@ -533,9 +528,24 @@ void FormationOverlay::RenderCharacterList(SharedContext& ctx) {
       std::min(start_index + max_visible,
                static_cast<int>(m_characterList.available_characters.size()));
 
-  for (int i = start_index; i < end_index; ++i) {
-    RenderCharacterCard(m_characterList.available_characters[i],
-                        i - start_index, ctx);
+  // 段階ごとに全カードを描画し、ポートレートはスプライトバッチでテクスチャ順にまとめる
+  // （カード毎に 図形 → ポートレート → フォント と切り替わるのを避ける）
+  for (CardPass pass :
+       {CardPass::Background, CardPass::Portrait, CardPass::Foreground}) {
+    if (pass == CardPass::Portrait) {
+      systemAPI_->Render().BeginSpriteBatch();
+    }
+    for (int i = start_index; i < end_index; ++i) {
+      const TextureHandle icon_handle =
+          (static_cast<size_t>(i) < m_characterList.icon_handles.size())
+              ? m_characterList.icon_handles[i]
+              : INVALID_TEXTURE_HANDLE;
+      RenderCharacterCard(m_characterList.available_characters[i], icon_handle,
+                          i - start_index, ctx, pass);
+    }
+    if (pass == CardPass::Portrait) {
+      systemAPI_->Render().FlushSpriteBatch();
+    }
   }
 
   int total_rows =
@@ -565,7 +575,9 @@ void FormationOverlay::RenderCharacterList(SharedContext& ctx) {
 }
 
 void FormationOverlay::RenderCharacterCard(const entities::Character *character,
-                                           int card_index, SharedContext& ctx) {
+                                           TextureHandle icon_handle,
+                                           int card_index, SharedContext& ctx,
+                                           CardPass pass) {
   if (!character)
     return;
 
@@ -574,7 +586,7 @@ void FormationOverlay::RenderCharacterCard(const entities::Character *character,
   // ロック状態を取得
   bool is_locked = false;
   if (ctx.gameplayDataAPI) {
-    const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+    const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
     is_locked = !st.unlocked;
   }
 
@@ -592,27 +604,31 @@ void FormationOverlay::RenderCharacterCard(const entities::Character *character,
   }
 
   // 立体カード描画
-  UIEffects::DrawCard3D(systemAPI_, pos.x, pos.y, m_characterList.CARD_WIDTH,
-                        m_characterList.CARD_HEIGHT, bg_color, is_selected,
-                        is_hovered);
+  if (pass == CardPass::Background) {
+    UIEffects::DrawCard3D(systemAPI_, pos.x, pos.y, m_characterList.CARD_WIDTH,
+                          m_characterList.CARD_HEIGHT, bg_color, is_selected,
+                          is_hovered);
+    return;
+  }
 
   // portrait を薄く背景に敷く（誰が誰か判別しやすくする）
-  if (!is_locked && !character->icon_path.empty()) {
-    void *texturePtr = systemAPI_->Resource().GetTexture(character->icon_path);
-    if (texturePtr) {
-      Texture2D *texture = static_cast<Texture2D *>(texturePtr);
-      if (texture && texture->id != 0) {
-        Rectangle src{0.0f, 0.0f, static_cast<float>(texture->width),
-                      static_cast<float>(texture->height)};
-        Rectangle dst{pos.x, pos.y, m_characterList.CARD_WIDTH,
-                      m_characterList.CARD_HEIGHT};
-        // 未選択時に編成に含まれている場合は不透明度を上げる
-        int alpha = is_in_squad ? 70 : 120;
-        Color tint{255, 255, 255, static_cast<unsigned char>(alpha)};
-        systemAPI_->Render().DrawTexturePro(*texture, src, dst, {0.0f, 0.0f},
-                                            0.0f, tint);
-      }
+  if (pass == CardPass::Portrait) {
+    if (is_locked || icon_handle == INVALID_TEXTURE_HANDLE) {
+      return;
     }
+    // アイコンはアトラスに収録されるため、同じテクスチャのまま連続描画される
+    const TextureRegion region =
+        systemAPI_->Resource().GetTextureRegionByHandle(icon_handle);
+    if (region.texture && region.texture->id != 0) {
+      Rectangle dst{pos.x, pos.y, m_characterList.CARD_WIDTH,
+                    m_characterList.CARD_HEIGHT};
+      // 未選択時に編成に含まれている場合は不透明度を上げる
+      int alpha = is_in_squad ? 70 : 120;
+      Color tint{255, 255, 255, static_cast<unsigned char>(alpha)};
+      systemAPI_->Render().SubmitSprite(*region.texture, region.rect, dst,
+                                        {0.0f, 0.0f}, 0.0f, tint);
+    }
+    return;
   }
 
   // 発光効果�Eーダー�E�選択時�E�E
@@ -884,13 +900,13 @@ void FormationOverlay::AssignCharacter(int slot_id,
   
   // ロックされたキャラは配置できない
   if (ctx.gameplayDataAPI) {
-    const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+    const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
     if (!st.unlocked) {
       return; // ロックされている場合は配置しない
     }
   }
   
-  squad_slots_[slot_id].assigned_character = character;
+  SetSlotCharacter(squad_slots_[slot_id], character);
   UpdatePartySummary();
   formation_dirty_ = true;
 }
@@ -898,7 +914,7 @@ void FormationOverlay::AssignCharacter(int slot_id,
 void FormationOverlay::RemoveCharacter(int slot_id) {
   if (slot_id < 0 || slot_id >= 10)
     return;
-  squad_slots_[slot_id].assigned_character = nullptr;
+  SetSlotCharacter(squad_slots_[slot_id], nullptr);
   UpdatePartySummary();
   formation_dirty_ = true;
 }
@@ -906,14 +922,28 @@ void FormationOverlay::RemoveCharacter(int slot_id) {
 void FormationOverlay::SwapCharacters(int slot1_id, int slot2_id) {
   if (slot1_id < 0 || slot1_id >= 10 || slot2_id < 0 || slot2_id >= 10)
     return;
-  const entities::Character *temp = squad_slots_[slot1_id].assigned_character;
-  squad_slots_[slot1_id].assigned_character =
-      squad_slots_[slot2_id].assigned_character;
-  squad_slots_[slot2_id].assigned_character = temp;
+  std::swap(squad_slots_[slot1_id].assigned_character,
+            squad_slots_[slot2_id].assigned_character);
+  std::swap(squad_slots_[slot1_id].icon_handle,
+            squad_slots_[slot2_id].icon_handle);
   UpdatePartySummary();
   formation_dirty_ = true;
 }
 
+void FormationOverlay::SetSlotCharacter(SquadSlot &slot,
+                                        const entities::Character *character) {
+  slot.assigned_character = character;
+  slot.icon_handle = ResolveIconHandle(character);
+}
+
+TextureHandle FormationOverlay::ResolveIconHandle(
+    const entities::Character *character) const {
+  if (!character || character->icon_path.empty() || !systemAPI_) {
+    return INVALID_TEXTURE_HANDLE;
+  }
+  return systemAPI_->Resource().ResolveTextureHandle(character->icon_path);
+}
+
 // ========== パ�EチE��ー管琁E==========
 
 void FormationOverlay::UpdatePartySummary() {
@@ -954,7 +984,7 @@ void FormationOverlay::OnDragStart(int source_slot,
                                    SharedContext& ctx) {
   // ロックされたキャラはドラッグできない
   if (character && ctx.gameplayDataAPI) {
-    const auto st = ctx.gameplayDataAPI->GetCharacterState(character->id);
+    const auto &st = ctx.gameplayDataAPI->GetCharacterState(character->id);
     if (!st.unlocked) {
       return; // ロックされている場合はドラッグを開始しない
     }
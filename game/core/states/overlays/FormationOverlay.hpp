@@ -3,6 +3,7 @@
 #include "../../config/RenderPrimitives.hpp"
 #include "../../config/RenderTypes.hpp"
 #include "../../ecs/entities/Character.hpp"
+#include "../../game/ParticlePool.hpp"
 #include "IOverlay.hpp"
 #include <vector>
 
@@ -27,6 +28,10 @@ public:
   void Shutdown() override;
 
   OverlayState GetState() const override { return OverlayState::Formation; }
+  /// @brief 画面全体を不透明に塗るため、背面のシーン/オーバーレイは描画されない
+  OverlayCoverage GetCoverage() const override {
+    return OverlayCoverage::OpaqueFullScreen;
+  }
   bool RequestClose() const override;
   bool RequestTransition(GameState &nextState) const override;
 
@@ -37,6 +42,7 @@ private:
   struct SquadSlot {
     int slot_id = 0;                                         // 0-9
     const entities::Character *assigned_character = nullptr; // nullptr = empty
+    TextureHandle icon_handle = INVALID_TEXTURE_HANDLE;      // 配置時に解決した portrait
     Vec2 position = {0.0f, 0.0f};                            // 画面座標
     float width = 140.0f;
     float height = 120.0f;
@@ -69,6 +75,7 @@ private:
   /// @brief キャラクター一覧ビュー
   struct CharacterListView {
     std::vector<const entities::Character *> available_characters;
+    std::vector<TextureHandle> icon_handles;  // available_characters と同じ並び（並べ替えのたびに作り直す）
     int scroll_offset = 0;
     int visible_columns = 6;  // 5 → 6 に変更
     int visible_rows = 5;
@@ -132,6 +139,9 @@ private:
   // アニメーション時間（パルスエフェクト用）
   float animation_time_;
 
+  // 背景の浮遊粒子
+  game::ParticlePool ambient_particles_{64};
+
   // SharedContextの編成を一度だけ復元するためのフラグ
   bool restored_from_context_ = false;
   bool formation_dirty_ = false;
@@ -141,6 +151,9 @@ private:
   SortKey currentSortKey_ = SortKey::Owned;
   bool sortAscending_ = false;
 
+  // キャラクターカードの描画段階（背景 → ポートレート → 枠/テキスト）
+  enum class CardPass { Background, Portrait, Foreground };
+
   // ========== プライベートメソッド ==========
 
   // 初期化・クリーンアップ
@@ -157,8 +170,9 @@ private:
   void RenderResetButton();
   void RenderPartySummary();
   void RenderCharacterList(SharedContext &ctx);
-  void RenderCharacterCard(const entities::Character *character, int card_index,
-                           SharedContext &ctx);
+  void RenderCharacterCard(const entities::Character *character,
+                           TextureHandle icon_handle, int card_index,
+                           SharedContext &ctx, CardPass pass);
   void RenderButtons();
   void RenderDividers();
   void RenderDraggingCharacter();
@@ -175,6 +189,9 @@ private:
                        SharedContext &ctx);
   void RemoveCharacter(int slot_id);
   void SwapCharacters(int slot1_id, int slot2_id);
+  /// @brief スロットのキャラを差し替え、portrait のハンドルも合わせて解決する
+  void SetSlotCharacter(SquadSlot &slot, const entities::Character *character);
+  TextureHandle ResolveIconHandle(const entities::Character *character) const;
 
   // パーティー管理
   void UpdatePartySummary();
@@ -12,6 +12,13 @@ namespace core {
 class BaseSystemAPI;
 class UISystemAPI;
 
+/// @brief オーバーレイが画面をどれだけ覆うか（背面の描画省略の判定に使う）
+enum class OverlayCoverage {
+    Translucent,      // 全面だが半透明（背面は見える）
+    Partial,          // 一部の領域のみ（ウィンドウ型）
+    OpaqueFullScreen  // 全面を不透明に塗る（背面は一切見えない）
+};
+
 /// @brief オーバーレイ基底インターフェース
 ///
 /// すべてのオーバーレイが実装する必要があるインターフェース。
@@ -39,9 +46,22 @@ public:
     /// @return ImGuiを使用する場合true
     virtual bool IsImGuiOverlay() const { return false; }
 
+    /// @brief 画面の覆い方（OpaqueFullScreen なら背面のシーン/オーバーレイは描画されない）
+    virtual OverlayCoverage GetCoverage() const { return OverlayCoverage::Partial; }
+
     /// @brief オーバーレイのクリーンアップ
     virtual void Shutdown() = 0;
 
+    /// @brief 表示開始時に呼ばれる（初回は Initialize の直後、再利用時は Initialize なしで呼ばれる）
+    virtual void OnShow() {}
+
+    /// @brief 非表示になる直前に呼ばれる（この後 Shutdown されるか、プールに戻される）
+    virtual void OnHide() {}
+
+    /// @brief 閉じた後もインスタンスを残して再利用してよいか
+    /// @return OnShow で1回分の表示状態（クローズ/遷移リクエスト等）を戻せる場合 true
+    virtual bool IsReusable() const { return false; }
+
     /// @brief オーバーレイのステートを取得
     /// @return オーバーレイのステート
     virtual OverlayState GetState() const = 0;
@@ -226,6 +226,14 @@ void LicenseOverlay::Shutdown() {
     LOG_INFO("LicenseOverlay shutdown");
 }
 
+void LicenseOverlay::OnShow() {
+    // コンテンツ高さは Initialize 時の計算結果を使い回す
+    requestClose_ = false;
+    hasTransitionRequest_ = false;
+    scrollY_ = 0.0f;
+    isDraggingScrollbar_ = false;
+}
+
 bool LicenseOverlay::RequestClose() const {
     if (requestClose_) {
         requestClose_ = false;
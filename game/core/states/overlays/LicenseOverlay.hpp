@@ -22,6 +22,8 @@ public:
     void Update(SharedContext& ctx, float deltaTime) override;
     void Render(SharedContext& ctx) override;
     void Shutdown() override;
+    void OnShow() override;
+    bool IsReusable() const override { return true; }
 
     OverlayState GetState() const override { return OverlayState::License; }
     bool RequestClose() const override;
@@ -112,6 +112,12 @@ void PauseOverlay::Shutdown() {
     systemAPI_ = nullptr;
 }
 
+void PauseOverlay::OnShow() {
+    requestClose_ = false;
+    hasTransitionRequest_ = false;
+    requestedNextState_ = GameState::Home;
+}
+
 bool PauseOverlay::RequestClose() const {
     if (requestClose_) {
         requestClose_ = false;
@@ -18,6 +18,8 @@ public:
     void Update(SharedContext& ctx, float deltaTime) override;
     void Render(SharedContext& ctx) override;
     void Shutdown() override;
+    void OnShow() override;
+    bool IsReusable() const override { return true; }
 
     OverlayState GetState() const override { return OverlayState::Pause; }
     bool RequestClose() const override;
@@ -50,6 +50,7 @@ bool SettingsOverlay::Initialize(BaseSystemAPI* systemAPI, UISystemAPI* uiAPI) {
 
     // 読み込んだ設定を適用
     ApplySettings();
+    settingsLoadedOnInitialize_ = true;
 
     isInitialized_ = true;
     LOG_INFO("SettingsOverlay initialized");
@@ -67,6 +68,20 @@ void SettingsOverlay::Shutdown() {
     LOG_INFO("SettingsOverlay shutdown");
 }
 
+void SettingsOverlay::OnShow() {
+    // 別インスタンス（ホームの設定タブ）で保存された内容を拾うため読み直す（適用済みなので Apply はしない）
+    requestClose_ = false;
+    hasTransitionRequest_ = false;
+    requestQuit_ = false;
+    isDraggingSlider_ = false;
+    // 生成直後の初回表示は Initialize で読んだばかりなので読み直さない
+    if (settingsLoadedOnInitialize_) {
+        settingsLoadedOnInitialize_ = false;
+        return;
+    }
+    LoadSettings();
+}
+
 bool SettingsOverlay::RequestClose() const {
     if (requestClose_) {
         requestClose_ = false;
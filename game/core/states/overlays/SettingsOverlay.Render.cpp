@@ -20,6 +20,10 @@ void SettingsOverlay::Render(SharedContext& ctx) {
         return;
     }
 
+    // 全面を不透明に塗る（GetCoverage が OpaqueFullScreen のため背面は描画されない）
+    systemAPI_->Render().DrawRectangle(0, 0, 1920, 1080,
+                                       ToCoreColor(ui::OverlayColors::MAIN_BG));
+
     // ウィンドウの位置とサイズ
     const float windowX = 200.0f;
     const float windowY = 150.0f;
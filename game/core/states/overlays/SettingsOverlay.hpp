@@ -37,6 +37,10 @@ public:
     void Update(SharedContext& ctx, float deltaTime) override;
     void Render(SharedContext& ctx) override;
     void Shutdown() override;
+    void OnShow() override;
+    bool IsReusable() const override { return true; }
+    /// @brief 画面全体を不透明に塗るため、背面のシーン/オーバーレイは描画されない
+    OverlayCoverage GetCoverage() const override { return OverlayCoverage::OpaqueFullScreen; }
 
     OverlayState GetState() const override { return OverlayState::Settings; }
     bool RequestClose() const override;
@@ -47,6 +51,7 @@ private:
     BaseSystemAPI* systemAPI_ = nullptr;
     AudioControlAPI* audioAPI_ = nullptr;
     bool isInitialized_ = false;
+    bool settingsLoadedOnInitialize_ = false;  // 初回 OnShow での再読み込みを省く
     mutable bool requestClose_ = false;
     mutable bool hasTransitionRequest_ = false;
     mutable GameState requestedNextState_;
@@ -32,6 +32,12 @@ public:
     /// @brief 終了処理
     virtual void Shutdown() = 0;
 
+    /// @brief タブが選択されたとき
+    virtual void OnShow() {}
+
+    /// @brief 別タブへ切り替わる直前
+    virtual void OnHide() {}
+
     /// @brief ステート遷移リクエストを取得
     virtual bool RequestTransition(GameState& nextState) const = 0;
 
@@ -54,6 +54,18 @@ public:
         }
     }
 
+    void OnShow() override {
+        if (overlay_) {
+            overlay_->OnShow();
+        }
+    }
+
+    void OnHide() override {
+        if (overlay_) {
+            overlay_->OnHide();
+        }
+    }
+
     bool RequestTransition(GameState& nextState) const override {
         if (!overlay_) {
             return false;
@@ -104,6 +116,9 @@ bool TabContent::Initialize(BaseSystemAPI* systemAPI, UISystemAPI* uiAPI) {
         }
     }
 
+    if (auto* content = GetCurrentContent()) {
+        content->OnShow();
+    }
     return true;
 }
 
@@ -146,7 +161,14 @@ void TabContent::SwitchTab(HomeTab tab) {
     if (current_tab_ == tab) {
         return;
     }
+    // インスタンスは全タブ分保持したまま、表示切り替えだけを通知する
+    if (auto* content = GetCurrentContent()) {
+        content->OnHide();
+    }
     current_tab_ = tab;
+    if (auto* content = GetCurrentContent()) {
+        content->OnShow();
+    }
     LOG_INFO("TabContent: Switched to tab: {}", static_cast<int>(tab));
 }
 
@@ -191,6 +213,9 @@ bool TabContent::RequestQuit() const {
 }
 
 void TabContent::Shutdown() {
+    if (auto* content = GetCurrentContent()) {
+        content->OnHide();
+    }
     for (auto& pair : contents_) {
         if (pair.second) {
             pair.second->Shutdown();
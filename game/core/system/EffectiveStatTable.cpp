@@ -0,0 +1,64 @@
+#include "EffectiveStatTable.hpp"
+
+namespace game {
+namespace core {
+
+const EffectiveStatTable::Result* EffectiveStatTable::Get(
+    const std::string& characterId,
+    const entities::CharacterManager& characterManager,
+    const entities::ItemPassiveManager& itemPassiveManager,
+    const PlayerDataManager& playerDataManager) {
+    const uint64_t revision = playerDataManager.GetCharacterRevision(characterId);
+
+    auto it = entries_.find(characterId);
+    if (it != entries_.end() && it->second.revision == revision &&
+        it->second.mastersRevision == mastersRevision_) {
+        ++stats_.hits;
+        return &it->second.stats;
+    }
+
+    const auto& masters = characterManager.GetAllMasters();
+    auto masterIt = masters.find(characterId);
+    if (masterIt == masters.end()) {
+        if (it != entries_.end()) {
+            entries_.erase(it);
+        }
+        return nullptr;
+    }
+
+    Entry& entry = (it != entries_.end()) ? it->second : entries_[characterId];
+    entry.stats = entities::CharacterStatCalculator::Calculate(
+        masterIt->second, playerDataManager.GetCharacterState(characterId), itemPassiveManager);
+    entry.revision = revision;
+    entry.mastersRevision = mastersRevision_;
+    ++stats_.rebuilds;
+    return &entry.stats;
+}
+
+const system::TowerEnhancementMultipliers& EffectiveStatTable::GetTowerMultipliers(
+    const PlayerDataManager& playerDataManager,
+    const std::unordered_map<std::string, entities::TowerAttachment>& attachmentMasters) {
+    const uint64_t revision = playerDataManager.GetTowerRevision();
+    if (towerRevision_ != revision || towerMastersRevision_ != mastersRevision_) {
+        towerMultipliers_ = system::CalculateTowerEnhancementMultipliers(
+            playerDataManager.GetTowerEnhancements(), playerDataManager.GetTowerAttachments(),
+            attachmentMasters);
+        towerRevision_ = revision;
+        towerMastersRevision_ = mastersRevision_;
+        ++stats_.rebuilds;
+    } else {
+        ++stats_.hits;
+    }
+    return towerMultipliers_;
+}
+
+void EffectiveStatTable::Clear() {
+    entries_.clear();
+    towerMultipliers_ = system::TowerEnhancementMultipliers{};
+    towerRevision_ = 0;
+    towerMastersRevision_ = 0;
+    ++mastersRevision_;
+}
+
+} // namespace core
+} // namespace game
@@ -0,0 +1,67 @@
+#pragma once
+
+// 標準ライブラリ
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+// プロジェクト内
+#include "../ecs/entities/CharacterManager.hpp"
+#include "../ecs/entities/CharacterStatCalculator.hpp"
+#include "../ecs/entities/ItemPassiveManager.hpp"
+#include "../ecs/entities/TowerAttachment.hpp"
+#include "PlayerDataManager.hpp"
+#include "TowerEnhancementEffects.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief セーブのロードアウトを適用した最終ステータスのキャッシュ
+///
+/// キャラごとに PlayerDataManager のリビジョンを記録し、そのキャラの状態か
+/// マスターが変わったときだけ CharacterStatCalculator で再計算します。
+/// タワー強化の乗算補正も同じ方式で1件だけ保持します。
+class EffectiveStatTable {
+public:
+    using Result = entities::CharacterStatCalculator::Result;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t rebuilds = 0;
+    };
+
+    /// @brief 最終ステータスを取得（キャラが存在しない場合は nullptr）
+    const Result* Get(const std::string& characterId,
+                      const entities::CharacterManager& characterManager,
+                      const entities::ItemPassiveManager& itemPassiveManager,
+                      const PlayerDataManager& playerDataManager);
+
+    /// @brief タワー強化・アタッチメントによる乗算補正を取得
+    const system::TowerEnhancementMultipliers& GetTowerMultipliers(
+        const PlayerDataManager& playerDataManager,
+        const std::unordered_map<std::string, entities::TowerAttachment>& attachmentMasters);
+
+    /// @brief マスター（キャラ/装備/パッシブ/アタッチメント）の更新時に呼ぶ
+    void InvalidateMasters() { ++mastersRevision_; }
+
+    void Clear();
+
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    struct Entry {
+        Result stats;
+        uint64_t revision = 0;
+        uint64_t mastersRevision = 0;
+    };
+
+    std::unordered_map<std::string, Entry> entries_;
+    system::TowerEnhancementMultipliers towerMultipliers_{};
+    uint64_t towerRevision_ = 0;
+    uint64_t towerMastersRevision_ = 0;
+    uint64_t mastersRevision_ = 1;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace game
@@ -1,6 +1,7 @@
 #include "GameSystem.hpp"
 #include "../../utils/Log.h"
 #include "../ui/UiAssetKeys.hpp"
+#include "Profiler.hpp"
 #include <rlImGui.h>
 #include <fstream>
 #include <filesystem>
@@ -129,6 +130,9 @@ int GameSystem::Run() {
 
   // メインルーチE
   while (!systemAPI_->Window().WindowShouldClose() && !requestShutdown_) {
+    // 前フレームの計測区間を集計してから今フレームの計測を始める
+    PROFILE_FRAME_END();
+    PROFILE_SCOPE("GameSystem::Frame");
     float deltaTime = systemAPI_->Timing().GetFrameTime();
     sharedContext_.deltaTime = deltaTime;
     sharedContext_.currentState = currentState_;
@@ -154,6 +158,7 @@ int GameSystem::Run() {
     }
 
     // ===== 描画フェーズ =====
+    PROFILE_SCOPE("GameSystem::Render");
     systemAPI_->Render().BeginRender();
 
     sceneOverlayAPI_->Render(currentState_);
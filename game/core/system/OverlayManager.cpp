@@ -12,6 +12,8 @@
 #include "../states/overlays/CustomStageEnemyQueueOverlay.hpp"
 #include "../../utils/Log.h"
 #include "../api/BaseSystemAPI.hpp"
+#include <algorithm>
+#include <iterator>
 
 namespace game {
 namespace core {
@@ -40,19 +42,26 @@ bool OverlayManager::PushOverlay(OverlayState state, BaseSystemAPI* systemAPI, U
         return false;
     }
 
-    auto overlay = CreateOverlay(state, systemAPI, uiAPI);
-    if (!overlay) {
-        LOG_ERROR("OverlayManager: Failed to create overlay {}", static_cast<int>(state));
-        return false;
-    }
+    auto overlay = TakeFromPool(state);
+    const bool reused = static_cast<bool>(overlay);
+    if (!reused) {
+        overlay = CreateOverlay(state, systemAPI, uiAPI);
+        if (!overlay) {
+            LOG_ERROR("OverlayManager: Failed to create overlay {}", static_cast<int>(state));
+            return false;
+        }
 
-    if (!overlay->Initialize(systemAPI, uiAPI)) {
-        LOG_ERROR("OverlayManager: Failed to initialize overlay {}", static_cast<int>(state));
-        return false;
+        if (!overlay->Initialize(systemAPI, uiAPI)) {
+            LOG_ERROR("OverlayManager: Failed to initialize overlay {}", static_cast<int>(state));
+            return false;
+        }
     }
 
+    overlay->OnShow();
     stack_.push_back(std::move(overlay));
-    LOG_INFO("OverlayManager: Pushed overlay {}", static_cast<int>(state));
+    ++stackRevision_;
+    LOG_INFO("OverlayManager: Pushed overlay {}{}", static_cast<int>(state),
+             reused ? " (pooled)" : "");
     return true;
 }
 
@@ -62,9 +71,17 @@ void OverlayManager::PopOverlay() {
         return;
     }
 
-    auto& top = stack_.back();
-    top->Shutdown();
+    std::unique_ptr<IOverlay> top = std::move(stack_.back());
     stack_.pop_back();
+    ++stackRevision_;
+    top->OnHide();
+
+    if (poolCapacity_ > 0 && top->IsReusable()) {
+        pool_.push_back(std::move(top));
+        TrimPool(poolCapacity_);
+    } else {
+        top->Shutdown();
+    }
     LOG_INFO("OverlayManager: Popped overlay");
 }
 
@@ -107,17 +124,31 @@ void OverlayManager::Update(SharedContext& ctx, float deltaTime) {
 void OverlayManager::Render(SharedContext& ctx) {
     if (stack_.empty()) return;
 
-    // P1: 背景半透�Eをここで一括描画
-    // 背景シーンを見せたまま、�Eオーバ�Eレイを重ねる想宁E
+    // 不透明な全面オーバーレイより奥は見えないので描かない
+    const size_t topOpaque = FindTopOpaqueIndex();
+    RenderRange(ctx, topOpaque < stack_.size() ? topOpaque : 0, stack_.size());
+}
 
-    // 下から頁E��描画�E�奥 ↁE手前�E�E
-    for (auto& overlay : stack_) {
-        if (!overlay->IsImGuiOverlay()) {
-            overlay->Render(ctx);
+void OverlayManager::RenderRange(SharedContext& ctx, size_t begin, size_t end) {
+    end = std::min(end, stack_.size());
+    // 下から順に描画（奥 → 手前）
+    for (size_t i = begin; i < end; ++i) {
+        if (!stack_[i]->IsImGuiOverlay()) {
+            stack_[i]->Render(ctx);
         }
     }
 }
 
+size_t OverlayManager::FindTopOpaqueIndex() const {
+    for (size_t i = stack_.size(); i > 0; --i) {
+        const IOverlay& overlay = *stack_[i - 1];
+        if (!overlay.IsImGuiOverlay() && overlay.GetCoverage() == OverlayCoverage::OpaqueFullScreen) {
+            return i - 1;
+        }
+    }
+    return stack_.size();
+}
+
 void OverlayManager::RenderImGui(SharedContext& ctx) {
     if (stack_.empty()) {
         return;
@@ -132,6 +163,34 @@ void OverlayManager::RenderImGui(SharedContext& ctx) {
 
 void OverlayManager::Shutdown() {
     PopAllOverlays();
+    TrimPool(0);
+}
+
+void OverlayManager::SetPoolCapacity(size_t capacity) {
+    poolCapacity_ = capacity;
+    TrimPool(poolCapacity_);
+}
+
+void OverlayManager::TrimPool(size_t keep) {
+    if (pool_.size() <= keep) {
+        return;
+    }
+    const size_t evictCount = pool_.size() - keep;
+    for (size_t i = 0; i < evictCount; ++i) {
+        pool_[i]->Shutdown();
+    }
+    pool_.erase(pool_.begin(), pool_.begin() + static_cast<std::ptrdiff_t>(evictCount));
+}
+
+std::unique_ptr<IOverlay> OverlayManager::TakeFromPool(OverlayState state) {
+    for (auto it = pool_.rbegin(); it != pool_.rend(); ++it) {
+        if ((*it)->GetState() == state) {
+            std::unique_ptr<IOverlay> overlay = std::move(*it);
+            pool_.erase(std::next(it).base());
+            return overlay;
+        }
+    }
+    return nullptr;
 }
 
 bool OverlayManager::IsEmpty() const {
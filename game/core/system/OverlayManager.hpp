@@ -3,6 +3,7 @@
 #include "../config/SharedContext.hpp"
 #include "../config/GameState.hpp"
 #include "../states/overlays/IOverlay.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -17,8 +18,12 @@ class UISystemAPI;
 ///
 /// オーバーレイのスタック管理（LIFO）を行います。
 /// 最上層のオーバーレイのみUpdateを実行し、すべてのオーバーレイをRenderします。
+/// IsReusable() なオーバーレイは Pop 時に Shutdown せずプールへ戻し、次の Push では
+/// Initialize を省いて OnShow だけで再表示します（プールは最近使った順に上限件数まで保持）。
 class OverlayManager {
 public:
+    static constexpr size_t DEFAULT_POOL_CAPACITY = 4;
+
     OverlayManager();
     ~OverlayManager();
 
@@ -43,16 +48,33 @@ public:
 
     /// @brief オーバーレイの描画処理
     /// @param ctx 共有コンテキスト
-    /// @note すべてのオーバーレイを描画（奥のものが見えるように）
+    /// @note 最も手前の OpaqueFullScreen より奥は描画しない
     void Render(SharedContext& ctx);
 
+    /// @brief stack_[begin, end) の非ImGuiオーバーレイを奥から順に描画
+    void RenderRange(SharedContext& ctx, size_t begin, size_t end);
+
+    /// @brief 最も手前の OpaqueFullScreen オーバーレイの位置（無ければ Count()）
+    size_t FindTopOpaqueIndex() const;
+
+    /// @brief Push/Pop のたびに増える番号（背面キャッシュの無効化判定用）
+    uint64_t GetStackRevision() const { return stackRevision_; }
+
     /// @brief ImGuiオーバーレイの描画処理（ImGuiフレーム内）
     /// @param ctx 共有コンテキスト
     void RenderImGui(SharedContext& ctx);
 
-    /// @brief オーバーレイのクリーンアップ
+    /// @brief オーバーレイのクリーンアップ（プールも破棄）
     void Shutdown();
 
+    /// @brief プールに保持するインスタンス数の上限（0 でプール無効）
+    void SetPoolCapacity(size_t capacity);
+    size_t GetPoolCapacity() const { return poolCapacity_; }
+    size_t GetPooledCount() const { return pool_.size(); }
+
+    /// @brief プールを keep 件まで減らす（古いものから Shutdown。メモリ逼迫時など）
+    void TrimPool(size_t keep = 0);
+
     /// @brief スタックが空かどうか
     /// @return 空の場合true
     bool IsEmpty() const;
@@ -91,6 +113,9 @@ public:
 
 private:
     std::vector<std::unique_ptr<IOverlay>> stack_;
+    std::vector<std::unique_ptr<IOverlay>> pool_;  // 末尾ほど最近閉じたもの
+    size_t poolCapacity_ = DEFAULT_POOL_CAPACITY;
+    uint64_t stackRevision_ = 0;
 
     // P0: オーバーレイからの遷移要求をバッファ
     GameState requestedTransition_ = GameState::Initializing;
@@ -104,6 +129,9 @@ private:
     /// @return 作成されたオーバーレイのunique_ptr、失敗時はnullptr
     /// @note フェーズ3で各オーバーレイクラスが実装されたら、ここでインスタンス化
     std::unique_ptr<IOverlay> CreateOverlay(OverlayState state, BaseSystemAPI* systemAPI, UISystemAPI* uiAPI);
+
+    /// @brief プールから指定ステートのインスタンスを取り出す（無ければ nullptr）
+    std::unique_ptr<IOverlay> TakeFromPool(OverlayState state);
 };
 
 } // namespace core
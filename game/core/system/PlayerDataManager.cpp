@@ -2,8 +2,12 @@
 
 // 標準ライブラリ
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <thread>
 
 // 外部ライブラリ
 #include <nlohmann/json.hpp>
@@ -13,6 +17,7 @@
 #include "../ecs/entities/CharacterManager.hpp"
 #include "../ecs/entities/ItemPassiveManager.hpp"
 #include "../ecs/entities/StageManager.hpp"
+#include "SaveWriter.hpp"
 
 using json = nlohmann::json;
 
@@ -26,6 +31,8 @@ namespace {
 // v5: tower_attachments を追加
 constexpr int SAVE_VERSION = 5;
 constexpr int MAX_GACHA_HISTORY = 100;
+// 連続した保存要求をまとめる窓（強化ボタン連打やガチャ連続実行を1回の書き込みにする）
+constexpr std::chrono::milliseconds SAVE_COALESCE_WINDOW{250};
 
 int ClampNonNegative(int v) { return std::max(0, v); }
 int ClampLevel(int v) { return std::max(1, v); }
@@ -36,7 +43,11 @@ bool PlayerDataManager::LoadOrCreate(const std::string& filePath,
                                     const entities::CharacterManager& characterManager,
                                     const entities::ItemPassiveManager& itemPassiveManager,
                                     const entities::StageManager& stageManager) {
+    // 書き込み待ちのセーブがあれば先に反映してから読む
+    FlushSave();
     filePath_ = filePath;
+    baseRevision_ = ++revision_;
+    characterRevisions_.clear();
 
     try {
         std::ifstream file(filePath_);
@@ -45,7 +56,7 @@ bool PlayerDataManager::LoadOrCreate(const std::string& filePath,
             data_ = PlayerSaveData();
             data_.version = SAVE_VERSION;
             EnsureDefaultsFromMasters(characterManager, itemPassiveManager);
-            Save();
+            SaveSync();
             return true;
         }
 
@@ -255,7 +266,7 @@ bool PlayerDataManager::LoadOrCreate(const std::string& filePath,
 
         if (needsMigrationSave) {
             LOG_INFO("PlayerDataManager: migrating save schema and writing updated file: {}", filePath_);
-            Save();
+            SaveSync();
         }
 
         LOG_INFO("PlayerDataManager: save loaded: {}", filePath_);
@@ -270,39 +281,89 @@ bool PlayerDataManager::LoadOrCreate(const std::string& filePath,
     data_.version = SAVE_VERSION;
     EnsureDefaultsFromMasters(characterManager, itemPassiveManager);
     EnsureStageStatesFromMasters(stageManager);
-    Save();
+    SaveSync();
     return true;
 }
 
+PlayerDataManager::PlayerDataManager() = default;
+
+PlayerDataManager::~PlayerDataManager() {
+    // 保留中の保存を書き切ってから破棄
+    saveWriter_.reset();
+}
+
 bool PlayerDataManager::Save() const {
+    if (!saveWritesEnabled_) {
+        return true;
+    }
+#if defined(__EMSCRIPTEN__)
+    // Web 版はスレッドを使わず、直後の永続化同期に間に合うよう同期で書く
+    return SaveSync();
+#else
+    if (!saveWriter_) {
+        saveWriter_ = std::make_unique<SaveWriter>(SAVE_COALESCE_WINDOW);
+    }
+    const bool queued = saveWriter_->Request([snapshot = data_, path = filePath_]() {
+        return WriteSaveFile(snapshot, path);
+    });
+    if (!queued) {
+        LOG_ERROR("PlayerDataManager: failed to queue save: {}", filePath_);
+    } else {
+        lastSyncSaveFailed_ = false;  // 以降の結果はライターが持つ
+    }
+    return queued;
+#endif
+}
+
+bool PlayerDataManager::SaveSync() const {
+    if (!saveWritesEnabled_) {
+        return true;
+    }
+    const bool ok = WriteSaveFile(data_, filePath_);
+    lastSyncSaveFailed_ = !ok;
+    return ok;
+}
+
+bool PlayerDataManager::FlushSave() const {
+    if (!saveWriter_) {
+        return !lastSyncSaveFailed_;
+    }
+    return saveWriter_->Flush();
+}
+
+bool PlayerDataManager::HasSaveError() const {
+    return lastSyncSaveFailed_ || (saveWriter_ && saveWriter_->HasError());
+}
+
+bool PlayerDataManager::WriteSaveFile(const PlayerSaveData& data, const std::string& path) {
     try {
-        std::filesystem::path p(filePath_);
+        std::filesystem::path p(path);
         if (p.has_parent_path()) {
             std::filesystem::create_directories(p.parent_path());
         }
 
         json root;
         root["version"] = SAVE_VERSION;
-        root["gold"] = ClampNonNegative(data_.gold);
-        root["gems"] = ClampNonNegative(data_.gems);
-        root["tickets"] = ClampNonNegative(data_.tickets);
-        root["max_tickets"] = ClampNonNegative(data_.maxTickets);
-        root["gacha_dust"] = ClampNonNegative(data_.gachaDust);
-        root["gacha_pity"] = ClampNonNegative(data_.gachaPityCounter);
-        root["gacha_roll_seq"] = ClampNonNegative(data_.gachaRollSequence);
+        root["gold"] = ClampNonNegative(data.gold);
+        root["gems"] = ClampNonNegative(data.gems);
+        root["tickets"] = ClampNonNegative(data.tickets);
+        root["max_tickets"] = ClampNonNegative(data.maxTickets);
+        root["gacha_dust"] = ClampNonNegative(data.gachaDust);
+        root["gacha_pity"] = ClampNonNegative(data.gachaPityCounter);
+        root["gacha_roll_seq"] = ClampNonNegative(data.gachaRollSequence);
 
         // tower enhancements
         json tower;
-        tower["tower_hp_level"] = ClampNonNegative(data_.towerEnhancements.towerHpLevel);
-        tower["wallet_growth_level"] = ClampNonNegative(data_.towerEnhancements.walletGrowthLevel);
-        tower["cost_regen_level"] = ClampNonNegative(data_.towerEnhancements.costRegenLevel);
-        tower["ally_attack_level"] = ClampNonNegative(data_.towerEnhancements.allyAttackLevel);
-        tower["ally_hp_level"] = ClampNonNegative(data_.towerEnhancements.allyHpLevel);
+        tower["tower_hp_level"] = ClampNonNegative(data.towerEnhancements.towerHpLevel);
+        tower["wallet_growth_level"] = ClampNonNegative(data.towerEnhancements.walletGrowthLevel);
+        tower["cost_regen_level"] = ClampNonNegative(data.towerEnhancements.costRegenLevel);
+        tower["ally_attack_level"] = ClampNonNegative(data.towerEnhancements.allyAttackLevel);
+        tower["ally_hp_level"] = ClampNonNegative(data.towerEnhancements.allyHpLevel);
         root["tower_enhancements"] = tower;
 
         // tower attachments
         json attachments = json::array();
-        for (const auto& slot : data_.towerAttachments) {
+        for (const auto& slot : data.towerAttachments) {
             json s;
             s["id"] = slot.id;
             s["level"] = ClampLevel(slot.level);
@@ -313,7 +374,7 @@ bool PlayerDataManager::Save() const {
         // formation
         json formation;
         formation["slots"] = json::array();
-        for (const auto& s : data_.formation.slots) {
+        for (const auto& s : data.formation.slots) {
             json slot;
             slot["slot"] = s.first;
             slot["character_id"] = s.second;
@@ -323,7 +384,7 @@ bool PlayerDataManager::Save() const {
 
         // characters
         json characters = json::object();
-        for (const auto& [id, st] : data_.characters) {
+        for (const auto& [id, st] : data.characters) {
             json c;
             c["unlocked"] = st.unlocked;
             c["level"] = ClampLevel(st.level);
@@ -350,22 +411,22 @@ bool PlayerDataManager::Save() const {
         // inventory
         json inv;
         inv["equipment"] = json::object();
-        for (const auto& [id, count] : data_.ownedEquipment) {
+        for (const auto& [id, count] : data.ownedEquipment) {
             inv["equipment"][id] = ClampNonNegative(count);
         }
         inv["passives"] = json::object();
-        for (const auto& [id, count] : data_.ownedPassives) {
+        for (const auto& [id, count] : data.ownedPassives) {
             inv["passives"][id] = ClampNonNegative(count);
         }
         inv["tower_attachments"] = json::object();
-        for (const auto& [id, count] : data_.ownedTowerAttachments) {
+        for (const auto& [id, count] : data.ownedTowerAttachments) {
             inv["tower_attachments"][id] = ClampNonNegative(count);
         }
         root["inventory"] = inv;
 
         // gacha history
         json history = json::array();
-        for (const auto& h : data_.gachaHistory) {
+        for (const auto& h : data.gachaHistory) {
             json entry;
             entry["seq"] = ClampNonNegative(h.seq);
             entry["equipment_id"] = h.equipmentId;
@@ -377,7 +438,7 @@ bool PlayerDataManager::Save() const {
 
         // stages
         json stages = json::object();
-        for (const auto& [id, st] : data_.stages) {
+        for (const auto& [id, st] : data.stages) {
             json s;
             s["is_cleared"] = st.isCleared;
             s["is_locked"] = st.isLocked;
@@ -386,14 +447,38 @@ bool PlayerDataManager::Save() const {
         }
         root["stages"] = stages;
 
-        std::ofstream out(filePath_);
-        if (!out.is_open()) {
-            LOG_ERROR("PlayerDataManager: failed to open save file for writing: {}", filePath_);
+        // 途中で落ちても既存のセーブを壊さないよう、一時ファイルへ書いてから置き換える
+        // 一時ファイル名は書き込みごとに変え、同じセーブを複数のライターが書いても混ざらないようにする
+        static std::atomic<uint64_t> tempSequence{0};
+        const std::string tempPath =
+            path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
+            "." + std::to_string(tempSequence.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                LOG_ERROR("PlayerDataManager: failed to open save file for writing: {}", tempPath);
+                return false;
+            }
+            out << root.dump(2);
+            out.flush();
+            if (!out) {
+                LOG_ERROR("PlayerDataManager: failed to write save file: {}", tempPath);
+                out.close();
+                std::error_code removeError;
+                std::filesystem::remove(tempPath, removeError);
+                return false;
+            }
+        }
+        std::error_code renameError;
+        std::filesystem::rename(tempPath, path, renameError);
+        if (renameError) {
+            LOG_ERROR("PlayerDataManager: failed to replace save file {}: {}", path,
+                      renameError.message());
+            std::error_code removeError;
+            std::filesystem::remove(tempPath, removeError);
             return false;
         }
-
-        out << root.dump(2);
-        LOG_INFO("PlayerDataManager: saved: {}", filePath_);
+        LOG_INFO("PlayerDataManager: saved: {}", path);
         return true;
     } catch (const std::exception& e) {
         LOG_ERROR("PlayerDataManager: failed to save: {}", e.what());
@@ -409,16 +494,19 @@ void PlayerDataManager::SetFormationFromSharedContext(const FormationData& forma
     data_.formation = formation;
 }
 
-PlayerDataManager::CharacterState PlayerDataManager::GetCharacterState(const std::string& characterId) const {
+const PlayerDataManager::CharacterState& PlayerDataManager::GetCharacterState(
+    const std::string& characterId) const {
+    static const CharacterState kDefaultState{};
     auto it = data_.characters.find(characterId);
     if (it != data_.characters.end()) {
         return it->second;
     }
-    return CharacterState();
+    return kDefaultState;
 }
 
 void PlayerDataManager::SetCharacterState(const std::string& characterId, const CharacterState& state) {
     data_.characters[characterId] = state;
+    characterRevisions_[characterId] = ++revision_;
 }
 
 PlayerDataManager::PlayerSaveData::StageState PlayerDataManager::GetStageState(
@@ -3,6 +3,8 @@
 // 標準ライブラリ
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -19,10 +21,14 @@ class ItemPassiveManager;
 class StageManager;
 } // namespace entities
 
+class SaveWriter;
+
 /// @brief プレイヤー永続データの管理（単一JSON）
 ///
 /// 保存先: data/saves/player_save.json
 /// 例外安全: JSONパースは必ず try-catch し、失敗時はデフォルト値で継続します。
+/// 保存: Save() はスナップショットを取って即座に戻り、直列化と書き込みは
+///       バックグラウンドで短い窓ごとにまとめて行います（一時ファイル + rename）。
 class PlayerDataManager {
 public:
     struct PassiveSlot {
@@ -82,24 +88,40 @@ public:
         std::array<TowerAttachmentSlot, 3> towerAttachments{};
     };
 
-    PlayerDataManager() = default;
-    ~PlayerDataManager() = default;
+    PlayerDataManager();
+    ~PlayerDataManager();
 
     bool LoadOrCreate(const std::string& filePath,
                       const entities::CharacterManager& characterManager,
                       const entities::ItemPassiveManager& itemPassiveManager,
                       const entities::StageManager& stageManager);
 
+    /// @brief 現在の状態を保存予約（UIスレッドではディスクI/Oを待たない）
+    /// @return 予約できたか（Emscripten では同期書き込みの結果）。書き込み自体の失敗は HasSaveError で確認する
     bool Save() const;
 
+    /// @brief 予約済みの保存が書き終わるまで待つ（終了時など）
+    /// @return 最後の書き込み結果
+    bool FlushSave() const;
+
+    /// @brief 直近の保存書き込みが失敗したか（待たずに参照できる。次の成功で解除）
+    bool HasSaveError() const;
+
+    /// @brief false にすると Save() もロード時の補完保存もディスクへ書かない（ヘッドレス実行用）
+    void SetSaveWritesEnabled(bool enabled) { saveWritesEnabled_ = enabled; }
+
     /// @brief 現在の保存データを SharedContext に反映（主に formation）
     void ApplyToSharedContext(SharedContext& ctx) const;
 
     /// @brief SharedContextのformationを保存データへ反映
     void SetFormationFromSharedContext(const FormationData& formation);
 
-    /// @brief キャラ状態を取得（存在しない場合はデフォルトを返す）
-    CharacterState GetCharacterState(const std::string& characterId) const;
+    /// @brief キャラ状態を参照で取得（存在しない場合は共有のデフォルトを返す）
+    ///
+    /// 保存データにあるキャラの参照は SetCharacterState() 後も同じキャラの最新状態を指します（再ロードまで有効）。
+    /// 保存データに無い ID では共有の既定値（常に初期状態）を返し、後から SetCharacterState() しても
+    /// その参照には反映されません。追加後は取り直してください。
+    const CharacterState& GetCharacterState(const std::string& characterId) const;
 
     /// @brief キャラ状態を上書き（存在しない場合は作成）
     void SetCharacterState(const std::string& characterId, const CharacterState& state);
@@ -152,7 +174,10 @@ public:
     PlayerSaveData::TowerEnhancementState GetTowerEnhancements() const { return data_.towerEnhancements; }
 
     /// @brief タワー強化状態を上書き
-    void SetTowerEnhancements(const PlayerSaveData::TowerEnhancementState& st) { data_.towerEnhancements = st; }
+    void SetTowerEnhancements(const PlayerSaveData::TowerEnhancementState& st) {
+        data_.towerEnhancements = st;
+        towerRevision_ = ++revision_;
+    }
 
     /// @brief タワーアタッチメント状態を取得
     std::array<PlayerSaveData::TowerAttachmentSlot, 3> GetTowerAttachments() const { return data_.towerAttachments; }
@@ -160,11 +185,39 @@ public:
     /// @brief タワーアタッチメント状態を上書き
     void SetTowerAttachments(const std::array<PlayerSaveData::TowerAttachmentSlot, 3>& slots) {
         data_.towerAttachments = slots;
+        towerRevision_ = ++revision_;
     }
 
+    // ===== 変更リビジョン（派生値キャッシュの無効化判定用） =====
+    // ステータスに影響する変更（キャラ状態・タワー強化/アタッチメント・再ロード）で単調増加します。
+
+    uint64_t GetRevision() const { return revision_; }
+
+    /// @brief キャラ状態が最後に変わったリビジョン
+    uint64_t GetCharacterRevision(const std::string& characterId) const {
+        auto it = characterRevisions_.find(characterId);
+        return (it != characterRevisions_.end()) ? std::max(baseRevision_, it->second) : baseRevision_;
+    }
+
+    /// @brief タワー強化/アタッチメントが最後に変わったリビジョン
+    uint64_t GetTowerRevision() const { return std::max(baseRevision_, towerRevision_); }
+
 private:
     std::string filePath_ = "data/saves/player_save.json";
     PlayerSaveData data_{};
+    mutable std::unique_ptr<SaveWriter> saveWriter_;  // 初回 Save() で生成
+    mutable bool lastSyncSaveFailed_ = false;         // 同期書き込み（ロード時 / Emscripten）の結果
+    bool saveWritesEnabled_ = true;
+
+    uint64_t revision_ = 1;
+    uint64_t baseRevision_ = 1;  // 全体が置き換わった（ロードした）リビジョン
+    uint64_t towerRevision_ = 1;
+    std::unordered_map<std::string, uint64_t> characterRevisions_;
+
+    /// @brief data を直列化して path へ書き込む（ワーカースレッドから呼ばれる）
+    static bool WriteSaveFile(const PlayerSaveData& data, const std::string& path);
+    /// @brief 呼び出したスレッドでそのまま書き込む（初期化中の保存は順序どおり完了させる）
+    bool SaveSync() const;
 
     void EnsureDefaultsFromMasters(const entities::CharacterManager& characterManager,
                                   const entities::ItemPassiveManager& itemPassiveManager);
@@ -0,0 +1,179 @@
+#include "Profiler.hpp"
+
+// 標準ライブラリ
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace game {
+namespace core {
+
+namespace {
+
+constexpr double AVERAGE_WEIGHT = 0.1;
+
+void WriteJsonString(std::ofstream& out, const char* text) {
+    out << '"';
+    for (const char* p = text ? text : ""; *p; ++p) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+Profiler& Profiler::Instance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler()
+    : enabled_(true), epochNs_(NowNs()), frameStartNs_(0), lastFrameStartNs_(0),
+      lastFrameMs_(0.0), frameCount_(0), frameHistoryCount_(0), frameHistoryOffset_(0) {
+    frameStartNs_ = epochNs_;
+    lastFrameSamples_.reserve(1024);
+}
+
+int64_t Profiler::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint32_t& Profiler::ThreadDepth() {
+    thread_local uint32_t depth = 0;
+    return depth;
+}
+
+Profiler::ThreadBuffer& Profiler::LocalBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        auto created = std::make_unique<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(buffersMutex_);
+        created->threadIndex = static_cast<uint32_t>(buffers_.size());
+        buffer = created.get();
+        buffers_.push_back(std::move(created));
+    }
+    return *buffer;
+}
+
+void Profiler::Record(const char* name, int64_t startNs, int64_t endNs, uint32_t depth) {
+    if (!IsEnabled()) {
+        return;
+    }
+    ThreadBuffer& buffer = LocalBuffer();
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    ProfileSample& sample = buffer.samples[head & (THREAD_RING_CAPACITY - 1)];
+    sample.name = name;
+    sample.startNs = startNs;
+    sample.durationNs = endNs - startNs;
+    sample.depth = depth;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+size_t Profiler::ZoneIndex(const char* name) {
+    // 同じ名前が別TUで別アドレスのリテラルになっても1つに集計する
+    const std::string_view key(name ? name : "");
+    auto it = zoneIndexByName_.find(key);
+    if (it != zoneIndexByName_.end()) {
+        return it->second;
+    }
+    const size_t index = zones_.size();
+    ZoneStats stats;
+    stats.name = name;
+    zones_.push_back(stats);
+    zoneFrameMs_.push_back(0.0);
+    zoneFrameCalls_.push_back(0);
+    zoneIndexByName_.emplace(key, index);
+    return index;
+}
+
+void Profiler::EndFrame() {
+    const int64_t now = NowNs();
+    ThreadBuffer& mainBuffer = LocalBuffer();
+
+    std::fill(zoneFrameMs_.begin(), zoneFrameMs_.end(), 0.0);
+    std::fill(zoneFrameCalls_.begin(), zoneFrameCalls_.end(), 0u);
+    lastFrameSamples_.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex_);
+        for (auto& buffer : buffers_) {
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t cursor = buffer->readCursor;
+            if (head - cursor > THREAD_RING_CAPACITY) {
+                cursor = head - THREAD_RING_CAPACITY;  // 読み切れなかった分は捨てる
+            }
+            for (; cursor < head; ++cursor) {
+                const ProfileSample& sample = buffer->samples[cursor & (THREAD_RING_CAPACITY - 1)];
+                const size_t index = ZoneIndex(sample.name);
+                zoneFrameMs_[index] += static_cast<double>(sample.durationNs) / 1.0e6;
+                ++zoneFrameCalls_[index];
+                if (buffer.get() == &mainBuffer && sample.startNs >= frameStartNs_) {
+                    lastFrameSamples_.push_back(sample);
+                }
+            }
+            buffer->readCursor = head;
+        }
+    }
+
+    // 最大値は履歴1周ごとに取り直す
+    const bool resetMax = (frameCount_ % FRAME_HISTORY) == 0;
+    for (size_t i = 0; i < zones_.size(); ++i) {
+        ZoneStats& zone = zones_[i];
+        zone.lastMs = zoneFrameMs_[i];
+        zone.calls = zoneFrameCalls_[i];
+        zone.avgMs = (frameCount_ == 0) ? zone.lastMs
+                                        : zone.avgMs + (zone.lastMs - zone.avgMs) * AVERAGE_WEIGHT;
+        zone.maxMs = resetMax ? zone.lastMs : std::max(zone.maxMs, zone.lastMs);
+    }
+
+    lastFrameStartNs_ = frameStartNs_;
+    lastFrameMs_ = static_cast<double>(now - frameStartNs_) / 1.0e6;
+    frameHistory_[frameHistoryOffset_] = static_cast<float>(lastFrameMs_);
+    frameHistoryOffset_ = (frameHistoryOffset_ + 1) % FRAME_HISTORY;
+    frameHistoryCount_ = std::min(frameHistoryCount_ + 1, FRAME_HISTORY);
+
+    frameStartNs_ = now;
+    ++frameCount_;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::lock_guard<std::mutex> lock(buffersMutex_);
+    for (const auto& buffer : buffers_) {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        const uint64_t begin = (head > THREAD_RING_CAPACITY) ? head - THREAD_RING_CAPACITY : 0;
+        for (uint64_t i = begin; i < head; ++i) {
+            const ProfileSample& sample = buffer->samples[i & (THREAD_RING_CAPACITY - 1)];
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            WriteJsonString(out, sample.name);
+            // Trace Event の時刻はマイクロ秒
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                << ",\"ts\":" << static_cast<double>(sample.startNs - epochNs_) / 1000.0
+                << ",\"dur\":" << static_cast<double>(sample.durationNs) / 1000.0 << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace core
+} // namespace game
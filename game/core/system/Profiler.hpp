@@ -0,0 +1,153 @@
+#pragma once
+
+// 標準ライブラリ
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// GAME_ENABLE_PROFILER 未指定時は Debug ビルドのみ計測する（Release では PROFILE_* が空になる）
+#ifndef GAME_ENABLE_PROFILER
+#if defined(NDEBUG)
+#define GAME_ENABLE_PROFILER 0
+#else
+#define GAME_ENABLE_PROFILER 1
+#endif
+#endif
+
+namespace game {
+namespace core {
+
+/// @brief 計測区間1回分（name は文字列リテラルを指す）
+struct ProfileSample {
+    const char* name = nullptr;
+    int64_t startNs = 0;
+    int64_t durationNs = 0;
+    uint32_t depth = 0;
+};
+
+/// @brief スコープ計測の集計器（スレッド毎のリングバッファに記録し、フレーム末に集計）
+///
+/// 記録はスレッドローカルなリングへの書き込みのみで、ロックも確保も行いません。
+/// EndFrame() を呼ぶスレッド（メインループ）がフレーム毎に全スレッドのリングを読み、
+/// ゾーン別の統計・フレーム時間履歴・直近フレームのサンプル列（フレームグラフ用）を更新します。
+/// リングに残っている範囲は ExportChromeTrace() で chrome://tracing 形式に書き出せます。
+class Profiler {
+public:
+    static constexpr size_t THREAD_RING_CAPACITY = 8192;  // 2の冪
+    static constexpr size_t FRAME_HISTORY = 240;
+
+    struct ZoneStats {
+        const char* name = nullptr;
+        double lastMs = 0.0;  // 直近フレームの合計
+        double avgMs = 0.0;   // 指数移動平均
+        double maxMs = 0.0;   // 直近 FRAME_HISTORY フレームの最大
+        uint32_t calls = 0;   // 直近フレームの呼び出し回数
+    };
+
+    static Profiler& Instance();
+
+    /// @brief 計測の一時停止/再開（停止中も PROFILE_SCOPE のコストは時刻取得のみ）
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// @brief 現在スレッドのリングに区間を記録
+    void Record(const char* name, int64_t startNs, int64_t endNs, uint32_t depth);
+
+    /// @brief フレーム境界（メインループから1フレーム1回呼ぶ）
+    void EndFrame();
+
+    const std::vector<ZoneStats>& GetZoneStats() const { return zones_; }
+    /// @brief 直近フレームで EndFrame 呼び出しスレッドが記録したサンプル（開始時刻順ではない）
+    const std::vector<ProfileSample>& GetLastFrameSamples() const { return lastFrameSamples_; }
+    int64_t GetLastFrameStartNs() const { return lastFrameStartNs_; }
+    double GetLastFrameMs() const { return lastFrameMs_; }
+
+    /// @brief フレーム時間履歴（ms）のリング。GetFrameHistoryOffset() の位置が最古
+    const std::array<float, FRAME_HISTORY>& GetFrameHistory() const { return frameHistory_; }
+    size_t GetFrameHistoryCount() const { return frameHistoryCount_; }
+    size_t GetFrameHistoryOffset() const { return frameHistoryOffset_; }
+
+    /// @brief リングに残っている全スレッドの区間を Chrome Trace Event 形式で書き出す
+    bool ExportChromeTrace(const std::string& path) const;
+
+    static int64_t NowNs();
+
+    /// @brief 現在スレッドのネスト深さ（ProfileScope 用）
+    static uint32_t& ThreadDepth();
+
+private:
+    struct ThreadBuffer {
+        std::array<ProfileSample, THREAD_RING_CAPACITY> samples;
+        std::atomic<uint64_t> head{0};
+        uint64_t readCursor = 0;  // EndFrame 側の読み出し位置
+        uint32_t threadIndex = 0;
+    };
+
+    Profiler();
+
+    ThreadBuffer& LocalBuffer();
+    size_t ZoneIndex(const char* name);
+
+    std::atomic<bool> enabled_;
+    int64_t epochNs_;
+
+    mutable std::mutex buffersMutex_;  // 登録時と集計/書き出し時のみ
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+    std::vector<ZoneStats> zones_;
+    std::vector<double> zoneFrameMs_;
+    std::vector<uint32_t> zoneFrameCalls_;
+    std::unordered_map<std::string_view, size_t> zoneIndexByName_;
+
+    std::vector<ProfileSample> lastFrameSamples_;
+    int64_t frameStartNs_;
+    int64_t lastFrameStartNs_;
+    double lastFrameMs_;
+    uint64_t frameCount_;
+
+    std::array<float, FRAME_HISTORY> frameHistory_{};
+    size_t frameHistoryCount_;
+    size_t frameHistoryOffset_;
+};
+
+/// @brief スコープの開始〜終了を Profiler に記録する RAII タイマー
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : name_(name), startNs_(Profiler::NowNs()), depth_(Profiler::ThreadDepth()++) {}
+    ~ProfileScope() {
+        --Profiler::ThreadDepth();
+        Profiler::Instance().Record(name_, startNs_, Profiler::NowNs(), depth_);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+    int64_t startNs_;
+    uint32_t depth_;
+};
+
+} // namespace core
+} // namespace game
+
+#if GAME_ENABLE_PROFILER
+#define GAME_PROFILE_CONCAT_INNER(a, b) a##b
+#define GAME_PROFILE_CONCAT(a, b) GAME_PROFILE_CONCAT_INNER(a, b)
+/// @brief 現在のスコープを name（文字列リテラル）として計測
+#define PROFILE_SCOPE(name) \
+    ::game::core::ProfileScope GAME_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+/// @brief フレーム境界（メインループ末尾）
+#define PROFILE_FRAME_END() ::game::core::Profiler::Instance().EndFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
@@ -0,0 +1,88 @@
+#include "RosterView.hpp"
+
+namespace game {
+namespace core {
+
+void RosterView::Refresh(const entities::CharacterManager& characterManager,
+                         const PlayerDataManager& playerDataManager) {
+    const entities::BattleTemplateTable& templates = characterManager.GetBattleTemplates();
+    const bool mastersChanged = templates_ != &templates ||
+                                builtMastersRevision_ != mastersRevision_ ||
+                                entries_.size() != templates.Size();
+
+    if (mastersChanged) {
+        templates_ = &templates;
+        entries_.assign(templates.Size(), Entry{});
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            const entities::Character* character = templates.Get(static_cast<int>(i)).source;
+            Entry& entry = entries_[i];
+            entry.character = character;
+            entry.rarity = character ? character->rarity : 0;
+            entry.cost = character ? character->cost : 0;
+        }
+
+        // 名前の順位（std::string の比較順。同名は同順位）
+        std::vector<size_t> order(entries_.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        auto nameOf = [this](size_t index) -> const std::string& {
+            static const std::string empty;
+            const entities::Character* character = entries_[index].character;
+            return character ? character->name : empty;
+        };
+        std::sort(order.begin(), order.end(),
+                  [&nameOf](size_t lhs, size_t rhs) { return nameOf(lhs) < nameOf(rhs); });
+        int rank = 0;
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (i > 0 && nameOf(order[i - 1]) < nameOf(order[i])) {
+                ++rank;
+            }
+            entries_[order[i]].nameRank = rank;
+        }
+
+        builtMastersRevision_ = mastersRevision_;
+        saveRevision_ = 0;
+    }
+
+    const uint64_t saveRevision = playerDataManager.GetRevision();
+    if (saveRevision_ == saveRevision) {
+        return;
+    }
+    for (Entry& entry : entries_) {
+        if (!entry.character) {
+            continue;
+        }
+        const auto& state = playerDataManager.GetCharacterState(entry.character->id);
+        entry.level = state.level;
+        entry.unlocked = state.unlocked;
+    }
+    saveRevision_ = saveRevision;
+}
+
+void RosterView::Clear() {
+    entries_.clear();
+    sortScratch_.clear();
+    templates_ = nullptr;
+    saveRevision_ = 0;
+    ++mastersRevision_;
+}
+
+int RosterView::FindIndex(const std::string& characterId) const {
+    if (!templates_) {
+        return INVALID_INDEX;
+    }
+    const int index = templates_->FindIndex(characterId);
+    if (index < 0 || static_cast<size_t>(index) >= entries_.size()) {
+        return INVALID_INDEX;
+    }
+    return index;
+}
+
+const RosterView::Entry* RosterView::Find(const std::string& characterId) const {
+    const int index = FindIndex(characterId);
+    return (index != INVALID_INDEX) ? &entries_[static_cast<size_t>(index)] : nullptr;
+}
+
+} // namespace core
+} // namespace game
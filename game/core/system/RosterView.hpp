@@ -0,0 +1,91 @@
+#pragma once
+
+// 標準ライブラリ
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// プロジェクト内
+#include "../ecs/entities/CharacterManager.hpp"
+#include "PlayerDataManager.hpp"
+
+namespace game {
+namespace core {
+
+/// @brief 編成/強化画面のキャラ一覧向けソートキーの表
+///
+/// BattleTemplateTable と同じ密な添字でキャラごとのキー（Lv・所持・レアリティ・コスト・名前順位）を保持し、
+/// セーブ（PlayerDataManager::GetRevision）かマスターが変わったときだけ作り直します。
+/// 比較は整数だけで済むため、ソート中に文字列比較やセーブの参照が発生しません。
+class RosterView {
+public:
+    static constexpr int INVALID_INDEX = -1;
+
+    struct Entry {
+        const entities::Character* character = nullptr;
+        int level = 1;
+        int rarity = 0;
+        int cost = 0;
+        int nameRank = 0;  // 名前の辞書順の順位（同名は同順位）
+        bool unlocked = false;
+    };
+
+    /// @brief 必要なら作り直す（変更がなければ何もしない）
+    void Refresh(const entities::CharacterManager& characterManager,
+                 const PlayerDataManager& playerDataManager);
+
+    /// @brief マスター（キャラ）の更新時に呼ぶ
+    void InvalidateMasters() { ++mastersRevision_; }
+
+    void Clear();
+
+    int FindIndex(const std::string& characterId) const;
+    const Entry* Find(const std::string& characterId) const;
+    const Entry& Get(int index) const { return entries_[static_cast<size_t>(index)]; }
+    const std::vector<Entry>& GetAll() const { return entries_; }
+    size_t Size() const { return entries_.size(); }
+
+    /// @brief キャラ一覧を Entry 同士の比較で並べ替える
+    ///
+    /// 各要素の Entry は1度だけ引き、比較中は参照しません。一覧に無いキャラは末尾に残ります。
+    /// @param less bool(const Entry&, const Entry&)
+    template<typename Less>
+    void Sort(std::vector<const entities::Character*>& characters, Less&& less) const;
+
+private:
+    std::vector<Entry> entries_;
+    mutable std::vector<std::pair<const Entry*, const entities::Character*>> sortScratch_;
+    const entities::BattleTemplateTable* templates_ = nullptr;
+    uint64_t saveRevision_ = 0;
+    uint64_t builtMastersRevision_ = 0;
+    uint64_t mastersRevision_ = 1;
+};
+
+// ========== テンプレート実装 ==========
+
+template<typename Less>
+inline void RosterView::Sort(std::vector<const entities::Character*>& characters,
+                             Less&& less) const {
+    auto& decorated = sortScratch_;
+    decorated.clear();
+    decorated.reserve(characters.size());
+    for (const entities::Character* character : characters) {
+        decorated.emplace_back(character ? Find(character->id) : nullptr, character);
+    }
+
+    std::sort(decorated.begin(), decorated.end(), [&less](const auto& lhs, const auto& rhs) {
+        if (!lhs.first || !rhs.first) {
+            return lhs.first != nullptr && rhs.first == nullptr;
+        }
+        return less(*lhs.first, *rhs.first);
+    });
+
+    for (size_t i = 0; i < decorated.size(); ++i) {
+        characters[i] = decorated[i].second;
+    }
+}
+
+} // namespace core
+} // namespace game
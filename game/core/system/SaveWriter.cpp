@@ -0,0 +1,109 @@
+#include "SaveWriter.hpp"
+
+// 標準ライブラリ
+#include <utility>
+
+namespace game {
+namespace core {
+
+SaveWriter::SaveWriter(std::chrono::milliseconds coalesceWindow)
+    : coalesceWindow_(coalesceWindow) {
+    worker_ = std::thread([this]() { WorkerLoop(); });
+}
+
+SaveWriter::~SaveWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopRequested_ = true;
+    }
+    wakeCondition_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool SaveWriter::Request(Job job) {
+    if (!job) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopRequested_) {
+            return false;
+        }
+        ++stats_.requested;
+        if (pending_) {
+            ++stats_.coalesced;
+        } else {
+            // 最初の要求から窓を測る（連打されても書き込みが無限に遅れない）
+            deadline_ = std::chrono::steady_clock::now() + coalesceWindow_;
+        }
+        pending_ = std::move(job);
+    }
+    wakeCondition_.notify_all();
+    return true;
+}
+
+bool SaveWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!pending_ && !writing_) {
+        return lastResult_;
+    }
+    flushRequested_ = true;
+    wakeCondition_.notify_all();
+    idleCondition_.wait(lock, [this]() { return !pending_ && !writing_; });
+    return lastResult_;
+}
+
+bool SaveWriter::HasError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !lastResult_;
+}
+
+SaveWriter::Stats SaveWriter::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void SaveWriter::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wakeCondition_.wait(lock, [this]() { return stopRequested_ || pending_; });
+        if (!pending_) {
+            break;  // 停止要求かつ保留なし
+        }
+
+        // 窓が閉じるまで後続の要求を待つ（Flush/停止時は即実行）
+        while (pending_ && !stopRequested_ && !flushRequested_ &&
+               std::chrono::steady_clock::now() < deadline_) {
+            wakeCondition_.wait_until(lock, deadline_);
+        }
+
+        Job job = std::move(pending_);
+        pending_ = nullptr;
+        writing_ = true;
+        lock.unlock();
+
+        bool ok = false;
+        try {
+            ok = job();
+        } catch (...) {
+            ok = false;
+        }
+
+        lock.lock();
+        writing_ = false;
+        lastResult_ = ok;
+        ++stats_.written;
+        if (!ok) {
+            ++stats_.failed;
+        }
+        if (!pending_) {
+            flushRequested_ = false;
+            idleCondition_.notify_all();
+        }
+    }
+}
+
+} // namespace core
+} // namespace game
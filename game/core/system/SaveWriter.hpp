@@ -0,0 +1,69 @@
+#pragma once
+
+// 標準ライブラリ
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace game {
+namespace core {
+
+/// @brief 保存ジョブをバックグラウンドスレッドでまとめて実行するライター
+///
+/// Request() は待たずに戻り、最初の要求から coalesceWindow の間に来た要求は
+/// 最新の1件だけが実行されます（スナップショットはジョブ側が値で保持する）。
+/// Flush() は保留中・実行中のジョブが終わるまで待ちます。デストラクタも Flush します。
+class SaveWriter {
+public:
+    using Job = std::function<bool()>;
+
+    struct Stats {
+        uint64_t requested = 0;
+        uint64_t written = 0;
+        uint64_t coalesced = 0;  // 後続の要求に置き換えられて実行されなかった数
+        uint64_t failed = 0;     // ジョブが false を返した（または例外を投げた）数
+    };
+
+    explicit SaveWriter(std::chrono::milliseconds coalesceWindow);
+    ~SaveWriter();
+
+    SaveWriter(const SaveWriter&) = delete;
+    SaveWriter& operator=(const SaveWriter&) = delete;
+
+    /// @brief ジョブを予約（保留中のジョブがあれば置き換える）
+    /// @return 予約できたか（空のジョブや停止処理中は false）
+    bool Request(Job job);
+
+    /// @brief 保留中・実行中のジョブの完了を待つ
+    /// @return 最後に実行したジョブの結果（何も実行していなければ true）
+    bool Flush();
+
+    /// @brief 最後に実行したジョブが失敗したか（待たずに参照できる）
+    bool HasError() const;
+
+    Stats GetStats() const;
+
+private:
+    void WorkerLoop();
+
+    std::chrono::milliseconds coalesceWindow_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable idleCondition_;
+    Job pending_;
+    std::chrono::steady_clock::time_point deadline_;
+    bool writing_ = false;
+    bool flushRequested_ = false;
+    bool stopRequested_ = false;
+    bool lastResult_ = true;
+    Stats stats_;
+
+    std::thread worker_;
+};
+
+} // namespace core
+} // namespace game
@@ -31,7 +31,30 @@ constexpr int SLOT_COUNT = 10;
 } // namespace
 
 BattleHUDRenderer::BattleHUDRenderer(BaseSystemAPI* sysAPI)
-    : sysAPI_(sysAPI) {
+    : sysAPI_(sysAPI), slots_(SLOT_COUNT) {
+}
+
+void BattleHUDRenderer::SetFormation(const FormationData& formation,
+                                     const GameplayDataAPI* gameplayDataAPI) {
+    slots_.assign(SLOT_COUNT, FormationSlot{});
+    for (const auto& [idx, unitId] : formation.slots) {
+        if (idx < 0 || idx >= SLOT_COUNT || unitId.empty()) {
+            continue;
+        }
+        FormationSlot& slot = slots_[idx];
+        slot.unitId = unitId;
+        if (gameplayDataAPI) {
+            const auto& templates = gameplayDataAPI->GetBattleTemplates();
+            slot.templateIndex = templates.FindIndex(unitId);
+            if (slot.templateIndex >= 0) {
+                slot.unlocked = gameplayDataAPI->GetCharacterState(unitId).unlocked;
+                const std::string& iconPath = templates.Get(slot.templateIndex).source->icon_path;
+                if (sysAPI_ && !iconPath.empty()) {
+                    slot.iconHandle = sysAPI_->Resource().ResolveTextureHandle(iconPath);
+                }
+            }
+        }
+    }
 }
 
 void BattleHUDRenderer::Render(const SharedContext& ctx,
@@ -69,14 +92,15 @@ BattleHUDAction BattleHUDRenderer::HandleClick(const SharedContext& ctx,
     }
 
     for (const auto& slot : unitSlotButtons_) {
+        const std::string& unitId = slots_[slot.slot].unitId;
         // 出撁E�Eタンは廁E��し、スロチE��全体をタチE�Eで出撁E
-        if (!slot.unitId.empty() && IsMouseInRect(mousePos, slot.slotRect)) {
+        if (!unitId.empty() && IsMouseInRect(mousePos, slot.slotRect)) {
             if (!slot.isEnabled) {
                 return BattleHUDAction{};
             }
 
             // クールダウン
-            auto it = cooldownUntil.find(slot.unitId);
+            auto it = cooldownUntil.find(unitId);
             if (it != cooldownUntil.end() && currentTime < it->second) {
                 return BattleHUDAction{};
             }
@@ -88,7 +112,7 @@ BattleHUDAction BattleHUDRenderer::HandleClick(const SharedContext& ctx,
 
             BattleHUDAction action;
             action.type = BattleHUDActionType::SpawnUnit;
-            action.unitId = slot.unitId;
+            action.unitId = unitId;
             return action;
         }
     }
@@ -223,16 +247,9 @@ void BattleHUDRenderer::RenderBottomBar(const SharedContext& ctx,
     const float startX = (SCREEN_W - totalW) * 0.5f;
     const float startY = y0 + (BOTTOM_H - totalH) * 0.5f;
 
-    // 編戁E0枠めEunitId の配�Eに展開
-    std::vector<std::string> slotUnitIds(SLOT_COUNT, "");
-    if (!ctx.formationData.IsEmpty()) {
-        for (const auto& slot : ctx.formationData.slots) {
-            const int idx = slot.first;
-            if (idx >= 0 && idx < SLOT_COUNT) {
-                slotUnitIds[idx] = slot.second;
-            }
-        }
-    }
+    static const std::string kEmptyLabel = "Empty";
+    const entities::BattleTemplateTable* templates =
+        ctx.gameplayDataAPI ? &ctx.gameplayDataAPI->GetBattleTemplates() : nullptr;
 
     for (int i = 0; i < SLOT_COUNT; ++i) {
         const int col = i % SLOT_COLS;
@@ -244,27 +261,22 @@ void BattleHUDRenderer::RenderBottomBar(const SharedContext& ctx,
             SLOT_H
         };
 
-        const std::string unitId = slotUnitIds[i];
+        const FormationSlot& formationSlot = slots_[i];
+        const std::string& unitId = formationSlot.unitId;
         const bool hasUnit = !unitId.empty();
 
         int costGold = 0;
         bool enabled = false;
-        std::string displayName = hasUnit ? unitId : "Empty";
-        std::string iconPath;
-
-        bool is_unlocked = true;
-        if (hasUnit && ctx.gameplayDataAPI) {
-            auto ch = ctx.gameplayDataAPI->GetCharacterTemplate(unitId);
-            if (ch) {
-                // 未所持チェック
-                const auto st = ctx.gameplayDataAPI->GetCharacterState(unitId);
-                is_unlocked = st.unlocked;
-                
-                displayName = ch->name;
-                costGold = ch->cost;
-                enabled = true;
-                iconPath = ch->icon_path;
-            }
+        // SetFormation で解決済みの添字でテンプレート表を引き、文字列はマスターを参照する
+        const std::string* displayName = hasUnit ? &unitId : &kEmptyLabel;
+
+        const bool is_unlocked = formationSlot.unlocked;
+        if (hasUnit && templates && formationSlot.templateIndex >= 0 &&
+            static_cast<size_t>(formationSlot.templateIndex) < templates->Size()) {
+            const auto& tmpl = templates->Get(formationSlot.templateIndex);
+            displayName = &tmpl.source->name;
+            costGold = tmpl.cost;
+            enabled = true;
         }
 
         // クールダウン中は無効
@@ -285,20 +297,21 @@ void BattleHUDRenderer::RenderBottomBar(const SharedContext& ctx,
                               : ToCoreColor(OverlayColors::PANEL_BG_PRIMARY));
 
         // portraitを薄く背景に敷く（誰が誰か判別しやすくする�E�E
-        if (hasUnit && !iconPath.empty()) {
-            void* texturePtr = sysAPI_->Resource().GetTexture(iconPath);
-            if (texturePtr) {
-                Texture2D* texture = static_cast<Texture2D*>(texturePtr);
-                if (texture && texture->id != 0) {
-                    Rect src{0.0f, 0.0f, static_cast<float>(texture->width),
-                             static_cast<float>(texture->height)};
+        if (hasUnit && formationSlot.iconHandle != INVALID_TEXTURE_HANDLE) {
+            // アイコンはアトラス収録済みなので部分矩形で描く（単体テクスチャを別に読まない）
+            const TextureRegion region =
+                sysAPI_->Resource().GetTextureRegionByHandle(formationSlot.iconHandle);
+            if (region.texture) {
+                Texture2D* texture = region.texture;
+                if (texture->id != 0 && region.rect.width > 0.0f && region.rect.height > 0.0f) {
+                    Rect src{region.rect.x, region.rect.y, region.rect.width, region.rect.height};
                     const float pad = 6.0f;
                     const float maxW = std::max(0.0f, slotRect.width - pad * 2.0f);
                     const float maxH = std::max(0.0f, slotRect.height - pad * 2.0f);
-                    const float scale = std::min(maxW / static_cast<float>(texture->width),
-                                                 maxH / static_cast<float>(texture->height));
-                    const float drawW = static_cast<float>(texture->width) * scale;
-                    const float drawH = static_cast<float>(texture->height) * scale;
+                    const float scale = std::min(maxW / region.rect.width,
+                                                 maxH / region.rect.height);
+                    const float drawW = region.rect.width * scale;
+                    const float drawH = region.rect.height * scale;
                     Rect dst{
                         slotRect.x + (slotRect.width - drawW) * 0.5f,
                         slotRect.y + (slotRect.height - drawH) * 0.5f,
@@ -324,7 +337,7 @@ void BattleHUDRenderer::RenderBottomBar(const SharedContext& ctx,
         // 表示（未所持の場合は名前とコストを非表示）
         if (hasUnit && is_unlocked) {
             sysAPI_->Render().DrawTextDefault(
-                displayName, static_cast<int>(slotRect.x + 10),
+                *displayName, static_cast<int>(slotRect.x + 10),
                 static_cast<int>(slotRect.y + 8), 32.0f,  // 20.0f → 32.0f（大きく）
                 ToCoreColor(OverlayColors::TEXT_PRIMARY));
             std::ostringstream cs;
@@ -343,7 +356,7 @@ void BattleHUDRenderer::RenderBottomBar(const SharedContext& ctx,
 
         UnitSlotButton slotBtn;
         slotBtn.slotRect = slotRect;
-        slotBtn.unitId = unitId;
+        slotBtn.slot = i;
         slotBtn.costGold = costGold;
         slotBtn.isEnabled = enabled;
         unitSlotButtons_.push_back(slotBtn);
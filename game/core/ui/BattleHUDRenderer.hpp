@@ -45,6 +45,10 @@ public:
                 const std::unordered_map<std::string, float>& cooldownUntil,
                 bool isInfiniteStage = false);
 
+    /// @brief 編成の各枠をテンプレート表の添字に解決して保持（戦闘開始時など編成が確定した時に呼ぶ）
+    /// @details 描画・クリック判定では毎フレーム文字列でマスターを引かず、この添字を使います。
+    void SetFormation(const FormationData& formation, const GameplayDataAPI* gameplayDataAPI);
+
     /// @brief ??????E???HUD???????????????
     BattleHUDAction HandleClick(const SharedContext& ctx,
                                 Vec2 mousePos,
@@ -62,13 +66,22 @@ private:
 
     struct UnitSlotButton {
         Rect slotRect{};
-        std::string unitId;
+        int slot = -1;  // slots_ の添字
         int costGold = 0;
         bool isEnabled = false;
     };
 
+    /// @brief SetFormation で解決済みの1枠
+    struct FormationSlot {
+        std::string unitId;
+        int templateIndex = -1;  // BattleTemplateTable の添字（未登録は -1）
+        TextureHandle iconHandle = INVALID_TEXTURE_HANDLE;  // portrait（描画時に文字列キーを引かない）
+        bool unlocked = true;
+    };
+
     std::vector<RectButton> topButtons_;
     std::vector<UnitSlotButton> unitSlotButtons_;
+    std::vector<FormationSlot> slots_;
 
     void RenderTopBar(int playerHp, int playerMaxHp,
                       int enemyHp, int enemyMaxHp,
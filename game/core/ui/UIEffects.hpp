@@ -3,6 +3,7 @@
 #include "../config/RenderTypes.hpp"
 #include "OverlayColors.hpp"
 #include "../api/BaseSystemAPI.hpp"
+#include "../game/ParticlePool.hpp"
 #include <cmath>
 
 namespace game {
@@ -178,24 +179,41 @@ inline float CalculatePulseAlpha(float time, float period = 1.5f, float min_alph
 }
 
 // ============================================================================
-// 粒子エフェクト描画E背景裁E用EE
+// 背景の浮遊粒子（装飾用）
 // ============================================================================
-inline void DrawParticles(BaseSystemAPI* api, float time, float area_x, float area_y, float area_w, float area_h, int count = 15) {
-    if (!api) return;
+/// @brief pool の生存数が count になるまで領域内に粒子を補充し、deltaTime 秒進める
+inline void UpdateAmbientParticles(::game::core::game::ParticlePool& pool, float deltaTime,
+                                   float area_x, float area_y, float area_w, float area_h,
+                                   int count = 15) {
     using namespace OverlayColors;
-    
-    // 簡易的な粒子描画E実際の実裁Eはより高度なパEチEクルシスチEを使用EE
-    for (int i = 0; i < count; ++i) {
-        float seed = static_cast<float>(i) * 123.456f;
-        float x = area_x + std::fmod(seed * 17.3f, area_w);
-        float y = area_y + std::fmod(seed * 23.7f + time * 20.0f, area_h);
-        float alpha = 10.0f + std::fmod(seed * 7.1f, 20.0f); // alpha 10-30
-        
-        Color particle_color = PARTICLE_GOLD;
-        particle_color.a = static_cast<unsigned char>(alpha);
-        
-        api->Render().DrawCircle(static_cast<int>(x), static_cast<int>(y), 2.0f, particle_color);
+    const int missing = count - static_cast<int>(pool.Alive());
+    if (missing > 0) {
+        // ゆっくり下へ流れ、数秒かけて消える（最大 alpha 30）
+        ::game::core::game::ParticleBurst burst;
+        burst.x = area_x;
+        burst.y = area_y;
+        burst.width = area_w;
+        burst.height = area_h;
+        burst.count = missing;
+        burst.angle = 1.5707964f;
+        burst.spread = 0.6f;
+        burst.speedMin = 12.0f;
+        burst.speedMax = 28.0f;
+        burst.lifeMin = 3.0f;
+        burst.lifeMax = 6.0f;
+        burst.sizeMin = 3.0f;
+        burst.sizeMax = 4.0f;
+        burst.color = PARTICLE_GOLD;
+        burst.color.a = 30;
+        pool.Emit(burst);
     }
+    pool.Update(deltaTime);
+}
+
+/// @brief pool の粒子を1回のバッチで描画
+inline void DrawParticles(BaseSystemAPI* api, const ::game::core::game::ParticlePool& pool) {
+    if (!api) return;
+    pool.Draw(api->Render());
 }
 
 } // namespace UIEffects
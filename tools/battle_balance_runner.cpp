@@ -0,0 +1,374 @@
+// 並列バランス検証ランナー
+//
+// 全ステージ（または指定ステージ）× 編成 × 強化レベルの組み合わせを
+// HeadlessBattleRunner でスレッドプール上に並列実行し、結果を CSV/JSON に集計します。
+// ワーカーごとに HeadlessBattleRunner（= 独立した entt::registry と GameplayDataAPI）を持ち、
+// 強化レベルはワーカー内のメモリ上のセーブデータにのみ適用します（ファイルには保存しません）。
+//
+// 使い方（data/ を含むディレクトリで実行、または --root で指定）:
+//   BattleBalanceRunner [--root <dir>] [--threads <n>] [--stage <id>]...
+//                       [--formations "a,b,c;d,e"] [--levels 1,10,20]
+//                       [--dt <sec>] [--max-time <sec>] [--csv <path>] [--json <path>]
+
+// 標準ライブラリ
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 外部ライブラリ
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+// プロジェクト内
+#include "core/api/GameplayDataAPI.hpp"
+#include "core/game/HeadlessBattleRunner.hpp"
+
+namespace {
+
+using namespace game::core;
+using ::game::core::game::HeadlessBattleConfig;
+using ::game::core::game::HeadlessBattleResult;
+using ::game::core::game::HeadlessBattleRunner;
+
+struct BalanceOptions {
+    std::string root;
+    int threads = 0;                                // 0 ならハードウェアスレッド数
+    std::vector<std::string> stageIds;              // 空なら全ステージ
+    std::vector<std::vector<std::string>> formations;  // 空ならセーブデータの編成のみ
+    std::vector<int> levels = {1, 10, 20};
+    float dt = 1.0f / 60.0f;
+    float maxTime = 600.0f;
+    std::string csvPath = "balance_report.csv";
+    std::string jsonPath;
+};
+
+struct BalanceJob {
+    std::string stageId;
+    size_t formationIndex = 0;
+    int level = 1;
+};
+
+std::vector<std::string> Split(const std::string& text, char delimiter) {
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, delimiter)) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+BalanceOptions ParseOptions(int argc, char** argv) {
+    BalanceOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            options.root = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--stage" && i + 1 < argc) {
+            options.stageIds.push_back(argv[++i]);
+        } else if (arg == "--formations" && i + 1 < argc) {
+            options.formations.clear();
+            for (const auto& set : Split(argv[++i], ';')) {
+                auto ids = Split(set, ',');
+                if (!ids.empty()) {
+                    options.formations.push_back(std::move(ids));
+                }
+            }
+        } else if (arg == "--levels" && i + 1 < argc) {
+            options.levels.clear();
+            for (const auto& item : Split(argv[++i], ',')) {
+                const int level = std::atoi(item.c_str());
+                if (level > 0) {
+                    options.levels.push_back(level);
+                }
+            }
+        } else if (arg == "--dt" && i + 1 < argc) {
+            const float dt = static_cast<float>(std::atof(argv[++i]));
+            if (dt > 0.0f) {
+                options.dt = dt;
+            }
+        } else if (arg == "--max-time" && i + 1 < argc) {
+            const float maxTime = static_cast<float>(std::atof(argv[++i]));
+            if (maxTime > 0.0f) {
+                options.maxTime = maxTime;
+            }
+        } else if (arg == "--csv" && i + 1 < argc) {
+            options.csvPath = argv[++i];
+        } else if (arg == "--json" && i + 1 < argc) {
+            options.jsonPath = argv[++i];
+        }
+    }
+    if (options.levels.empty()) {
+        options.levels.push_back(1);
+    }
+    return options;
+}
+
+FormationData ToFormation(const std::vector<std::string>& ids) {
+    FormationData formation;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        formation.slots.emplace_back(static_cast<int>(i), ids[i]);
+    }
+    return formation;
+}
+
+std::string FormationLabel(const FormationData& formation) {
+    std::string label;
+    for (const auto& slot : formation.slots) {
+        if (!label.empty()) {
+            label += '+';
+        }
+        label += slot.second;
+    }
+    return label;
+}
+
+/// @brief 編成ユニットの強化レベルをワーカーのメモリ上セーブデータへ適用
+void ApplyLevel(GameplayDataAPI& data, const FormationData& formation, int level) {
+    for (const auto& slot : formation.slots) {
+        auto state = data.GetCharacterState(slot.second);
+        state.unlocked = true;
+        state.level = level;
+        data.SetCharacterState(slot.second, state);
+    }
+}
+
+const char* ResultToString(const HeadlessBattleResult& r) {
+    if (r.timedOut) {
+        return "timeout";
+    }
+    switch (r.result) {
+    case BattleProgressAPI::BattleResult::Victory:
+        return "victory";
+    case BattleProgressAPI::BattleResult::Defeat:
+        return "defeat";
+    default:
+        return "in_progress";
+    }
+}
+
+bool WriteCsv(const std::string& path,
+              const std::vector<BalanceJob>& jobs,
+              const std::vector<std::string>& formationLabels,
+              const std::vector<HeadlessBattleResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "stage,formation,level,result,clear_time,player_tower_hp,player_tower_max_hp,"
+           "enemy_tower_hp,enemy_tower_max_hp,spawned_units,gold_spent,ticks,wall_ms\n";
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const auto& job = jobs[i];
+        const auto& r = results[i];
+        out << job.stageId << ',' << formationLabels[job.formationIndex] << ',' << job.level << ','
+            << ResultToString(r) << ',' << r.clearTime << ','
+            << r.playerTowerHp << ',' << r.playerTowerMaxHp << ','
+            << r.enemyTowerHp << ',' << r.enemyTowerMaxHp << ','
+            << r.spawnedUnitCount << ',' << r.totalGoldSpent << ','
+            << r.ticks << ',' << r.wallSeconds * 1000.0 << '\n';
+    }
+    return true;
+}
+
+bool WriteJson(const std::string& path,
+               const std::vector<BalanceJob>& jobs,
+               const std::vector<std::string>& formationLabels,
+               const std::vector<HeadlessBattleResult>& results) {
+    struct StageSummary {
+        int runs = 0;
+        int victories = 0;
+        double totalClearTime = 0.0;
+    };
+    std::map<std::string, StageSummary> summaries;
+
+    nlohmann::json runs = nlohmann::json::array();
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const auto& job = jobs[i];
+        const auto& r = results[i];
+        nlohmann::json j;
+        j["stageId"] = job.stageId;
+        j["formation"] = formationLabels[job.formationIndex];
+        j["level"] = job.level;
+        j["result"] = ResultToString(r);
+        j["clearTime"] = r.clearTime;
+        j["playerTowerHp"] = r.playerTowerHp;
+        j["enemyTowerHp"] = r.enemyTowerHp;
+        j["spawnedUnitCount"] = r.spawnedUnitCount;
+        j["totalGoldSpent"] = r.totalGoldSpent;
+        runs.push_back(std::move(j));
+
+        auto& summary = summaries[job.stageId];
+        summary.runs++;
+        if (!r.timedOut && r.result == BattleProgressAPI::BattleResult::Victory) {
+            summary.victories++;
+            summary.totalClearTime += r.clearTime;
+        }
+    }
+
+    nlohmann::json stages = nlohmann::json::object();
+    for (const auto& [stageId, summary] : summaries) {
+        stages[stageId] = {
+            {"runs", summary.runs},
+            {"victories", summary.victories},
+            {"winRate", summary.runs > 0 ? static_cast<double>(summary.victories) / summary.runs : 0.0},
+            {"avgClearTime", summary.victories > 0 ? summary.totalClearTime / summary.victories : 0.0},
+        };
+    }
+
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    nlohmann::json report;
+    report["stages"] = std::move(stages);
+    report["runs"] = std::move(runs);
+    out << report.dump(2) << "\n";
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const BalanceOptions options = ParseOptions(argc, argv);
+    if (!options.root.empty()) {
+        std::error_code ec;
+        std::filesystem::current_path(options.root, ec);
+        if (ec) {
+            std::fprintf(stderr, "Failed to change directory: %s\n", options.root.c_str());
+            return 1;
+        }
+    }
+
+    // ユニット生成ごとのINFOログを抑制
+    spdlog::set_level(spdlog::level::warn);
+
+    int threadCount = options.threads;
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // データ読み込み（セーブ未作成時の生成を含む）が競合しないよう、ワーカーはメインスレッドで順に初期化
+    std::vector<std::unique_ptr<HeadlessBattleRunner>> runners;
+    runners.reserve(static_cast<size_t>(threadCount));
+    for (int i = 0; i < threadCount; ++i) {
+        auto runner = std::make_unique<HeadlessBattleRunner>();
+        if (!runner->Initialize()) {
+            std::fprintf(stderr, "HeadlessBattleRunner initialization failed\n");
+            return 1;
+        }
+        runners.push_back(std::move(runner));
+    }
+
+    std::vector<std::string> stageIds = options.stageIds;
+    if (stageIds.empty()) {
+        stageIds = runners.front()->GetGameplayDataAPI()->GetAllStageIds();
+    }
+    if (stageIds.empty()) {
+        std::fprintf(stderr, "No stages found (run from the directory containing data/)\n");
+        return 1;
+    }
+
+    std::vector<FormationData> formations;
+    for (const auto& ids : options.formations) {
+        formations.push_back(ToFormation(ids));
+    }
+    if (formations.empty()) {
+        SharedContext saved;
+        runners.front()->GetGameplayDataAPI()->ApplyToSharedContext(saved);
+        if (saved.formationData.IsEmpty()) {
+            std::fprintf(stderr, "No formation specified and save data has none (use --formations)\n");
+            return 1;
+        }
+        formations.push_back(saved.formationData);
+    }
+    std::vector<std::string> formationLabels;
+    for (const auto& formation : formations) {
+        formationLabels.push_back(FormationLabel(formation));
+    }
+
+    std::vector<BalanceJob> jobs;
+    for (const auto& stageId : stageIds) {
+        for (size_t f = 0; f < formations.size(); ++f) {
+            for (int level : options.levels) {
+                jobs.push_back(BalanceJob{stageId, f, level});
+            }
+        }
+    }
+
+    std::printf("Running %zu battles (%zu stages x %zu formations x %zu levels) on %d threads\n",
+                jobs.size(), stageIds.size(), formations.size(), options.levels.size(), threadCount);
+
+    // 結果はジョブ順の固定スロットへ書き込むため、スレッド数に関わらず出力順は決定的
+    std::vector<HeadlessBattleResult> results(jobs.size());
+    std::atomic<size_t> nextJob{0};
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    workers.reserve(runners.size());
+    for (auto& runnerPtr : runners) {
+        HeadlessBattleRunner* runner = runnerPtr.get();
+        workers.emplace_back([&, runner]() {
+            GameplayDataAPI& data = *runner->GetGameplayDataAPI();
+            for (size_t index = nextJob.fetch_add(1); index < jobs.size(); index = nextJob.fetch_add(1)) {
+                const auto& job = jobs[index];
+                const auto& formation = formations[job.formationIndex];
+                ApplyLevel(data, formation, job.level);
+
+                HeadlessBattleConfig config;
+                config.stageId = job.stageId;
+                config.formation = formation;
+                config.fixedDeltaTime = options.dt;
+                config.maxBattleSeconds = options.maxTime;
+                results[index] = runner->Run(config);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const double wallSeconds = std::chrono::duration<double>(end - start).count();
+    double simSeconds = 0.0;
+    for (const auto& r : results) {
+        simSeconds += r.clearTime;
+    }
+    std::printf("Done in %.2f s (%.1f battles/min, %.1f sim s/wall s)\n",
+                wallSeconds,
+                wallSeconds > 0.0 ? static_cast<double>(jobs.size()) * 60.0 / wallSeconds : 0.0,
+                wallSeconds > 0.0 ? simSeconds / wallSeconds : 0.0);
+
+    if (!options.csvPath.empty()) {
+        if (!WriteCsv(options.csvPath, jobs, formationLabels, results)) {
+            std::fprintf(stderr, "Failed to open: %s\n", options.csvPath.c_str());
+            return 1;
+        }
+        std::printf("CSV: %s\n", options.csvPath.c_str());
+    }
+    if (!options.jsonPath.empty()) {
+        if (!WriteJson(options.jsonPath, jobs, formationLabels, results)) {
+            std::fprintf(stderr, "Failed to open: %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+        std::printf("JSON: %s\n", options.jsonPath.c_str());
+    }
+
+    for (auto& runner : runners) {
+        runner->Shutdown();
+    }
+    return 0;
+}
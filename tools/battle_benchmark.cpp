@@ -0,0 +1,174 @@
+// 戦闘更新ベンチマーク
+//
+// ウィンドウを開かずに ECSystemAPI + BattleProgressAPI を構築し、
+// 指定数のユニットをレーン上に並べて BattleProgressAPI::Update の1フレーム時間を計測します。
+//
+// 使い方（data/ を含むディレクトリで実行、または --root で指定）:
+//   BattleBenchmark [--root <dir>] [--frames <n>] [--counts 1000,5000,10000]
+
+// 標準ライブラリ
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 外部ライブラリ
+#include <spdlog/spdlog.h>
+
+// プロジェクト内
+#include "core/api/BattleProgressAPI.hpp"
+#include "core/api/ECSystemAPI.hpp"
+#include "core/api/GameplayDataAPI.hpp"
+#include "core/api/SetupAPI.hpp"
+#include "core/config/SharedContext.hpp"
+
+namespace {
+
+using namespace game::core;
+
+struct BenchmarkOptions {
+    std::string root;
+    int frames = 300;
+    std::vector<int> counts = {1000, 5000, 10000};
+};
+
+struct BenchmarkResult {
+    int unitCount = 0;
+    double avgMs = 0.0;
+    double minMs = 0.0;
+    double maxMs = 0.0;
+};
+
+BenchmarkOptions ParseOptions(int argc, char** argv) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            options.root = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--counts" && i + 1 < argc) {
+            options.counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                const int count = std::atoi(item.c_str());
+                if (count > 0) {
+                    options.counts.push_back(count);
+                }
+            }
+        }
+    }
+    return options;
+}
+
+BenchmarkResult RunOnce(SharedContext& ctx,
+                        BattleProgressAPI& battle,
+                        const entities::Character& character,
+                        int unitCount,
+                        int frames) {
+    ctx.ecsAPI->ResetForScene();
+    battle.InitializeFromStage();
+
+    // レーン中央付近に両陣営を交互に配置（撃破で母数が変わらないようHPは大きく取る）
+    const auto& lane = battle.GetLane();
+    const float left = lane.startX + 200.0f;
+    const float right = lane.endX - 200.0f;
+    const float y = lane.y - static_cast<float>(character.move_sprite.frame_height);
+
+    SpawnOverrides overrides;
+    overrides.maxHp = 1000000000;
+    for (int i = 0; i < unitCount; ++i) {
+        const float t = (unitCount > 1) ? static_cast<float>(i) / static_cast<float>(unitCount - 1) : 0.5f;
+        entities::EntityCreationData creationData;
+        creationData.character_id = character.id;
+        creationData.position = {left + (right - left) * t, y};
+        creationData.level = 1;
+        const auto faction = (i % 2 == 0) ? ecs::components::Faction::Player
+                                          : ecs::components::Faction::Enemy;
+        ctx.setupAPI->CreateBattleEntityFromCharacter(character, creationData, faction, &overrides);
+    }
+
+    constexpr float FIXED_DT = 1.0f / 60.0f;
+    constexpr int WARMUP_FRAMES = 10;
+    for (int i = 0; i < WARMUP_FRAMES; ++i) {
+        battle.Update(FIXED_DT);
+    }
+
+    BenchmarkResult result;
+    result.unitCount = unitCount;
+    result.minMs = 1e30;
+    double totalMs = 0.0;
+    for (int i = 0; i < frames; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        battle.Update(FIXED_DT);
+        const auto end = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        totalMs += ms;
+        result.minMs = std::min(result.minMs, ms);
+        result.maxMs = std::max(result.maxMs, ms);
+    }
+    result.avgMs = totalMs / static_cast<double>(frames);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const BenchmarkOptions options = ParseOptions(argc, argv);
+    if (!options.root.empty()) {
+        std::error_code ec;
+        std::filesystem::current_path(options.root, ec);
+        if (ec) {
+            std::fprintf(stderr, "Failed to change directory: %s\n", options.root.c_str());
+            return 1;
+        }
+    }
+
+    // ユニット生成ごとのINFOログを抑制
+    spdlog::set_level(spdlog::level::warn);
+
+    SharedContext ctx;
+    GameplayDataAPI gameplayDataAPI;
+    ECSystemAPI ecsAPI;
+    SetupAPI setupAPI;
+    BattleProgressAPI battle;
+    gameplayDataAPI.SetSaveWritesEnabled(false);
+
+    if (!setupAPI.Initialize(nullptr, &gameplayDataAPI, &ecsAPI, &ctx)) {
+        std::fprintf(stderr, "SetupAPI initialization failed\n");
+        return 1;
+    }
+    if (!battle.Initialize(&ctx)) {
+        std::fprintf(stderr, "BattleProgressAPI initialization failed\n");
+        return 1;
+    }
+    ctx.battleProgressAPI = &battle;
+
+    const auto characterIds = gameplayDataAPI.GetAllCharacterIds();
+    if (characterIds.empty()) {
+        std::fprintf(stderr, "No characters found (run from the directory containing data/)\n");
+        return 1;
+    }
+    auto character = gameplayDataAPI.GetCharacterTemplate(characterIds.front());
+    if (!character) {
+        std::fprintf(stderr, "Character template not found: %s\n", characterIds.front().c_str());
+        return 1;
+    }
+
+    std::printf("BattleProgressAPI::Update benchmark (character=%s, frames=%d)\n",
+                character->id.c_str(), options.frames);
+    std::printf("%10s %12s %12s %12s\n", "units", "avg ms", "min ms", "max ms");
+    for (int count : options.counts) {
+        const BenchmarkResult r = RunOnce(ctx, battle, *character, count, options.frames);
+        std::printf("%10d %12.3f %12.3f %12.3f\n", r.unitCount, r.avgMs, r.minMs, r.maxMs);
+    }
+
+    ecsAPI.ResetForScene();
+    gameplayDataAPI.Shutdown();
+    return 0;
+}
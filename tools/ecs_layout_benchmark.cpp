@@ -0,0 +1,270 @@
+// ECS レイアウト比較ベンチマーク（戦闘ループのホット/コールド分割）
+//
+// 戦闘ループ1ティック分の反復（レーンインデックス用の中心X収集 + 移動/攻撃タイマー更新）を、
+// 旧レイアウトと新レイアウトで同じ入力に対して実行し、1ティックあたりの時間を比較します。
+//   before: 6 コンポーネントの view + エンティティ毎の Try<CharacterId>（文字列キーでマスター検索）
+//           と Try<Sprite>/Try<Position>。Sprite と CharacterId は std::string を持つ。
+//   after : ECSystemAPI::BattleUnits()（ホットな POD を所有するグループ）を each() で走査し、
+//           テンプレートは TemplateIndex の添字で引く。
+// 目標検索（LaneSpatialIndex）は両者で同じコストのため計測対象から外しています。
+// データファイルは不要です。
+//
+// 使い方:
+//   EcsLayoutBenchmark [--frames <n>] [--counts 1000,10000]
+
+// 標準ライブラリ
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 外部ライブラリ
+#include <entt/entt.hpp>
+#include <spdlog/spdlog.h>
+
+// プロジェクト内
+#include "core/api/ECSystemAPI.hpp"
+
+namespace {
+
+using namespace game::core;
+namespace components = ::game::core::ecs::components;
+
+constexpr float FIXED_DT = 1.0f / 60.0f;
+constexpr int TEMPLATE_COUNT = 32;
+constexpr float LANE_LEFT = 200.0f;
+constexpr float LANE_RIGHT = 3600.0f;
+
+// 計算結果を捨てられないようにする受け皿
+volatile float g_sink = 0.0f;
+
+// 分割前のコンポーネント（比較用に当時の形をそのまま残す）
+namespace legacy {
+
+struct Sprite {
+    std::string sheet_path;
+    int frame_width = 0;
+    int frame_height = 0;
+    uint32_t texture_handle = 0;
+};
+
+struct CharacterId {
+    std::string id;
+};
+
+} // namespace legacy
+
+struct TemplateData {
+    float moveSpeed = 0.0f;
+    int frameWidth = 0;
+};
+
+struct BenchmarkOptions {
+    int frames = 300;
+    std::vector<int> counts = {1000, 10000};
+};
+
+struct Sample {
+    double avgMs = 0.0;
+    double minMs = 0.0;
+};
+
+BenchmarkOptions ParseOptions(int argc, char** argv) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--counts" && i + 1 < argc) {
+            options.counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                const int count = std::atoi(item.c_str());
+                if (count > 0) {
+                    options.counts.push_back(count);
+                }
+            }
+        }
+    }
+    return options;
+}
+
+std::string TemplateId(int index) {
+    // SSO に収まらない長さにして、実データ（"character_xxx" 形式）と同じくヒープ確保させる
+    return "benchmark_character_" + std::to_string(index);
+}
+
+float SpawnX(int i, int count) {
+    const float t = (count > 1) ? static_cast<float>(i) / static_cast<float>(count - 1) : 0.5f;
+    return LANE_LEFT + (LANE_RIGHT - LANE_LEFT) * t;
+}
+
+template<typename TickFn>
+Sample Measure(int frames, TickFn&& tick) {
+    constexpr int WARMUP_FRAMES = 10;
+    for (int i = 0; i < WARMUP_FRAMES; ++i) {
+        tick(static_cast<float>(i) * FIXED_DT);
+    }
+    Sample sample;
+    sample.minMs = 1e30;
+    double totalMs = 0.0;
+    for (int i = 0; i < frames; ++i) {
+        const float now = static_cast<float>(WARMUP_FRAMES + i) * FIXED_DT;
+        const auto start = std::chrono::steady_clock::now();
+        g_sink = tick(now);
+        const auto end = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        totalMs += ms;
+        sample.minMs = std::min(sample.minMs, ms);
+    }
+    sample.avgMs = totalMs / static_cast<double>(frames);
+    return sample;
+}
+
+Sample RunBefore(int count, int frames) {
+    std::unordered_map<std::string, TemplateData> masters;
+    for (int t = 0; t < TEMPLATE_COUNT; ++t) {
+        masters[TemplateId(t)] = TemplateData{40.0f + static_cast<float>(t), 64 + t};
+    }
+
+    entt::registry registry;
+    for (int i = 0; i < count; ++i) {
+        const auto e = registry.create();
+        const int t = i % TEMPLATE_COUNT;
+        registry.emplace<components::Position>(e, SpawnX(i, count), 500.0f);
+        registry.emplace<components::Health>(e, 1000000);
+        registry.emplace<components::Stats>(e, 10, 1);
+        registry.emplace<components::Movement>(e, masters[TemplateId(t)].moveSpeed);
+        auto& combat = registry.emplace<components::Combat>(e);
+        combat.attack_span = 1.0f + 0.01f * static_cast<float>(t);
+        combat.last_attack_time = -9999.0f;
+        registry.emplace<legacy::Sprite>(e, legacy::Sprite{"assets/characters/" + TemplateId(t) + "/move.png",
+                                                           64 + t, 64, 1});
+        registry.emplace<components::Animation>(e);
+        registry.emplace<legacy::CharacterId>(e, legacy::CharacterId{TemplateId(t)});
+        registry.emplace<components::Team>(e, (i % 2 == 0) ? components::Faction::Player
+                                                           : components::Faction::Enemy);
+    }
+
+    std::vector<float> centers;
+    centers.reserve(static_cast<size_t>(count));
+    return Measure(frames, [&](float now) {
+        centers.clear();
+        auto index = registry.view<components::Position, legacy::Sprite, components::Team, components::Health>();
+        for (auto e : index) {
+            const auto& hp = index.get<components::Health>(e);
+            if (hp.current <= 0) continue;
+            const auto& pos = index.get<components::Position>(e);
+            const auto& sprite = index.get<legacy::Sprite>(e);
+            centers.push_back(pos.x + static_cast<float>(sprite.frame_width) * 0.5f);
+        }
+
+        float checksum = 0.0f;
+        auto units = registry.view<components::Position, legacy::Sprite, components::Movement,
+                                   components::Stats, components::Combat, components::Team>();
+        for (auto e : units) {
+            auto& pos = units.get<components::Position>(e);
+            auto& move = units.get<components::Movement>(e);
+            auto& combat = units.get<components::Combat>(e);
+            const auto& team = units.get<components::Team>(e);
+
+            const TemplateData* tmpl = nullptr;
+            if (const auto* chId = registry.try_get<legacy::CharacterId>(e)) {
+                const auto it = masters.find(chId->id);
+                tmpl = (it != masters.end()) ? &it->second : nullptr;
+            }
+            // 旧 findNearestTarget が自分の位置と寸法を引き直していた分
+            const auto* selfPos = registry.try_get<components::Position>(e);
+            const auto* selfSprite = registry.try_get<legacy::Sprite>(e);
+            const float centerX = selfPos->x + static_cast<float>(selfSprite->frame_width) * 0.5f;
+
+            const float dir = (team.faction == components::Faction::Player) ? -1.0f : 1.0f;
+            if (combat.CanAttack(now)) {
+                combat.last_attack_time = now;
+            }
+            move.velocity = {dir * move.speed, 0.0f};
+            pos.x += move.velocity.x * FIXED_DT;
+            checksum += centerX + (tmpl ? static_cast<float>(tmpl->frameWidth) : 0.0f);
+        }
+        return checksum + static_cast<float>(centers.size());
+    });
+}
+
+Sample RunAfter(int count, int frames) {
+    std::vector<TemplateData> templates;
+    for (int t = 0; t < TEMPLATE_COUNT; ++t) {
+        templates.push_back(TemplateData{40.0f + static_cast<float>(t), 64 + t});
+    }
+
+    ECSystemAPI ecsAPI;
+    auto units = ecsAPI.BattleUnits();
+    for (int i = 0; i < count; ++i) {
+        const auto e = ecsAPI.Create();
+        const int t = i % TEMPLATE_COUNT;
+        ecsAPI.Add<components::Position>(e, SpawnX(i, count), 500.0f);
+        ecsAPI.Add<components::Health>(e, 1000000);
+        ecsAPI.Add<components::Stats>(e, 10, 1);
+        ecsAPI.Add<components::Movement>(e, templates[static_cast<size_t>(t)].moveSpeed);
+        auto& combat = ecsAPI.Add<components::Combat>(e);
+        combat.attack_span = 1.0f + 0.01f * static_cast<float>(t);
+        combat.last_attack_time = -9999.0f;
+        ecsAPI.Add<components::Sprite>(e, 64 + t, 64, 1u);
+        ecsAPI.Add<components::SpriteSource>(e, "assets/characters/" + TemplateId(t) + "/move.png");
+        ecsAPI.Add<components::Animation>(e);
+        ecsAPI.Add<components::CharacterId>(e, TemplateId(t));
+        ecsAPI.Add<components::TemplateIndex>(e, t);
+        ecsAPI.Add<components::Team>(e, (i % 2 == 0) ? components::Faction::Player
+                                                     : components::Faction::Enemy);
+    }
+
+    std::vector<float> centers;
+    centers.reserve(static_cast<size_t>(count));
+    return Measure(frames, [&](float now) {
+        centers.clear();
+        for (auto [e, pos, sprite, team, hp, move, stats, combat, ref] : units.each()) {
+            if (hp.current <= 0) continue;
+            centers.push_back(pos.x + static_cast<float>(sprite.frame_width) * 0.5f);
+        }
+
+        float checksum = 0.0f;
+        for (auto [e, pos, sprite, team, hp, move, stats, combat, ref] : units.each()) {
+            const TemplateData* tmpl =
+                ref.IsValid() ? &templates[static_cast<size_t>(ref.index)] : nullptr;
+            const float centerX = pos.x + static_cast<float>(sprite.frame_width) * 0.5f;
+
+            const float dir = (team.faction == components::Faction::Player) ? -1.0f : 1.0f;
+            if (combat.CanAttack(now)) {
+                combat.last_attack_time = now;
+            }
+            move.velocity = {dir * move.speed, 0.0f};
+            pos.x += move.velocity.x * FIXED_DT;
+            checksum += centerX + (tmpl ? static_cast<float>(tmpl->frameWidth) : 0.0f);
+        }
+        return checksum + static_cast<float>(centers.size());
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const BenchmarkOptions options = ParseOptions(argc, argv);
+    spdlog::set_level(spdlog::level::warn);
+
+    std::printf("Battle loop ECS layout benchmark (frames=%d, templates=%d)\n",
+                options.frames, TEMPLATE_COUNT);
+    std::printf("%10s %14s %14s %14s %14s %9s\n",
+                "entities", "before avg ms", "before min ms", "after avg ms", "after min ms", "speedup");
+    for (int count : options.counts) {
+        const Sample before = RunBefore(count, options.frames);
+        const Sample after = RunAfter(count, options.frames);
+        const double speedup = (after.avgMs > 0.0) ? before.avgMs / after.avgMs : 0.0;
+        std::printf("%10d %14.4f %14.4f %14.4f %14.4f %8.2fx\n",
+                    count, before.avgMs, before.minMs, after.avgMs, after.minMs, speedup);
+    }
+    return 0;
+}
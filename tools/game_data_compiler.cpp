@@ -0,0 +1,193 @@
+// ゲームデータコンパイラ
+//
+// data/ 配下のマスター JSON（キャラ/パッシブ・装備/ステージ/タワーアタッチメント）を読み込んで検証し、
+// 実行時に字句解析なしで読めるバイナリパック（GameDataPack）へ書き出します。
+// 書き出し後にパックを読み戻し、件数とステージ JSON が一致することを確認します。
+// ゲームはパックが全 JSON より新しいときだけパックを使い、それ以外は JSON から読み込みます。
+//
+// 使い方（data/ を含むディレクトリで実行、または --root で指定）:
+//   GameDataCompiler [--root <dir>] [--out <path>]
+
+// 標準ライブラリ
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 外部ライブラリ
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+// プロジェクト内
+#include "core/ecs/entities/CharacterLoader.hpp"
+#include "core/ecs/entities/GameDataPack.hpp"
+#include "core/ecs/entities/ItemPassiveLoader.hpp"
+#include "core/ecs/entities/StageLoader.hpp"
+#include "core/ecs/entities/TowerAttachmentLoader.hpp"
+
+namespace {
+
+using namespace game::core::entities;
+
+struct CompilerOptions {
+    std::string root;
+    std::string outPath = GameDataPack::DEFAULT_PATH;
+    std::string characterJsonPath = "data/characters.json";
+    std::string itemPassiveJsonPath = "data/item_passive.json";
+    std::string stageJsonPath = "data/stages.json";
+    std::string towerAttachmentJsonPath = "data/tower_attachments.json";
+};
+
+CompilerOptions ParseOptions(int argc, char** argv) {
+    CompilerOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            options.root = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            options.outPath = argv[++i];
+        }
+    }
+    return options;
+}
+
+/// @brief ゲーム側で前提にしている不変条件を確認（違反は件数を返す）
+int Validate(const GameDataPackContents& contents) {
+    int errors = 0;
+    auto fail = [&errors](const std::string& message) {
+        std::fprintf(stderr, "error: %s\n", message.c_str());
+        ++errors;
+    };
+
+    for (const auto& [id, ch] : contents.characters) {
+        if (id.empty() || id != ch.id) {
+            fail("character key/id mismatch: '" + id + "'");
+        }
+        if (ch.rarity < 1 || ch.rarity > 5) {
+            fail("character '" + id + "' has rarity " + std::to_string(ch.rarity));
+        }
+    }
+    for (const auto& [id, skill] : contents.passives) {
+        if (id.empty() || id != skill.id) {
+            fail("passive key/id mismatch: '" + id + "'");
+        }
+    }
+    for (const auto& [id, equipment] : contents.equipment) {
+        if (id.empty() || id != equipment.id) {
+            fail("equipment key/id mismatch: '" + id + "'");
+        }
+    }
+    for (const auto& [id, attachment] : contents.towerAttachments) {
+        if (id.empty() || id != attachment.id) {
+            fail("tower attachment key/id mismatch: '" + id + "'");
+        }
+    }
+    for (const auto& [id, stage] : contents.stages) {
+        if (id.empty() || id != stage.id) {
+            fail("stage key/id mismatch: '" + id + "'");
+        }
+        for (const auto& next : stage.unlockOnClear) {
+            if (contents.stages.find(next) == contents.stages.end()) {
+                fail("stage '" + id + "' unlocks unknown stage '" + next + "'");
+            }
+        }
+    }
+    return errors;
+}
+
+/// @brief 読み戻したパックが元データと一致するか（件数とステージ JSON を比較）
+bool VerifyRoundTrip(const GameDataPackContents& expected, const std::string& path) {
+    GameDataPackContents actual;
+    std::string error;
+    if (!GameDataPack::Load(path, actual, &error)) {
+        std::fprintf(stderr, "error: reload failed: %s\n", error.c_str());
+        return false;
+    }
+    if (actual.characters.size() != expected.characters.size() ||
+        actual.passives.size() != expected.passives.size() ||
+        actual.equipment.size() != expected.equipment.size() ||
+        actual.stages.size() != expected.stages.size() ||
+        actual.towerAttachments.size() != expected.towerAttachments.size()) {
+        std::fprintf(stderr, "error: reloaded record counts differ\n");
+        return false;
+    }
+    for (const auto& [id, stage] : expected.stages) {
+        auto it = actual.stages.find(id);
+        // 読み込み側は CBOR を展開せずに保持するので、比較用にここで展開する
+        const nlohmann::json reloaded =
+            (it != actual.stages.end() && !it->second.packedData.empty())
+                ? nlohmann::json::from_cbor(it->second.packedData, true, false)
+                : nlohmann::json();
+        if (it == actual.stages.end() || reloaded != stage.data) {
+            std::fprintf(stderr, "error: stage '%s' differs after reload\n", id.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const CompilerOptions options = ParseOptions(argc, argv);
+    if (!options.root.empty()) {
+        std::error_code ec;
+        std::filesystem::current_path(options.root, ec);
+        if (ec) {
+            std::fprintf(stderr, "Failed to change directory: %s\n", options.root.c_str());
+            return 1;
+        }
+    }
+
+    spdlog::set_level(spdlog::level::warn);
+
+    // ハードコードのフォールバックは使わない（JSON が読めなければ失敗）
+    GameDataPackContents contents;
+    std::unordered_map<int, std::string> stageNumberToId;
+    if (!CharacterLoader::LoadFromJSON(options.characterJsonPath, contents.characters)) {
+        std::fprintf(stderr, "Failed to load: %s\n", options.characterJsonPath.c_str());
+        return 1;
+    }
+    if (!ItemPassiveLoader::LoadFromJSON(options.itemPassiveJsonPath, contents.passives,
+                                         contents.equipment)) {
+        std::fprintf(stderr, "Failed to load: %s\n", options.itemPassiveJsonPath.c_str());
+        return 1;
+    }
+    if (!StageLoader::LoadFromJSON(options.stageJsonPath, contents.stages, stageNumberToId)) {
+        std::fprintf(stderr, "Failed to load: %s\n", options.stageJsonPath.c_str());
+        return 1;
+    }
+    if (!TowerAttachmentLoader::LoadFromJSON(options.towerAttachmentJsonPath,
+                                             contents.towerAttachments)) {
+        std::fprintf(stderr, "Failed to load: %s\n", options.towerAttachmentJsonPath.c_str());
+        return 1;
+    }
+
+    const int errors = Validate(contents);
+    if (errors > 0) {
+        std::fprintf(stderr, "%d validation error(s); pack not written\n", errors);
+        return 1;
+    }
+
+    std::string error;
+    if (!GameDataPack::Write(options.outPath, contents, &error)) {
+        std::fprintf(stderr, "Failed to write pack: %s\n", error.c_str());
+        return 1;
+    }
+    if (!VerifyRoundTrip(contents, options.outPath)) {
+        std::error_code ec;
+        std::filesystem::remove(options.outPath, ec);
+        return 1;
+    }
+
+    std::error_code ec;
+    const auto bytes = std::filesystem::file_size(options.outPath, ec);
+    std::printf("%s: %zu characters, %zu passives, %zu equipment, %zu stages, "
+                "%zu tower attachments (%llu bytes)\n",
+                options.outPath.c_str(), contents.characters.size(), contents.passives.size(),
+                contents.equipment.size(), contents.stages.size(),
+                contents.towerAttachments.size(),
+                static_cast<unsigned long long>(ec ? 0 : bytes));
+    return 0;
+}
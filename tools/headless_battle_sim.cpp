@@ -0,0 +1,171 @@
+// ヘッドレス戦闘シミュレーター
+//
+// ウィンドウ/オーディオを開かずに HeadlessBattleRunner でステージを固定ステップ実行し、
+// 勝敗・クリア時間・タワー残りHP・スループット（シミュレーション秒/実時間秒）を出力します。
+// 同じ入力（ステージ/編成/刻み幅）からは常に同じ結果になります。
+//
+// 使い方（data/ を含むディレクトリで実行、または --root で指定）:
+//   HeadlessBattleSim [--root <dir>] [--stage <id>]... [--formation a,b,c]
+//                     [--dt <sec>] [--max-time <sec>] [--json <path>]
+
+// 標準ライブラリ
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 外部ライブラリ
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+// プロジェクト内
+#include "core/api/GameplayDataAPI.hpp"
+#include "core/game/HeadlessBattleRunner.hpp"
+
+namespace {
+
+using namespace game::core;
+using ::game::core::game::HeadlessBattleConfig;
+using ::game::core::game::HeadlessBattleResult;
+using ::game::core::game::HeadlessBattleRunner;
+
+struct SimOptions {
+    std::string root;
+    std::vector<std::string> stageIds;   // 空なら全ステージ
+    std::vector<std::string> formation;  // 空ならセーブデータの編成
+    float dt = 1.0f / 60.0f;
+    float maxTime = 600.0f;
+    std::string jsonPath;
+};
+
+SimOptions ParseOptions(int argc, char** argv) {
+    SimOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            options.root = argv[++i];
+        } else if (arg == "--stage" && i + 1 < argc) {
+            options.stageIds.push_back(argv[++i]);
+        } else if (arg == "--formation" && i + 1 < argc) {
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                if (!item.empty()) {
+                    options.formation.push_back(item);
+                }
+            }
+        } else if (arg == "--dt" && i + 1 < argc) {
+            const float dt = static_cast<float>(std::atof(argv[++i]));
+            if (dt > 0.0f) {
+                options.dt = dt;
+            }
+        } else if (arg == "--max-time" && i + 1 < argc) {
+            const float maxTime = static_cast<float>(std::atof(argv[++i]));
+            if (maxTime > 0.0f) {
+                options.maxTime = maxTime;
+            }
+        } else if (arg == "--json" && i + 1 < argc) {
+            options.jsonPath = argv[++i];
+        }
+    }
+    return options;
+}
+
+const char* ResultToString(const HeadlessBattleResult& r) {
+    if (r.timedOut) {
+        return "timeout";
+    }
+    switch (r.result) {
+    case BattleProgressAPI::BattleResult::Victory:
+        return "victory";
+    case BattleProgressAPI::BattleResult::Defeat:
+        return "defeat";
+    default:
+        return "in_progress";
+    }
+}
+
+nlohmann::json ResultToJson(const HeadlessBattleResult& r) {
+    nlohmann::json j;
+    j["stageId"] = r.stageId;
+    j["result"] = ResultToString(r);
+    j["clearTime"] = r.clearTime;
+    j["playerTowerHp"] = r.playerTowerHp;
+    j["playerTowerMaxHp"] = r.playerTowerMaxHp;
+    j["enemyTowerHp"] = r.enemyTowerHp;
+    j["enemyTowerMaxHp"] = r.enemyTowerMaxHp;
+    j["spawnedUnitCount"] = r.spawnedUnitCount;
+    j["totalGoldSpent"] = r.totalGoldSpent;
+    j["ticks"] = r.ticks;
+    j["wallSeconds"] = r.wallSeconds;
+    j["simSecondsPerWallSecond"] = r.SimSecondsPerWallSecond();
+    return j;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const SimOptions options = ParseOptions(argc, argv);
+    if (!options.root.empty()) {
+        std::error_code ec;
+        std::filesystem::current_path(options.root, ec);
+        if (ec) {
+            std::fprintf(stderr, "Failed to change directory: %s\n", options.root.c_str());
+            return 1;
+        }
+    }
+
+    // ユニット生成ごとのINFOログを抑制
+    spdlog::set_level(spdlog::level::warn);
+
+    HeadlessBattleRunner runner;
+    if (!runner.Initialize()) {
+        std::fprintf(stderr, "HeadlessBattleRunner initialization failed\n");
+        return 1;
+    }
+
+    std::vector<std::string> stageIds = options.stageIds;
+    if (stageIds.empty()) {
+        stageIds = runner.GetGameplayDataAPI()->GetAllStageIds();
+    }
+    if (stageIds.empty()) {
+        std::fprintf(stderr, "No stages found (run from the directory containing data/)\n");
+        return 1;
+    }
+
+    HeadlessBattleConfig config;
+    config.fixedDeltaTime = options.dt;
+    config.maxBattleSeconds = options.maxTime;
+    for (size_t i = 0; i < options.formation.size(); ++i) {
+        config.formation.slots.emplace_back(static_cast<int>(i), options.formation[i]);
+    }
+
+    std::printf("%-24s %-10s %10s %14s %14s %8s %10s %14s\n",
+                "stage", "result", "time s", "player hp", "enemy hp", "units", "wall ms", "sim s/wall s");
+    nlohmann::json report = nlohmann::json::array();
+    for (const auto& stageId : stageIds) {
+        config.stageId = stageId;
+        const HeadlessBattleResult r = runner.Run(config);
+        std::printf("%-24s %-10s %10.2f %7d/%-6d %7d/%-6d %8d %10.2f %14.1f\n",
+                    r.stageId.c_str(), ResultToString(r), r.clearTime,
+                    r.playerTowerHp, r.playerTowerMaxHp,
+                    r.enemyTowerHp, r.enemyTowerMaxHp,
+                    r.spawnedUnitCount, r.wallSeconds * 1000.0, r.SimSecondsPerWallSecond());
+        report.push_back(ResultToJson(r));
+    }
+
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        if (!out) {
+            std::fprintf(stderr, "Failed to open: %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+        out << report.dump(2) << "\n";
+    }
+
+    runner.Shutdown();
+    return 0;
+}